@@ -1,16 +1,34 @@
 #include "button.h"
 #include <esp_log.h>
+#include <metrics.h>
+#include <trace.h>
 
 input_callback_t input_callback = NULL;
 static QueueHandle_t button_event_queue;
 static uint32_t last_interrupt_time = 0;
 
+// Số sự kiện theo nút và loại nhấn
+static metric_t button_metrics[2][2] = {
+    {
+        METRIC_COUNTER_INIT("smartlight_button_events_total", "button=\"back\",event=\"press\"", "Button events"),
+        METRIC_COUNTER_INIT("smartlight_button_events_total", "button=\"back\",event=\"long_press\"", "Button events"),
+    },
+    {
+        METRIC_COUNTER_INIT("smartlight_button_events_total", "button=\"next\",event=\"press\"", "Button events"),
+        METRIC_COUNTER_INIT("smartlight_button_events_total", "button=\"next\",event=\"long_press\"", "Button events"),
+    },
+};
+static metric_t button_irq_metric = METRIC_COUNTER_INIT("smartlight_button_wakeups_total", NULL,
+                                                        "Button task wake-ups after debounce in ISR");
+
 /// @brief xử lý khi gọi ngắt ngoài
 /// @param arg 
 static void IRAM_ATTR gpio_input_handler(void* arg) {
     int num = (uint32_t) arg;
     uint32_t interrupt_time = xTaskGetTickCountFromISR();
 
+    trace_record(TRACE_BUTTON_ISR, num);
+
     // Kiểm tra thời gian từ lần ngắt cuối cùng và trạng thái nút
     if ((interrupt_time - last_interrupt_time) > (DEBOUNCE_TIME_MS / portTICK_PERIOD_MS)) {
         last_interrupt_time = interrupt_time;
@@ -18,28 +36,55 @@ static void IRAM_ATTR gpio_input_handler(void* arg) {
     }
 }
 
+/// @brief chờ nút được nhả, phân biệt nhấn ngắn và giữ lâu
+/// @param num chân GPIO của nút
+/// @return BUTTON_EVENT_LONG_PRESS nếu giữ quá LONG_PRESS_TIME_MS
+static button_event_t button_wait_release(uint32_t num) {
+    uint32_t held_ms = 0;
+
+    while (gpio_get_level(num) == 0) {
+        if (held_ms >= LONG_PRESS_TIME_MS) {
+            return BUTTON_EVENT_LONG_PRESS;
+        }
+        vTaskDelay(BUTTON_POLL_MS / portTICK_PERIOD_MS);
+        held_ms += BUTTON_POLL_MS;
+    }
+    return BUTTON_EVENT_PRESS;
+}
+
 // hàm tác vụ / task xử lý sự kiện nhấn nút
 static void button_task(void* arg) {
     uint32_t num;
+    button_event_t event;
     while (1) {
         if (xQueueReceive(button_event_queue, &num, portMAX_DELAY)) {
+            metric_inc(&button_irq_metric);
+            trace_record(TRACE_BUTTON_RX, num);
             if (gpio_get_level(num) == 0){
                 vTaskDelay(DEBOUNCE_TIME_MS / portTICK_PERIOD_MS);
                 if (gpio_get_level(num) == 0){
+                    event = button_wait_release(num);
+                    trace_record(TRACE_BUTTON_EVENT, num);
                     switch (num){
                         case BUTTON_BACK:
-                            ESP_LOGI("Task", "Button BACK triggered");
-                            input_callback(num);
+                            metric_inc(&button_metrics[0][event]);
+                            ESP_LOGI("Task", "Button BACK triggered (%s)", event == BUTTON_EVENT_LONG_PRESS ? "long" : "short");
+                            input_callback(num, event);
                             break;
                         
                         case BUTTON_NEXT:
-                            ESP_LOGI("Task", "Button NEXT triggered");
-                            input_callback(num);
+                            metric_inc(&button_metrics[1][event]);
+                            ESP_LOGI("Task", "Button NEXT triggered (%s)", event == BUTTON_EVENT_LONG_PRESS ? "long" : "short");
+                            input_callback(num, event);
                             break;
 
                         default:
                             break;
                     }
+                    // Giữ lâu: bỏ qua phần còn lại cho tới khi nút được nhả
+                    while (gpio_get_level(num) == 0) {
+                        vTaskDelay(BUTTON_POLL_MS / portTICK_PERIOD_MS);
+                    }
                 }
             }
             
@@ -55,6 +100,12 @@ static void button_task(void* arg) {
 */ 
 void button_init(void)
 {   
+    for (int i = 0; i < 2; i++) {
+        metrics_register(&button_metrics[i][BUTTON_EVENT_PRESS]);
+        metrics_register(&button_metrics[i][BUTTON_EVENT_LONG_PRESS]);
+    }
+    metrics_register(&button_irq_metric);
+
     //setup cho Task
     button_event_queue = xQueueCreate(10, sizeof(uint32_t));
     xTaskCreate(button_task, "button_task", 2048, NULL, 10, NULL);
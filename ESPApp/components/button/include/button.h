@@ -12,13 +12,18 @@
 #define BUTTON_BACK 16
 #define BUTTON_NEXT 15
 
-#define LED1        42
-#define LED2        41
-
 #define ESP_INTR_FLAG_DEFAULT 0
 #define DEBOUNCE_TIME_MS 5
+#define LONG_PRESS_TIME_MS 600
+#define BUTTON_POLL_MS 10
+
+// Loại sự kiện nút nhấn: nhấn ngắn (báo khi nhả) hoặc giữ lâu
+typedef enum {
+    BUTTON_EVENT_PRESS = 0,
+    BUTTON_EVENT_LONG_PRESS,
+} button_event_t;
 
-typedef void (*input_callback_t)(gpio_num_t gpio_num);
+typedef void (*input_callback_t)(gpio_num_t gpio_num, button_event_t event);
 
 void button_init(void);
 void input_set_callback(void *cb);
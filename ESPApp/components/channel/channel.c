@@ -0,0 +1,223 @@
+#include "channel.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <esp_log.h>
+#include <trace.h>
+
+static const char *TAG = "Channel";
+
+// Chân GPIO của từng kênh, GPIO_NUM_NC nếu kênh chưa nối phần cứng
+static const gpio_num_t channel_pins[CHANNEL_COUNT] = {
+    [0] = LED1,
+    [1] = LED2,
+    [2 ... CHANNEL_COUNT - 1] = GPIO_NUM_NC,
+};
+
+static volatile int channel_state[CHANNEL_COUNT];
+static volatile uint32_t state_version;
+static portMUX_TYPE channel_lock = portMUX_INITIALIZER_UNLOCKED;
+// Giữ suốt một lần đổi trạng thái (state, GPIO, listener) để các task đổi kênh
+// không xen nhau: relay và listener luôn thấy cùng thứ tự với channel_state
+static SemaphoreHandle_t channel_mutex;
+
+static channel_listener_t listeners[CHANNEL_LISTENER_MAX];
+static int listener_count = 0;
+
+static void channel_notify(uint8_t ch, int state)
+{
+    for (int i = 0; i < listener_count; i++) {
+        listeners[i](ch, state);
+    }
+}
+
+/* Đưa các kênh đã đổi ra GPIO và báo listener; gọi khi đang giữ channel_mutex */
+static void channel_apply(uint16_t changed, uint16_t values)
+{
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        if (!(changed & (1u << i))) {
+            continue;
+        }
+        if (channel_pins[i] != GPIO_NUM_NC) {
+            gpio_set_level(channel_pins[i], (values >> i) & 1);
+        }
+        trace_record(TRACE_GPIO, i);
+        channel_notify(i, (values >> i) & 1);
+    }
+}
+
+/**
+ * @func	channel_init
+ * @brief	Khởi tạo chân output của các kênh có nối GPIO
+ * @param	None
+ * @retval  None
+*/
+void channel_init(void)
+{
+    channel_mutex = xSemaphoreCreateMutex();
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        if (channel_pins[i] == GPIO_NUM_NC) {
+            continue;
+        }
+        gpio_reset_pin(channel_pins[i]);
+        gpio_set_direction(channel_pins[i], GPIO_MODE_OUTPUT);
+        gpio_set_level(channel_pins[i], channel_state[i]);
+    }
+}
+
+int channel_get(uint8_t ch)
+{
+    if (ch >= CHANNEL_COUNT) {
+        return 0;
+    }
+    return channel_state[ch];
+}
+
+/// @brief Đặt trạng thái một kênh, báo cho các listener nếu có thay đổi
+/// @param ch kênh (0..CHANNEL_COUNT-1)
+/// @param state 0: tắt, khác 0: bật
+void channel_set(uint8_t ch, int state)
+{
+    int changed;
+
+    if (ch >= CHANNEL_COUNT) {
+        ESP_LOGW(TAG, "Invalid channel %d", ch);
+        return;
+    }
+    state = state ? 1 : 0;
+
+    xSemaphoreTake(channel_mutex, portMAX_DELAY);
+    portENTER_CRITICAL(&channel_lock);
+    changed = (channel_state[ch] != state);
+    channel_state[ch] = state;
+    state_version += changed;
+    portEXIT_CRITICAL(&channel_lock);
+
+    if (changed) {
+        channel_apply(1u << ch, state << ch);
+    }
+    xSemaphoreGive(channel_mutex);
+}
+
+/// @brief Đảo trạng thái một kênh
+/// @param ch kênh (0..CHANNEL_COUNT-1)
+void channel_toggle(uint8_t ch)
+{
+    int state;
+
+    if (ch >= CHANNEL_COUNT) {
+        ESP_LOGW(TAG, "Invalid channel %d", ch);
+        return;
+    }
+
+    xSemaphoreTake(channel_mutex, portMAX_DELAY);
+    portENTER_CRITICAL(&channel_lock);
+    state = 1 - channel_state[ch];
+    channel_state[ch] = state;
+    state_version++;
+    portEXIT_CRITICAL(&channel_lock);
+
+    channel_apply(1u << ch, state << ch);
+    xSemaphoreGive(channel_mutex);
+}
+
+uint16_t channel_get_mask(void)
+{
+    return channel_snapshot(NULL);
+}
+
+uint32_t channel_version(void)
+{
+    return state_version;
+}
+
+/// @brief Đọc trạng thái tất cả các kênh cùng phiên bản tương ứng trong một lần khoá
+/// @param version nhận phiên bản của trạng thái trả về (có thể NULL)
+/// @return bitmask trạng thái (bit i = kênh i)
+uint16_t channel_snapshot(uint32_t *version)
+{
+    uint16_t bits = 0;
+
+    portENTER_CRITICAL(&channel_lock);
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        if (channel_state[i]) {
+            bits |= 1u << i;
+        }
+    }
+    if (version != NULL) {
+        *version = state_version;
+    }
+    portEXIT_CRITICAL(&channel_lock);
+    return bits;
+}
+
+/// @brief Đặt nhiều kênh cùng lúc; mọi kênh được cập nhật trong một lần khoá
+///        nên không task nào đọc được trạng thái nửa cũ nửa mới
+/// @param mask các kênh cần đặt (bit i = kênh i), kênh ngoài mask giữ nguyên
+/// @param values trạng thái mong muốn của các kênh trong mask
+/// @return bitmask các kênh thực sự đổi trạng thái (0 nếu lặp lại cùng yêu cầu)
+uint16_t channel_set_mask(uint16_t mask, uint16_t values)
+{
+    uint16_t changed = 0;
+
+    xSemaphoreTake(channel_mutex, portMAX_DELAY);
+    portENTER_CRITICAL(&channel_lock);
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        int state = (values >> i) & 1;
+
+        if (!(mask & (1u << i)) || channel_state[i] == state) {
+            continue;
+        }
+        channel_state[i] = state;
+        changed |= 1u << i;
+    }
+    // Cả lô thay đổi chỉ tăng phiên bản một lần
+    state_version += (changed != 0);
+    portEXIT_CRITICAL(&channel_lock);
+
+    channel_apply(changed, values);
+    xSemaphoreGive(channel_mutex);
+    return changed;
+}
+
+/// @brief Đảo nhiều kênh cùng lúc so với trạng thái hiện tại, trong một lần khoá
+/// @param mask các kênh cần đảo (bit i = kênh i)
+/// @return trạng thái mới của tất cả các kênh (bit i = kênh i), đọc trong cùng lần khoá
+uint16_t channel_toggle_mask(uint16_t mask)
+{
+    uint16_t values = 0;
+
+    xSemaphoreTake(channel_mutex, portMAX_DELAY);
+    portENTER_CRITICAL(&channel_lock);
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        if (mask & (1u << i)) {
+            channel_state[i] = 1 - channel_state[i];
+        }
+        if (channel_state[i]) {
+            values |= 1u << i;
+        }
+    }
+    state_version += (mask != 0);
+    portEXIT_CRITICAL(&channel_lock);
+
+    channel_apply(mask, values);
+    xSemaphoreGive(channel_mutex);
+    return values;
+}
+
+const volatile int *channel_state_ref(uint8_t ch)
+{
+    return &channel_state[ch < CHANNEL_COUNT ? ch : 0];
+}
+
+/// @brief Đăng ký hàm được gọi khi kênh đổi trạng thái (gọi trong task thay đổi,
+///        đang giữ khoá của channel nên listener không được đổi kênh)
+/// @param cb 
+/// @return 0 nếu thành công, -1 nếu đã đầy
+int channel_add_listener(channel_listener_t cb)
+{
+    if (listener_count >= CHANNEL_LISTENER_MAX) {
+        return -1;
+    }
+    listeners[listener_count++] = cb;
+    return 0;
+}
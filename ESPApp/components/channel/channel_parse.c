@@ -0,0 +1,123 @@
+#include "channel.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *skip_ws(const char *p)
+{
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    return p;
+}
+
+/* Đọc một giá trị số (thập phân hoặc 0x..) hoặc true/false */
+static const char *parse_value(const char *p, unsigned long *out)
+{
+    char *end;
+
+    if (strncmp(p, "true", 4) == 0) {
+        *out = 1;
+        return p + 4;
+    }
+    if (strncmp(p, "false", 5) == 0) {
+        *out = 0;
+        return p + 5;
+    }
+    if (*p == '"') {
+        // Cho phép bitmask dạng chuỗi, ví dụ "0x00ff"
+        *out = strtoul(p + 1, &end, 0);
+        return (end == p + 1 || *end != '"') ? NULL : end + 1;
+    }
+    *out = strtoul(p, &end, 0);
+    return end == p ? NULL : end;
+}
+
+/* Phân tích trạng thái mong muốn của các kênh. Các dạng được chấp nhận:
+ *   0x0003                      bitmask cho cả 16 kênh
+ *   {"mask": 3, "state": 1}     chỉ đặt các kênh trong mask
+ *   {"state": 5}                bitmask cho cả 16 kênh
+ *   {"0": true, "5": 0}         từng kênh theo chỉ số
+ * Dùng chung cho PUT /state, PUT /scene và lệnh MQTT.
+ * Trả về 0 nếu thành công, -1 nếu sai cú pháp */
+int channel_parse_state(const char *p, uint16_t *mask, uint16_t *values)
+{
+    unsigned long v;
+    int has_mask = 0, has_state = 0;
+
+    *mask = 0;
+    *values = 0;
+    p = skip_ws(p);
+
+    if (*p != '{') {
+        p = parse_value(p, &v);
+        if (p == NULL || *skip_ws(p) != '\0' || v > 0xFFFF) {
+            return -1;
+        }
+        *mask = 0xFFFF;
+        *values = v;
+        return 0;
+    }
+
+    p = skip_ws(p + 1);
+    while (*p != '}') {
+        char key[8];
+        size_t len = 0;
+
+        if (*p++ != '"') {
+            return -1;
+        }
+        while (*p != '"' && *p != '\0' && len < sizeof(key) - 1) {
+            key[len++] = *p++;
+        }
+        key[len] = '\0';
+        if (*p++ != '"') {
+            return -1;
+        }
+        p = skip_ws(p);
+        if (*p++ != ':') {
+            return -1;
+        }
+        p = parse_value(skip_ws(p), &v);
+        if (p == NULL) {
+            return -1;
+        }
+
+        if (strcmp(key, "mask") == 0) {
+            if (v > 0xFFFF) return -1;
+            *mask = v;
+            has_mask = 1;
+        } else if (strcmp(key, "state") == 0) {
+            if (v > 0xFFFF) return -1;
+            *values = v;
+            has_state = 1;
+        } else {
+            char *end;
+            unsigned long ch = strtoul(key, &end, 10);
+            if (end == key || *end != '\0' || ch >= CHANNEL_COUNT) {
+                return -1;
+            }
+            *mask |= 1u << ch;
+            if (v) {
+                *values |= 1u << ch;
+            } else {
+                *values &= ~(1u << ch);
+            }
+        }
+
+        p = skip_ws(p);
+        if (*p == ',') {
+            p = skip_ws(p + 1);
+        } else if (*p != '}') {
+            return -1;
+        }
+    }
+    if (*skip_ws(p + 1) != '\0') {
+        return -1;
+    }
+    if (has_state && !has_mask) {
+        *mask = 0xFFFF;
+    }
+    *values &= *mask;
+    return (*mask != 0) ? 0 : -1;
+}
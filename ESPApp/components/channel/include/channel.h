@@ -0,0 +1,40 @@
+#ifndef __CHANNEL_H__
+#define __CHANNEL_H__
+
+#include <stdint.h>
+#include <driver/gpio.h>
+
+// Số kênh đèn quản lý (kênh chưa nối chân GPIO vẫn giữ trạng thái)
+#define CHANNEL_COUNT       16
+#define CHANNEL_LISTENER_MAX 8
+
+#define LED1        42
+#define LED2        41
+
+// Hàm được gọi mỗi khi một kênh đổi trạng thái
+typedef void (*channel_listener_t)(uint8_t ch, int state);
+
+void channel_init(void);
+
+int channel_get(uint8_t ch);
+void channel_set(uint8_t ch, int state);
+void channel_toggle(uint8_t ch);
+
+// Trạng thái tất cả các kênh dưới dạng bitmask (bit i = kênh i)
+uint16_t channel_get_mask(void);
+uint16_t channel_set_mask(uint16_t mask, uint16_t values);
+uint16_t channel_toggle_mask(uint16_t mask);    // trả về trạng thái mới, không phải các kênh đã đổi
+
+// Phiên bản trạng thái: tăng mỗi khi có kênh đổi trạng thái
+uint32_t channel_version(void);
+uint16_t channel_snapshot(uint32_t *version);
+
+// Phân tích trạng thái mong muốn dạng bitmask hoặc JSON ({"mask":..,"state":..}, {"0":true,..})
+int channel_parse_state(const char *text, uint16_t *mask, uint16_t *values);
+
+// Con trỏ tới trạng thái kênh, dùng để gắn (bind) vào widget
+const volatile int *channel_state_ref(uint8_t ch);
+
+int channel_add_listener(channel_listener_t cb);
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef __SCENE_H__
+#define __SCENE_H__
+
+#include <stdint.h>
+#include <esp_err.h>
+
+// Tên scene dùng làm khoá NVS nên tối đa 15 ký tự
+#define SCENE_NAME_MAX      15
+
+// Hàm được gọi cho mỗi scene khi liệt kê
+typedef void (*scene_visit_t)(const char *name, uint16_t mask, uint16_t values, void *ctx);
+
+int scene_name_valid(const char *name);
+
+esp_err_t scene_save(const char *name, uint16_t mask, uint16_t values);
+esp_err_t scene_get(const char *name, uint16_t *mask, uint16_t *values);
+esp_err_t scene_delete(const char *name);
+esp_err_t scene_apply(const char *name, uint16_t *changed);
+
+int scene_foreach(scene_visit_t visit, void *ctx);
+
+#endif
@@ -0,0 +1,156 @@
+#include "scene.h"
+#include "channel.h"
+#include <string.h>
+#include <nvs.h>
+#include <esp_log.h>
+
+static const char *TAG = "Scene";
+
+// Mỗi scene là một giá trị u32 trong namespace riêng: (mask << 16) | values
+#define SCENE_NAMESPACE     "scenes"
+
+/// @brief Kiểm tra tên scene: 1..SCENE_NAME_MAX ký tự [A-Za-z0-9_-]
+/// @param name 
+/// @return 1 nếu hợp lệ
+int scene_name_valid(const char *name)
+{
+    size_t len;
+
+    if (name == NULL) {
+        return 0;
+    }
+    len = strlen(name);
+    if (len == 0 || len > SCENE_NAME_MAX) {
+        return 0;
+    }
+    for (size_t i = 0; i < len; i++) {
+        char c = name[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+              (c >= '0' && c <= '9') || c == '_' || c == '-')) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/// @brief Lưu (hoặc ghi đè) một scene vào NVS
+/// @param name tên scene
+/// @param mask các kênh scene điều khiển
+/// @param values trạng thái của các kênh trong mask
+/// @return ESP_OK, ESP_ERR_INVALID_ARG nếu tên sai, hoặc lỗi NVS
+esp_err_t scene_save(const char *name, uint16_t mask, uint16_t values)
+{
+    nvs_handle_t nvs;
+    esp_err_t err;
+
+    if (!scene_name_valid(name)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    err = nvs_open(SCENE_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_set_u32(nvs, name, ((uint32_t)mask << 16) | (values & mask));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save scene %s (%s)", name, esp_err_to_name(err));
+    }
+    return err;
+}
+
+esp_err_t scene_get(const char *name, uint16_t *mask, uint16_t *values)
+{
+    nvs_handle_t nvs;
+    uint32_t packed;
+    esp_err_t err;
+
+    if (!scene_name_valid(name)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    err = nvs_open(SCENE_NAMESPACE, NVS_READONLY, &nvs);
+    if (err != ESP_OK) {
+        // Namespace chưa tồn tại: chưa có scene nào được lưu
+        return err == ESP_ERR_NVS_NOT_FOUND ? ESP_ERR_NOT_FOUND : err;
+    }
+    err = nvs_get_u32(nvs, name, &packed);
+    nvs_close(nvs);
+
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+    *mask = packed >> 16;
+    *values = packed & 0xFFFF;
+    return ESP_OK;
+}
+
+esp_err_t scene_delete(const char *name)
+{
+    nvs_handle_t nvs;
+    esp_err_t err;
+
+    if (!scene_name_valid(name)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    err = nvs_open(SCENE_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_erase_key(nvs, name);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+    return err == ESP_ERR_NVS_NOT_FOUND ? ESP_ERR_NOT_FOUND : err;
+}
+
+/// @brief Áp dụng scene: mọi kênh của scene được đặt trong một bước
+/// @param name tên scene
+/// @param changed nhận bitmask các kênh đã đổi (có thể NULL)
+/// @return ESP_OK, ESP_ERR_NOT_FOUND nếu scene không tồn tại
+esp_err_t scene_apply(const char *name, uint16_t *changed)
+{
+    uint16_t mask, values, diff;
+    esp_err_t err = scene_get(name, &mask, &values);
+
+    if (err != ESP_OK) {
+        return err;
+    }
+    diff = channel_set_mask(mask, values);
+    ESP_LOGI(TAG, "Applied scene %s (changed 0x%04x)", name, diff);
+    if (changed != NULL) {
+        *changed = diff;
+    }
+    return ESP_OK;
+}
+
+/// @brief Liệt kê các scene đã lưu
+/// @param visit hàm được gọi cho mỗi scene
+/// @param ctx tham số truyền cho visit
+/// @return số scene đã liệt kê
+int scene_foreach(scene_visit_t visit, void *ctx)
+{
+    nvs_iterator_t it = NULL;
+    nvs_entry_info_t info;
+    uint16_t mask, values;
+    int count = 0;
+    esp_err_t err;
+
+    err = nvs_entry_find(NVS_DEFAULT_PART_NAME, SCENE_NAMESPACE, NVS_TYPE_U32, &it);
+    while (err == ESP_OK) {
+        nvs_entry_info(it, &info);
+        if (scene_get(info.key, &mask, &values) == ESP_OK) {
+            visit(info.key, mask, values, ctx);
+            count++;
+        }
+        err = nvs_entry_next(&it);
+    }
+    nvs_release_iterator(it);
+    return count;
+}
@@ -0,0 +1,439 @@
+#include "energy.h"
+#include <sdkconfig.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <nvs.h>
+#include <scheduler.h>
+#include <metrics.h>
+#include "energy_log.h"
+
+static const char *TAG = "Energy";
+
+#define ENERGY_NAMESPACE    "energy"
+#define ENERGY_CKPT_KEY     "ckpt"
+#define ENERGY_TICK_MS      (60 * 1000)
+
+typedef struct {
+    uint32_t start;
+    uint8_t on_s[CHANNEL_COUNT];        // tối đa 60
+} minute_bucket_t;
+
+typedef struct {
+    uint32_t start;
+    uint16_t on_s[CHANNEL_COUNT];       // tối đa 3600
+} hour_bucket_t;
+
+// Bản ghi NVS: ngày đang chạy và tổng tích luỹ
+typedef struct {
+    uint32_t day;                       // 0: chưa có ngày nào
+    uint32_t day_s[CHANNEL_COUNT];
+    uint32_t undated_s[CHANNEL_COUNT];  // bật khi đồng hồ chưa đặt, chờ biết ngày
+    uint64_t total_s[CHANNEL_COUNT];
+} energy_ckpt_t;
+
+// Phần listener kênh cập nhật (spinlock, có thể gọi từ bất kỳ task nào)
+static portMUX_TYPE energy_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint16_t on_mask;
+static int64_t on_since_us[CHANNEL_COUNT];  // lúc bật hoặc lúc tick trước, khi kênh đang bật
+static int64_t pending_us[CHANNEL_COUNT];   // thời gian bật chưa vào bucket phút
+
+// Phần task tick ghi và HTTP đọc (mutex)
+static SemaphoreHandle_t data_lock;
+static minute_bucket_t minutes[CONFIG_ENERGY_MINUTE_BUCKETS];
+static hour_bucket_t hours[CONFIG_ENERGY_HOUR_BUCKETS];
+// Số bucket đã đóng từ lúc khởi động; bucket n nằm ở n % kích thước vòng
+static uint32_t minute_total, hour_total;
+static hour_bucket_t hour_open;             // giờ đang chạy
+static uint16_t hour_minutes;
+static energy_ckpt_t state;
+static bool day_live;                       // state.day được theo dõi liên tục từ khi có giờ
+static uint16_t ckpt_minutes;
+
+static uint16_t watts[CHANNEL_COUNT];
+
+static metric_t log_bytes_metric = METRIC_GAUGE_INIT("smartlight_energy_log_bytes", NULL,
+                                                     "Bytes used in the energy flash log");
+
+/* Ngày theo lịch -> số ngày kể từ 1970-01-01 (days_from_civil) */
+static uint32_t day_number(const struct tm *tm)
+{
+    int y = tm->tm_year + 1900 - (tm->tm_mon < 2);
+    unsigned m = tm->tm_mon + 1;
+    unsigned era = y / 400;
+    unsigned yoe = y - era * 400;
+    unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + tm->tm_mday - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + doe - 719468;
+}
+
+/* Epoch của 0 giờ (giờ địa phương) ngày day */
+static uint32_t day_start(uint32_t day)
+{
+    time_t t = (time_t)day * 86400 + 43200;
+    struct tm tm;
+
+    gmtime_r(&t, &tm);
+    tm.tm_hour = 0;
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    tm.tm_isdst = -1;
+    return mktime(&tm);
+}
+
+static uint32_t epoch_day(uint32_t epoch)
+{
+    time_t t = epoch;
+    struct tm tm;
+
+    localtime_r(&t, &tm);
+    return day_number(&tm);
+}
+
+static void energy_on_change(uint8_t ch, int state)
+{
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&energy_lock);
+    if (state && !(on_mask & (1u << ch))) {
+        on_mask |= 1u << ch;
+        on_since_us[ch] = now;
+    } else if (!state && (on_mask & (1u << ch))) {
+        on_mask &= ~(1u << ch);
+        pending_us[ch] += now - on_since_us[ch];
+    }
+    portEXIT_CRITICAL(&energy_lock);
+}
+
+static void ckpt_save(const energy_ckpt_t *ckpt)
+{
+    nvs_handle_t nvs;
+    esp_err_t err;
+
+    err = nvs_open(ENERGY_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs, ENERGY_CKPT_KEY, ckpt, sizeof(*ckpt));
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Checkpoint failed: %s", esp_err_to_name(err));
+    }
+}
+
+static void ckpt_load(void)
+{
+    nvs_handle_t nvs;
+    size_t len = sizeof(state);
+
+    if (nvs_open(ENERGY_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return;
+    }
+    if (nvs_get_blob(nvs, ENERGY_CKPT_KEY, &state, &len) != ESP_OK || len != sizeof(state)) {
+        memset(&state, 0, sizeof(state));
+    }
+    nvs_close(nvs);
+}
+
+/* Mỗi phút: chuyển thời gian bật vào bucket phút, cộng dồn vào giờ, ngày và
+ * tổng. Hết giờ thì đẩy bucket giờ vào vòng RAM, hết ngày thì ghi ngày vào
+ * flash; ghi flash/NVS làm sau khi nhả khoá. Khi đồng hồ chưa đặt, thời gian
+ * bật chờ trong undated_s và được tính cho ngày đầu tiên biết được */
+static void energy_tick(void)
+{
+    uint8_t sec[CHANNEL_COUNT];
+    int64_t now = esp_timer_get_time();
+    time_t t = time(NULL);
+    bool valid = scheduler_time_valid();
+    uint32_t closed_day = 0, closed_s[CHANNEL_COUNT];
+    uint32_t hour_start = 0, today;
+    energy_ckpt_t ckpt;
+    bool save = false;
+    struct tm tm;
+
+    portENTER_CRITICAL(&energy_lock);
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        int64_t s;
+
+        if (on_mask & (1u << ch)) {
+            pending_us[ch] += now - on_since_us[ch];
+            on_since_us[ch] = now;
+        }
+        // Phần lẻ dưới một giây để lại cho phút sau
+        s = pending_us[ch] / 1000000;
+        s = s > UINT8_MAX ? UINT8_MAX : s;
+        pending_us[ch] -= s * 1000000;
+        sec[ch] = s;
+    }
+    portEXIT_CRITICAL(&energy_lock);
+
+    localtime_r(&t, &tm);
+    if (valid) {
+        hour_start = t - tm.tm_min * 60 - tm.tm_sec;
+    }
+
+    xSemaphoreTake(data_lock, portMAX_DELAY);
+    minutes[minute_total % CONFIG_ENERGY_MINUTE_BUCKETS].start = valid ? t - 60 : 0;
+    memcpy(minutes[minute_total % CONFIG_ENERGY_MINUTE_BUCKETS].on_s, sec, sizeof(sec));
+    minute_total++;
+
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        hour_open.on_s[ch] += sec[ch];
+        state.total_s[ch] += sec[ch];
+    }
+
+    // Phút vắt qua ranh giới giờ/ngày được tính cho giờ/ngày cũ
+    hour_minutes++;
+    if (valid && hour_open.start == 0 && hour_minutes == 1) {
+        // Bucket vừa mở mà đồng hồ đã đặt (khởi động lại): gắn giờ luôn
+        hour_open.start = hour_start;
+    }
+    if (valid ? hour_start != hour_open.start : hour_minutes >= 60) {
+        hours[hour_total % CONFIG_ENERGY_HOUR_BUCKETS] = hour_open;
+        hour_total++;
+        memset(&hour_open, 0, sizeof(hour_open));
+        hour_open.start = hour_start;
+        hour_minutes = 0;
+    }
+
+    if (!valid) {
+        // Chưa biết ngày: không cộng vào state.day, có thể là ngày của lần chạy trước
+        for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+            state.undated_s[ch] += sec[ch];
+        }
+    } else {
+        today = day_number(&tm);
+        if (day_live) {
+            // Phút vắt qua nửa đêm được tính cho ngày cũ, như với giờ
+            for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+                state.day_s[ch] += sec[ch];
+            }
+        }
+        if (state.day != today) {
+            if (state.day != 0) {
+                closed_day = state.day;
+                memcpy(closed_s, state.day_s, sizeof(closed_s));
+                memset(state.day_s, 0, sizeof(state.day_s));
+            }
+            state.day = today;
+            save = true;
+        }
+        if (!day_live) {
+            // Lần đầu có giờ sau khởi động: phần chờ và phút này thuộc hôm nay
+            for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+                state.day_s[ch] += state.undated_s[ch] + sec[ch];
+            }
+            memset(state.undated_s, 0, sizeof(state.undated_s));
+            day_live = true;
+        }
+    }
+    if (++ckpt_minutes >= CONFIG_ENERGY_CHECKPOINT_MIN) {
+        save = true;
+    }
+    if (save) {
+        ckpt_minutes = 0;
+        ckpt = state;
+    }
+    xSemaphoreGive(data_lock);
+
+    if (closed_day != 0) {
+        esp_err_t err = energy_log_append(closed_day, closed_s);
+
+        if (err != ESP_OK && err != ESP_ERR_NOT_FOUND) {
+            ESP_LOGW(TAG, "Day %lu not logged: %s", (unsigned long)closed_day, esp_err_to_name(err));
+        }
+    }
+    if (save) {
+        ckpt_save(&ckpt);
+    }
+}
+
+static void energy_task(void *arg)
+{
+    TickType_t last = xTaskGetTickCount();
+
+    while (1) {
+        vTaskDelayUntil(&last, pdMS_TO_TICKS(ENERGY_TICK_MS));
+        energy_tick();
+    }
+}
+
+static void energy_collect(void)
+{
+    uint32_t used, size;
+
+    energy_log_usage(&used, &size);
+    metric_set(&log_bytes_metric, used);
+}
+
+/// @brief Số liệu tích luỹ của một kênh (cập nhật mỗi phút)
+void energy_get(uint8_t ch, energy_channel_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (ch >= CHANNEL_COUNT) {
+        return;
+    }
+    xSemaphoreTake(data_lock, portMAX_DELAY);
+    out->on_s = state.total_s[ch];
+    out->today_s = state.day_s[ch] + state.undated_s[ch];
+    xSemaphoreGive(data_lock);
+    out->watts = watts[ch];
+    out->on = (on_mask >> ch) & 1;
+}
+
+typedef struct {
+    energy_visit_t visit;
+    void *ctx;
+} day_visit_t;
+
+static void day_visit(uint32_t day, const uint32_t on_s[CHANNEL_COUNT], void *ctx)
+{
+    day_visit_t *v = ctx;
+
+    v->visit(day_start(day), on_s, v->ctx);
+}
+
+static bool in_range(uint32_t start, uint32_t from, uint32_t to)
+{
+    return start == 0 ? from == 0 : start >= from && start <= to;
+}
+
+/* Chép bucket thứ *n của vòng phút/giờ (giờ: sau các bucket đã đóng là giờ
+ * đang chạy), bỏ qua các bucket đã bị ghi đè. Gọi khi giữ data_lock */
+static bool bucket_copy(energy_step_t step, uint32_t *n, uint32_t *start, uint32_t on_s[CHANNEL_COUNT])
+{
+    if (step == ENERGY_MINUTE) {
+        const minute_bucket_t *b;
+
+        if (minute_total > CONFIG_ENERGY_MINUTE_BUCKETS && *n < minute_total - CONFIG_ENERGY_MINUTE_BUCKETS) {
+            *n = minute_total - CONFIG_ENERGY_MINUTE_BUCKETS;
+        }
+        if (*n >= minute_total) {
+            return false;
+        }
+        b = &minutes[*n % CONFIG_ENERGY_MINUTE_BUCKETS];
+        *start = b->start;
+        for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+            on_s[ch] = b->on_s[ch];
+        }
+    } else {
+        const hour_bucket_t *b;
+
+        if (hour_total > CONFIG_ENERGY_HOUR_BUCKETS && *n < hour_total - CONFIG_ENERGY_HOUR_BUCKETS) {
+            *n = hour_total - CONFIG_ENERGY_HOUR_BUCKETS;
+        }
+        if (*n > hour_total) {
+            return false;
+        }
+        b = *n < hour_total ? &hours[*n % CONFIG_ENERGY_HOUR_BUCKETS] : &hour_open;
+        *start = b->start;
+        for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+            on_s[ch] = b->on_s[ch];
+        }
+    }
+    return true;
+}
+
+/// @brief Duyệt chuỗi thời gian bật theo bucket, từ cũ đến mới
+/// @param step ENERGY_MINUTE, ENERGY_HOUR hoặc ENERGY_DAY
+/// @param from, to khoảng epoch của đầu bucket
+/// @param visit gọi ngoài khoá (có thể gửi dữ liệu mạng)
+/// @return số bucket đã duyệt
+int energy_series(energy_step_t step, uint32_t from, uint32_t to, energy_visit_t visit, void *ctx)
+{
+    uint32_t on_s[CHANNEL_COUNT], undated_s[CHANNEL_COUNT];
+    uint32_t start, day, undated = 0;
+    int count = 0;
+    bool found;
+
+    if (step == ENERGY_DAY) {
+        day_visit_t dv = { visit, ctx };
+
+        count = energy_log_foreach(from ? epoch_day(from) : 0, epoch_day(to), day_visit, &dv);
+
+        xSemaphoreTake(data_lock, portMAX_DELAY);
+        day = state.day;
+        memcpy(on_s, state.day_s, sizeof(on_s));
+        memcpy(undated_s, state.undated_s, sizeof(undated_s));
+        xSemaphoreGive(data_lock);
+
+        // Ngày đang chạy, rồi thời gian bật chưa biết ngày (từ khi khởi động tới lúc có SNTP)
+        if (day != 0 && in_range(day_start(day), from, to)) {
+            visit(day_start(day), on_s, ctx);
+            count++;
+        }
+        for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+            undated |= undated_s[ch];
+        }
+        if (undated != 0 && from == 0) {
+            visit(0, undated_s, ctx);
+            count++;
+        }
+        return count;
+    }
+
+    // Mỗi lần khoá chỉ chép một bucket, như scheduler_foreach
+    for (uint32_t n = 0;; n++) {
+        xSemaphoreTake(data_lock, portMAX_DELAY);
+        found = bucket_copy(step, &n, &start, on_s);
+        xSemaphoreGive(data_lock);
+        if (!found) {
+            break;
+        }
+        if (in_range(start, from, to)) {
+            visit(start, on_s, ctx);
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @func	energy_init
+ * @brief	Nạp số liệu đã lưu và bắt đầu đếm. Gọi sau wifi_init (cần NVS)
+ * @param	None
+ * @retval  None
+*/
+void energy_init(void)
+{
+    const char *p = CONFIG_ENERGY_CHANNEL_WATTS;
+    int64_t now = esp_timer_get_time();
+    uint16_t bits;
+
+    for (int ch = 0; ch < CHANNEL_COUNT && *p; ch++) {
+        char *end;
+
+        watts[ch] = strtoul(p, &end, 10);
+        p = *end == ',' ? end + 1 : end;
+    }
+
+    data_lock = xSemaphoreCreateMutex();
+    ckpt_load();
+    if (energy_log_init() != ESP_OK) {
+        ESP_LOGW(TAG, "No \"energy\" partition, daily history is not kept");
+    }
+
+    // Kênh đang bật lúc khởi động được tính từ bây giờ
+    channel_add_listener(energy_on_change);
+    bits = channel_get_mask();
+    portENTER_CRITICAL(&energy_lock);
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        if ((bits & (1u << ch)) && !(on_mask & (1u << ch))) {
+            on_mask |= 1u << ch;
+            on_since_us[ch] = now;
+        }
+    }
+    portEXIT_CRITICAL(&energy_lock);
+
+    xTaskCreate(energy_task, "energy", 3072, NULL, CONFIG_ENERGY_TASK_PRIORITY, NULL);
+    metrics_register(&log_bytes_metric);
+    metrics_add_collector(energy_collect);
+}
@@ -0,0 +1,330 @@
+#include <string.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <esp_log.h>
+#include <esp_partition.h>
+#include "energy_log.h"
+
+static const char *TAG = "EnergyLog";
+
+#define LOG_LABEL           "energy"
+#define LOG_SUBTYPE         0x40
+#define LOG_SECTOR          4096
+#define LOG_MAGIC           0x314C4E45      // "ENL1"
+#define LOG_HEAD            8
+// Trường hợp xấu nhất: len + ngày (5) + mask (2) + 16 kênh × 5 + crc = 89.
+// Một ngày thường có hiệu ≤ 86400 s (3 byte), nhưng ngày đầu tiên có giờ còn
+// gồm cả thời gian chạy chưa có SNTP (undated_s), không giới hạn
+#define LOG_RECORD_MAX      (1 + 5 + 2 + CHANNEL_COUNT * 5 + 1)
+
+// Giá trị của bản ghi trước trong sector, gốc để tính hiệu
+typedef struct {
+    uint32_t day;
+    uint32_t on_s[CHANNEL_COUNT];
+} log_state_t;
+
+static const esp_partition_t *part;
+static SemaphoreHandle_t log_lock;
+static uint32_t sector_count;
+// Sector của seq s là (s - 1) % sector_count, nên thứ tự các sector suy ra từ seq
+static uint32_t cur_seq;            // 0: chưa có sector nào
+static uint32_t cur_offset;
+static log_state_t cur_state;
+static uint32_t last_day;
+
+/* CRC-8 đa thức 0x07, đủ để nhận ra bản ghi bị ghi dở khi mất điện */
+static uint8_t crc8(const uint8_t *p, size_t n)
+{
+    uint8_t crc = 0;
+
+    while (n--) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; i++) {
+            crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint8_t *put_varint(uint8_t *p, uint32_t v)
+{
+    while (v >= 0x80) {
+        *p++ = v | 0x80;
+        v >>= 7;
+    }
+    *p++ = v;
+    return p;
+}
+
+/* Đọc một varint trong [p, end), trả về số byte đã đọc hoặc -1 */
+static int get_varint(const uint8_t *p, const uint8_t *end, uint32_t *v)
+{
+    *v = 0;
+    for (int i = 0; i < 5 && p + i < end; i++) {
+        *v |= (uint32_t)(p[i] & 0x7F) << (7 * i);
+        if (!(p[i] & 0x80)) {
+            return i + 1;
+        }
+    }
+    return -1;
+}
+
+/* Mã hoá một ngày so với prev vào buf, trả về độ dài cả bản ghi */
+static size_t record_encode(uint8_t *buf, const log_state_t *prev, uint32_t day, const uint32_t on_s[CHANNEL_COUNT])
+{
+    uint8_t *p = buf + 1;
+    uint16_t mask = 0;
+
+    p = put_varint(p, day - prev->day);
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        if (on_s[ch] != prev->on_s[ch]) {
+            mask |= 1u << ch;
+        }
+    }
+    *p++ = mask;
+    *p++ = mask >> 8;
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        if (mask & (1u << ch)) {
+            int32_t d = (int32_t)(on_s[ch] - prev->on_s[ch]);
+
+            p = put_varint(p, ((uint32_t)d << 1) ^ (uint32_t)(d >> 31));
+        }
+    }
+    *p = crc8(buf + 1, p - (buf + 1));
+    p++;
+    buf[0] = p - buf - 1;
+    return p - buf;
+}
+
+/* Giải mã len byte sau byte độ dài, cập nhật state. Trả về 0 nếu hợp lệ */
+static int record_decode(const uint8_t *rec, uint8_t len, log_state_t *state)
+{
+    const uint8_t *p = rec, *end = rec + len - 1;
+    log_state_t next = *state;
+    uint16_t mask;
+    uint32_t v;
+    int n;
+
+    if (len < 4 || crc8(rec, len - 1) != rec[len - 1]) {
+        return -1;
+    }
+    n = get_varint(p, end, &v);
+    if (n < 0 || end - (p + n) < 2) {
+        return -1;
+    }
+    next.day += v;
+    p += n;
+    mask = p[0] | p[1] << 8;
+    p += 2;
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        if (!(mask & (1u << ch))) {
+            continue;
+        }
+        n = get_varint(p, end, &v);
+        if (n < 0) {
+            return -1;
+        }
+        p += n;
+        next.on_s[ch] += (v >> 1) ^ -(v & 1);
+    }
+    if (p != end) {
+        return -1;
+    }
+    *state = next;
+    return 0;
+}
+
+/* Đọc bản ghi tại *offset của sector: 1 nếu hợp lệ (offset tiến lên), 0 khi hết,
+ * -1 khi hỏng (ghi dở lúc mất điện) */
+static int record_read(uint32_t sector, uint32_t *offset, log_state_t *state)
+{
+    uint8_t rec[LOG_RECORD_MAX];
+    uint32_t base = sector * LOG_SECTOR;
+
+    if (*offset >= LOG_SECTOR) {
+        return 0;
+    }
+    if (esp_partition_read(part, base + *offset, rec, 1) != ESP_OK) {
+        return -1;
+    }
+    if (rec[0] == 0xFF) {
+        return 0;
+    }
+    if (rec[0] == 0 || rec[0] >= LOG_RECORD_MAX || *offset + 1 + rec[0] > LOG_SECTOR ||
+        esp_partition_read(part, base + *offset + 1, rec + 1, rec[0]) != ESP_OK ||
+        record_decode(rec + 1, rec[0], state) != 0) {
+        return -1;
+    }
+    *offset += 1 + rec[0];
+    return 1;
+}
+
+/* Sector của seq có header đúng không */
+static bool sector_valid(uint32_t seq)
+{
+    uint32_t head[2];
+
+    return esp_partition_read(part, (seq - 1) % sector_count * LOG_SECTOR, head, sizeof(head)) == ESP_OK &&
+           head[0] == LOG_MAGIC && head[1] == seq;
+}
+
+/* Mở sector kế tiếp, xoá dữ liệu cũ nhất khi vòng đã đầy */
+static esp_err_t sector_open_next(void)
+{
+    uint32_t head[2] = { LOG_MAGIC, cur_seq + 1 };
+    uint32_t base = cur_seq % sector_count * LOG_SECTOR;
+    esp_err_t err;
+
+    err = esp_partition_erase_range(part, base, LOG_SECTOR);
+    if (err == ESP_OK) {
+        err = esp_partition_write(part, base, head, sizeof(head));
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Cannot start sector %lu: %s", (unsigned long)(base / LOG_SECTOR), esp_err_to_name(err));
+        return err;
+    }
+    cur_seq++;
+    cur_offset = LOG_HEAD;
+    memset(&cur_state, 0, sizeof(cur_state));
+    return ESP_OK;
+}
+
+/// @brief Tìm partition và vị trí ghi tiếp theo
+/// @return ESP_ERR_NOT_FOUND nếu không có partition "energy"
+esp_err_t energy_log_init(void)
+{
+    uint32_t head[2];
+    int r;
+
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)LOG_SUBTYPE, LOG_LABEL);
+    if (part == NULL || part->size < 2 * LOG_SECTOR) {
+        part = NULL;
+        return ESP_ERR_NOT_FOUND;
+    }
+    sector_count = part->size / LOG_SECTOR;
+    log_lock = xSemaphoreCreateMutex();
+
+    // Sector mới nhất: seq lớn nhất nằm đúng chỗ của nó
+    for (uint32_t i = 0; i < sector_count; i++) {
+        if (esp_partition_read(part, i * LOG_SECTOR, head, sizeof(head)) == ESP_OK &&
+            head[0] == LOG_MAGIC && head[1] > cur_seq && (head[1] - 1) % sector_count == i) {
+            cur_seq = head[1];
+        }
+    }
+    if (cur_seq == 0) {
+        ESP_LOGI(TAG, "New log, %lu sectors", (unsigned long)sector_count);
+        return sector_open_next();
+    }
+
+    cur_offset = LOG_HEAD;
+    while ((r = record_read((cur_seq - 1) % sector_count, &cur_offset, &cur_state)) == 1) {
+    }
+    last_day = cur_state.day;
+    if (r < 0) {
+        // Không ghi tiếp sau một bản ghi hỏng: các bản ghi sau sẽ giải mã sai
+        ESP_LOGW(TAG, "Torn record in sector %lu, starting a new one", (unsigned long)((cur_seq - 1) % sector_count));
+        return sector_open_next();
+    }
+    ESP_LOGI(TAG, "Sector seq %lu, %lu bytes used, last day %lu", (unsigned long)cur_seq,
+             (unsigned long)cur_offset, (unsigned long)last_day);
+    return ESP_OK;
+}
+
+/// @brief Thêm tổng số giây bật của một ngày
+/// @param day số ngày kể từ 1970-01-01, lớn hơn ngày đã ghi trước đó
+/// @param on_s số giây bật của từng kênh trong ngày
+esp_err_t energy_log_append(uint32_t day, const uint32_t on_s[CHANNEL_COUNT])
+{
+    uint8_t rec[LOG_RECORD_MAX];
+    esp_err_t err = ESP_OK;
+    size_t n;
+
+    if (part == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (day <= last_day) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    xSemaphoreTake(log_lock, portMAX_DELAY);
+    n = record_encode(rec, &cur_state, day, on_s);
+    if (cur_offset + n > LOG_SECTOR) {
+        err = sector_open_next();
+        n = record_encode(rec, &cur_state, day, on_s);
+    }
+    if (err == ESP_OK) {
+        err = esp_partition_write(part, (cur_seq - 1) % sector_count * LOG_SECTOR + cur_offset, rec, n);
+    }
+    if (err == ESP_OK) {
+        cur_offset += n;
+        cur_state.day = day;
+        memcpy(cur_state.on_s, on_s, sizeof(cur_state.on_s));
+        last_day = day;
+    } else {
+        // Bản ghi có thể đã ghi dở: lần sau sang sector mới
+        cur_offset = LOG_SECTOR;
+    }
+    xSemaphoreGive(log_lock);
+    return err;
+}
+
+/* Bản ghi kế tiếp sau vị trí (*seq, *offset), sang sector sau khi hết sector;
+ * offset 0 là đầu sector. Gọi khi giữ log_lock. Trả về 1 nếu có, 0 khi hết log */
+static int log_next(uint32_t *seq, uint32_t *offset, log_state_t *state)
+{
+    uint32_t oldest = cur_seq > sector_count ? cur_seq - sector_count + 1 : 1;
+
+    if (*seq < oldest) {
+        // Sector đang đọc đã bị xoá để ghi tiếp: đọc từ sector cũ nhất còn lại
+        *seq = oldest;
+        *offset = 0;
+    }
+    for (; *seq <= cur_seq; (*seq)++, *offset = 0) {
+        if (*offset == 0) {
+            if (!sector_valid(*seq)) {
+                continue;
+            }
+            memset(state, 0, sizeof(*state));
+            *offset = LOG_HEAD;
+        }
+        if (record_read((*seq - 1) % sector_count, offset, state) == 1) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/// @brief Duyệt các ngày trong [from, to], từ cũ đến mới
+/// @param visit gọi ngoài khoá (có thể gửi dữ liệu mạng), không chặn energy_log_append
+/// @return số ngày đã duyệt
+int energy_log_foreach(uint32_t from, uint32_t to, energy_log_visit_t visit, void *ctx)
+{
+    log_state_t state;
+    uint32_t seq = 0, offset = 0;
+    int count = 0, found;
+
+    if (part == NULL) {
+        return 0;
+    }
+    for (;;) {
+        // Mỗi lần khoá chỉ đọc một bản ghi
+        xSemaphoreTake(log_lock, portMAX_DELAY);
+        found = log_next(&seq, &offset, &state);
+        xSemaphoreGive(log_lock);
+        if (!found || state.day > to) {
+            break;
+        }
+        if (state.day >= from) {
+            visit(state.day, state.on_s, ctx);
+            count++;
+        }
+    }
+    return count;
+}
+
+void energy_log_usage(uint32_t *used, uint32_t *size)
+{
+    uint32_t sectors = cur_seq < sector_count ? cur_seq : sector_count;
+
+    *size = sector_count * LOG_SECTOR;
+    *used = sectors > 0 ? (sectors - 1) * LOG_SECTOR + (cur_offset < LOG_SECTOR ? cur_offset : LOG_SECTOR) : 0;
+}
@@ -0,0 +1,43 @@
+#ifndef __ENERGY_H__
+#define __ENERGY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <channel.h>
+
+/*
+ * Thời gian bật của từng kênh, gom theo bucket:
+ *   phút   RAM, CONFIG_ENERGY_MINUTE_BUCKETS bucket gần nhất
+ *   giờ    RAM, CONFIG_ENERGY_HOUR_BUCKETS bucket gần nhất (+ giờ đang chạy)
+ *   ngày   flash (energy_log.h), mỗi ngày một bản ghi (+ ngày đang chạy)
+ * Ngày đang chạy và tổng tích luỹ được lưu NVS mỗi CONFIG_ENERGY_CHECKPOINT_MIN
+ * phút. Điện năng = thời gian bật × công suất danh định (CONFIG_ENERGY_CHANNEL_WATTS).
+ */
+
+typedef enum {
+    ENERGY_MINUTE,
+    ENERGY_HOUR,
+    ENERGY_DAY,
+} energy_step_t;
+
+typedef struct {
+    uint64_t on_s;          // tổng số giây bật từ lần chạy đầu tiên
+    uint32_t today_s;       // số giây bật trong ngày đang chạy
+    uint16_t watts;         // công suất danh định
+    bool on;
+} energy_channel_t;
+
+// Hàm được gọi cho mỗi bucket, từ cũ đến mới. start: epoch đầu bucket,
+// 0 nếu bucket được ghi trước khi đồng hồ được SNTP đặt
+typedef void (*energy_visit_t)(uint32_t start, const uint32_t on_s[CHANNEL_COUNT], void *ctx);
+
+void energy_init(void);
+
+void energy_get(uint8_t ch, energy_channel_t *out);
+
+// Duyệt các bucket có start trong [from, to]; from = 0 lấy cả bucket chưa có giờ
+// (với ENERGY_DAY: thời gian bật từ lúc khởi động tới khi có SNTP, chưa gắn ngày).
+// visit được gọi ngoài khoá nên có thể chậm (gửi HTTP) mà không chặn việc đếm
+int energy_series(energy_step_t step, uint32_t from, uint32_t to, energy_visit_t visit, void *ctx);
+
+#endif
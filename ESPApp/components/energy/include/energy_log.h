@@ -0,0 +1,33 @@
+#ifndef __ENERGY_LOG_H__
+#define __ENERGY_LOG_H__
+
+#include <stdint.h>
+#include <esp_err.h>
+#include <channel.h>
+
+/*
+ * Nhật ký theo ngày trong partition "energy" (data, subtype 0x40): vòng các
+ * sector 4 KB, sector đầy thì xoá sector cũ nhất. Mỗi sector:
+ *   u32 magic, u32 seq, rồi các bản ghi nối tiếp:
+ *   u8 len | varint ngày | u16 mask | varint zigzag × số bit của mask | u8 crc8
+ * Ngày và số giây bật của mỗi kênh được ghi dưới dạng hiệu so với bản ghi
+ * trước trong cùng sector (bản ghi đầu so với 0), mask là các kênh có số giây
+ * khác ngày trước. Lịch bật đèn lặp lại hằng ngày nên một ngày thường chỉ tốn
+ * vài byte: 64 KB đủ cho nhiều năm với 16 kênh.
+ */
+
+// Ngày: số ngày (giờ địa phương) kể từ 1970-01-01
+typedef void (*energy_log_visit_t)(uint32_t day, const uint32_t on_s[CHANNEL_COUNT], void *ctx);
+
+esp_err_t energy_log_init(void);
+
+// Thêm tổng số giây bật của một ngày; ngày phải tăng dần
+esp_err_t energy_log_append(uint32_t day, const uint32_t on_s[CHANNEL_COUNT]);
+
+// Duyệt các ngày trong [from, to] từ cũ đến mới, trả về số ngày đã duyệt
+int energy_log_foreach(uint32_t from, uint32_t to, energy_log_visit_t visit, void *ctx);
+
+// Dung lượng đã dùng và tổng dung lượng (byte) để báo cáo
+void energy_log_usage(uint32_t *used, uint32_t *size);
+
+#endif
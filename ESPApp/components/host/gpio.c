@@ -0,0 +1,153 @@
+#include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "host.h"
+
+// Trạng thái giả lập của một chân
+typedef struct {
+    uint8_t level;
+    uint8_t mode;
+    uint8_t intr;
+    gpio_isr_t isr;
+    void *arg;
+} host_pin_t;
+
+static host_pin_t pins[GPIO_NUM_MAX];
+
+static host_pin_t *host_pin(gpio_num_t gpio_num)
+{
+    return (gpio_num >= 0 && gpio_num < GPIO_NUM_MAX) ? &pins[gpio_num] : NULL;
+}
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    for (int i = 0; i < GPIO_NUM_MAX; i++) {
+        if (config->pin_bit_mask & (1ULL << i)) {
+            pins[i].mode = config->mode;
+            pins[i].intr = config->intr_type;
+            pins[i].level = config->pull_up_en ? 1 : 0;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+    host_pin_t *p = host_pin(gpio_num);
+
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // Như trên chip: input, có pull-up
+    p->mode = GPIO_MODE_INPUT;
+    p->intr = GPIO_INTR_DISABLE;
+    p->level = 1;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+    host_pin_t *p = host_pin(gpio_num);
+
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->mode = mode;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_pull_mode(gpio_num_t gpio_num, gpio_pull_mode_t pull)
+{
+    host_pin_t *p = host_pin(gpio_num);
+
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (p->mode == GPIO_MODE_INPUT) {
+        p->level = (pull == GPIO_PULLUP_ONLY || pull == GPIO_PULLUP_PULLDOWN);
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type)
+{
+    host_pin_t *p = host_pin(gpio_num);
+
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->intr = intr_type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    host_pin_t *p = host_pin(gpio_num);
+
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->level = level ? 1 : 0;
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    host_pin_t *p = host_pin(gpio_num);
+
+    return p != NULL ? p->level : 0;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args)
+{
+    host_pin_t *p = host_pin(gpio_num);
+
+    if (p == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->isr = isr_handler;
+    p->arg = args;
+    return ESP_OK;
+}
+
+/// @brief Đặt mức một chân input và gọi ISR nếu khớp cạnh ngắt
+/// @param gpio_num chân
+/// @param level mức mới
+void host_gpio_inject(gpio_num_t gpio_num, int level)
+{
+    host_pin_t *p = host_pin(gpio_num);
+    int old, fire;
+
+    if (p == NULL) {
+        return;
+    }
+    old = p->level;
+    p->level = level ? 1 : 0;
+
+    switch (p->intr) {
+        case GPIO_INTR_POSEDGE:     fire = !old && p->level; break;
+        case GPIO_INTR_NEGEDGE:     fire = old && !p->level; break;
+        case GPIO_INTR_ANYEDGE:     fire = old != p->level; break;
+        case GPIO_INTR_LOW_LEVEL:   fire = !p->level; break;
+        case GPIO_INTR_HIGH_LEVEL:  fire = p->level; break;
+        default:                    fire = 0; break;
+    }
+    if (fire && p->isr != NULL) {
+        p->isr(p->arg);
+    }
+}
+
+/// @brief Nhấn rồi nhả một nút active low
+/// @param gpio_num chân của nút
+/// @param hold_ms thời gian giữ (lớn hơn thời gian chống dội của button.c)
+void host_gpio_press(gpio_num_t gpio_num, uint32_t hold_ms)
+{
+    host_gpio_inject(gpio_num, 0);
+    vTaskDelay(pdMS_TO_TICKS(hold_ms));
+    host_gpio_inject(gpio_num, 1);
+}
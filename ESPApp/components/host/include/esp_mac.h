@@ -0,0 +1,19 @@
+#ifndef __HOST_ESP_MAC_H__
+#define __HOST_ESP_MAC_H__
+
+// esp_mac.h cho bản build Linux (esp_hw_support không có trên Linux): MAC giả
+// lập, cố định theo tiến trình để tên thiết bị không đổi trong một lần chạy
+
+#include <stdint.h>
+#include <esp_err.h>
+
+typedef enum {
+    ESP_MAC_WIFI_STA,
+    ESP_MAC_WIFI_SOFTAP,
+    ESP_MAC_BT,
+    ESP_MAC_ETH,
+} esp_mac_type_t;
+
+esp_err_t esp_read_mac(uint8_t *mac, esp_mac_type_t type);
+
+#endif
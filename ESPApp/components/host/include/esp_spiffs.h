@@ -0,0 +1,20 @@
+#ifndef __HOST_ESP_SPIFFS_H__
+#define __HOST_ESP_SPIFFS_H__
+
+// Bản build Linux không có VFS: "SPIFFS" là thư mục CONFIG_HOST_SPIFFS_DIR
+// trên máy (SPIFFS_BASE_PATH trong webserver.h trỏ vào đó)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <esp_err.h>
+
+typedef struct {
+    const char *base_path;
+    const char *partition_label;
+    size_t max_files;
+    bool format_if_mount_failed;
+} esp_vfs_spiffs_conf_t;
+
+esp_err_t esp_vfs_spiffs_register(const esp_vfs_spiffs_conf_t *conf);
+
+#endif
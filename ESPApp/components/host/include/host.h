@@ -0,0 +1,18 @@
+#ifndef __HOST_H__
+#define __HOST_H__
+
+// Điều khiển phần cứng giả lập của bản build Linux (benchmark, kiểm thử).
+// Số liệu bus SPI giả lập nằm trong /metrics (smartlight_host_spi_*)
+
+#include <stdint.h>
+#include <driver/gpio.h>
+
+// Đặt mức một chân input; gọi ISR đã đăng ký nếu khớp cạnh ngắt.
+// Gọi từ một task FreeRTOS, như một ngắt thật trên lõi đang chạy task đó
+void host_gpio_inject(gpio_num_t gpio_num, int level);
+
+// Nhấn rồi nhả một nút nối GND (active low), giữ hold_ms.
+// Web server gọi nó cho POST /host/press (chỉ bản build Linux)
+void host_gpio_press(gpio_num_t gpio_num, uint32_t hold_ms);
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef __HOST_SPI_PERIPH_H__
+#define __HOST_SPI_PERIPH_H__
+
+// lcd.c chỉ cần các kiểu của driver SPI
+#include <driver/spi_master.h>
+
+#endif
@@ -0,0 +1,21 @@
+#include <string.h>
+#include <unistd.h>
+#include <esp_mac.h>
+
+/* MAC quản lý cục bộ 02:00:xx:xx:xx:yy: xx là PID nên nhiều tiến trình trên
+ * cùng máy có tên khác nhau, yy là loại interface như các MAC liên tiếp trên chip */
+esp_err_t esp_read_mac(uint8_t *mac, esp_mac_type_t type)
+{
+    uint32_t pid = (uint32_t)getpid();
+
+    if (mac == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    mac[0] = 0x02;
+    mac[1] = 0x00;
+    mac[2] = pid >> 16;
+    mac[3] = pid >> 8;
+    mac[4] = pid;
+    mac[5] = type;
+    return ESP_OK;
+}
@@ -0,0 +1,157 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sdkconfig.h>
+#include <driver/spi_master.h>
+#include <freertos/FreeRTOS.h>
+#include <metrics.h>
+
+struct spi_device_t {
+    int clock_speed_hz;
+    // Giao dịch đã xong nhưng chưa lấy kết quả, theo thứ tự xếp hàng như
+    // trên thiết bị; sâu queue_size như hàng đợi của driver thật
+    spi_transaction_t **done;
+    int queue_size;
+    int head;
+    int count;
+};
+
+// Số liệu bus SPI giả lập, xuất qua /metrics để benchmark đọc
+static struct {
+    uint32_t transactions;
+    uint64_t bytes;
+    uint64_t busy_us;       // thời gian bus bận theo CONFIG_HOST_SPI_BUS_HZ
+} stats;
+// Thời gian bus chưa "chờ" xong; gộp lại vì usleep dưới 1 ms không chính xác
+static uint64_t pending_us;
+static portMUX_TYPE spi_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static metric_t transactions_metric = METRIC_COUNTER_INIT("smartlight_host_spi_transactions_total", NULL,
+                                                          "Simulated SPI transactions");
+static metric_t bytes_metric = METRIC_COUNTER_INIT("smartlight_host_spi_bytes_total", NULL,
+                                                   "Bytes sent on the simulated SPI bus");
+static metric_t busy_metric = METRIC_COUNTER_INIT("smartlight_host_spi_busy_ms_total", NULL,
+                                                  "Wire time of the simulated SPI bus at HOST_SPI_BUS_HZ");
+
+static void spi_collect(void)
+{
+    portENTER_CRITICAL(&spi_lock);
+    metric_set(&transactions_metric, stats.transactions);
+    metric_set(&bytes_metric, (int32_t)stats.bytes);
+    metric_set(&busy_metric, stats.busy_us / 1000);
+    portEXIT_CRITICAL(&spi_lock);
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *bus_config, int dma_chan)
+{
+    metrics_register(&transactions_metric);
+    metrics_register(&bytes_metric);
+    metrics_register(&busy_metric);
+    metrics_add_collector(spi_collect);
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *dev_config,
+                             spi_device_handle_t *handle)
+{
+    spi_device_handle_t dev = calloc(1, sizeof(*dev));
+
+    if (dev == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    dev->queue_size = dev_config->queue_size > 0 ? dev_config->queue_size : 1;
+    dev->done = calloc(dev->queue_size, sizeof(*dev->done));
+    if (dev->done == NULL) {
+        free(dev);
+        return ESP_ERR_NO_MEM;
+    }
+    dev->clock_speed_hz = dev_config->clock_speed_hz;
+    *handle = dev;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle)
+{
+    free(handle->done);
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+    size_t bits = trans->length > trans->rxlength ? trans->length : trans->rxlength;
+    uint64_t wait = 0;
+
+    // Không có panel thật: đọc về toàn 0
+    if (trans->flags & SPI_TRANS_USE_RXDATA) {
+        memset(trans->rx_data, 0, sizeof(trans->rx_data));
+    } else if (trans->rx_buffer != NULL) {
+        memset(trans->rx_buffer, 0, (trans->rxlength ? trans->rxlength : trans->length) / 8);
+    }
+
+    portENTER_CRITICAL(&spi_lock);
+    stats.transactions++;
+    stats.bytes += (bits + 7) / 8;
+#if CONFIG_HOST_SPI_BUS_HZ > 0
+    stats.busy_us += (uint64_t)bits * 1000000 / CONFIG_HOST_SPI_BUS_HZ;
+    pending_us += (uint64_t)bits * 1000000 / CONFIG_HOST_SPI_BUS_HZ;
+    if (pending_us >= 1000) {
+        wait = pending_us;
+        pending_us = 0;
+    }
+#endif
+    portEXIT_CRITICAL(&spi_lock);
+
+    if (wait > 0) {
+        usleep(wait);
+    }
+    return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+    return spi_device_transmit(handle, trans);
+}
+
+/* Giao dịch được thực hiện ngay khi xếp hàng, kết quả chờ trong FIFO của thiết bị.
+ * Hàng đợi đầy (chưa lấy kết quả đủ) thì báo timeout thay vì chờ mãi */
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans, TickType_t ticks)
+{
+    bool full;
+
+    portENTER_CRITICAL(&spi_lock);
+    full = handle->count == handle->queue_size;
+    portEXIT_CRITICAL(&spi_lock);
+    if (full) {
+        return ESP_ERR_TIMEOUT;
+    }
+    spi_device_transmit(handle, trans);
+
+    portENTER_CRITICAL(&spi_lock);
+    handle->done[(handle->head + handle->count) % handle->queue_size] = trans;
+    handle->count++;
+    portEXIT_CRITICAL(&spi_lock);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans, TickType_t ticks)
+{
+    esp_err_t err = ESP_ERR_TIMEOUT;
+
+    portENTER_CRITICAL(&spi_lock);
+    if (handle->count > 0) {
+        *trans = handle->done[handle->head];
+        handle->head = (handle->head + 1) % handle->queue_size;
+        handle->count--;
+        err = ESP_OK;
+    }
+    portEXIT_CRITICAL(&spi_lock);
+    return err;
+}
+
+esp_err_t spi_device_get_actual_freq(spi_device_handle_t handle, int *freq_khz)
+{
+    *freq_khz = (CONFIG_HOST_SPI_BUS_HZ > 0 ? CONFIG_HOST_SPI_BUS_HZ : handle->clock_speed_hz) / 1000;
+    return ESP_OK;
+}
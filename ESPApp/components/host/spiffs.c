@@ -0,0 +1,19 @@
+#include <sys/stat.h>
+#include <sdkconfig.h>
+#include <esp_spiffs.h>
+#include <esp_log.h>
+
+static const char *TAG = "HostSPIFFS";
+
+/* Không mount gì: chỉ kiểm tra thư mục thay thế cho SPIFFS */
+esp_err_t esp_vfs_spiffs_register(const esp_vfs_spiffs_conf_t *conf)
+{
+    struct stat st;
+
+    if (stat(CONFIG_HOST_SPIFFS_DIR, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        ESP_LOGE(TAG, "Directory %s not found (run from ESPApp/ or set HOST_SPIFFS_DIR)", CONFIG_HOST_SPIFFS_DIR);
+        return ESP_ERR_NOT_FOUND;
+    }
+    ESP_LOGI(TAG, "%s -> %s", conf->base_path, CONFIG_HOST_SPIFFS_DIR);
+    return ESP_OK;
+}
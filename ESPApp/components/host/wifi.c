@@ -0,0 +1,54 @@
+#include <esp_wifi.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+
+static const char *TAG = "HostWiFi";
+
+ESP_EVENT_DEFINE_BASE(WIFI_EVENT);
+
+esp_netif_t *esp_netif_create_default_wifi_sta(void)
+{
+    return NULL;
+}
+
+esp_err_t esp_wifi_init(const wifi_init_config_t *config)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_config(wifi_interface_t interface, wifi_config_t *conf)
+{
+    ESP_LOGI(TAG, "SSID \"%s\" ignored, using the host network", (const char *)conf->sta.ssid);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_start(void)
+{
+    return esp_event_post(WIFI_EVENT, WIFI_EVENT_STA_START, NULL, 0, portMAX_DELAY);
+}
+
+/* "Kết nối" ngay: phát STA_CONNECTED rồi STA_GOT_IP như trên thiết bị */
+esp_err_t esp_wifi_connect(void)
+{
+    // 0.0.0.0: các socket bind/join trên mọi interface của máy host
+    ip_event_got_ip_t got_ip = { 0 };
+
+    esp_event_post(WIFI_EVENT, WIFI_EVENT_STA_CONNECTED, NULL, 0, portMAX_DELAY);
+    return esp_event_post(IP_EVENT, IP_EVENT_STA_GOT_IP, &got_ip, sizeof(got_ip), portMAX_DELAY);
+}
+
+esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t *ap_info)
+{
+    *ap_info = (wifi_ap_record_t){ .ssid = "host", .primary = 1, .rssi = -40 };
+    return ESP_OK;
+}
@@ -5,6 +5,8 @@
 #include "string.h"
 #include "font.h"
 #include "GUI.h"
+#include "lcd_dma.h"
+#include "lcd_font.h"
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
@@ -19,101 +21,11 @@
 /******************************************************************************/
 static void _draw_circle_8(int xc, int yc, int x, int y, uint16_t color);
 static void _swap(uint16_t *a, uint16_t *b);
-static void LCD_WR_REG(uint8_t data);
-static void LCD_WR_DATA(uint16_t data);
-static void LCD_WR_DATA8(uint8_t data);
 static void LCD_SetCursor(uint16_t Xpos, uint16_t Ypos);
-static void LCD_SetWindows(uint16_t xStar, uint16_t yStar, uint16_t xEnd ,uint16_t yEnd);
-static uint8_t LCDSPI_WriteByte(uint8_t data);
 /******************************************************************************/
 /*                            EXPORTED FUNCTIONS                              */
 /******************************************************************************/
 
-/**
- * @func	LCD_WR_REG
- * @brief	Write an 8-bit command to the LCD screen
- * @param	Command value to be written
- * @retval  None
-*/
-static
-void LCD_WR_REG(uint8_t data)
-{
-	LCD_SPI_CS_RESET;					//LCD_CS=0
-	LCD_SPI_RS_RESET;
-	LCDSPI_WriteByte(data);
-	LCD_SPI_CS_SET;						//LCD_CS=1
-}
-
-/**
- * @func	LCD_WR_DATA
- * @brief	Write an 16-bit data to the LCD screen
- * @param	data value to be written
- * @retval  None
-*/
-static
-void LCD_WR_DATA(uint16_t data)
-{
-	LCD_SPI_CS_RESET;					//LCD_CS=0
-	LCD_SPI_RS_SET;
-	LCDSPI_WriteByte(data>>8);
-	LCDSPI_WriteByte(data);
-	LCD_SPI_CS_SET;						//LCD_CS=1
-}
-
-/**
- * @func	LCD_WR_DATA
- * @brief	Write an 8-bit data to the LCD screen
- * @param	data value to be written
- * @retval  None
-*/
-static
-void LCD_WR_DATA8(uint8_t data)
-{
-	LCD_SPI_CS_RESET;					//LCD_CS=0
-	LCD_SPI_RS_SET;
-	LCDSPI_WriteByte(data);
-	LCD_SPI_CS_SET;						//LCD_CS=1
-}
-
-/**
- * @func	LCD_WriteRAM_Prepare
- * @brief	Write GRAM
- * @param	None
- * @retval	None
-*/
-static
-void LCD_WriteRAM_Prepare(void)
-{
-	LCD_WR_REG(lcddev.wramcmd);
-}
-
-/**
- * @func	LCDSPI_WriteByte
- * @brief	Write a byte of data using STM32's Software SPI
- * @param	data:Data to be written
- * @retval	None
-*/
-static
-uint8_t LCDSPI_WriteByte(
-		uint8_t data
-) {
-    spi_transaction_t transaction = {
-        .length = 8,               // Number of bits to send
-        .tx_buffer = &data,        // Pointer to the data to send
-        .rx_buffer = NULL          // No need to receive for this write
-    };
-
-    // Transmit data and wait for the transaction to complete
-    esp_err_t ret = spi_device_transmit(spi, &transaction);
-    if (ret != ESP_OK) {
-        printf("SPI transmit failed: %s\n", esp_err_to_name(ret));
-        return 0; // Return 0 if an error occurs
-    }
-
-    // If you need to receive a response, you can use the `rx_buffer`
-    return data; // Return the transmitted byte
-}
-
 /**
  * @func	LCD_SetCursor
  * @brief	Set coordinate value
@@ -168,35 +80,6 @@ void _swap(uint16_t *a, uint16_t *b) {
     *b = tmp; // Assign the original value of 'a' (stored in 'tmp') to 'b'
 }
 
-/**
- * @func	LCD_SetWindows
- * @brief	Setting LCD display window
- * @param	xStar:the bebinning x coordinate of the LCD display window
-			yStar:the bebinning y coordinate of the LCD display window
-			xEnd:the endning x coordinate of the LCD display window
-			yEnd:the endning y coordinate of the LCD display window
- * @retval	None
-*/
-static
-void LCD_SetWindows(
-		uint16_t xStar, uint16_t yStar,
-		uint16_t xEnd ,uint16_t yEnd
-) {
-	LCD_WR_REG(lcddev.setxcmd);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(xStar);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(xEnd);
-
-	LCD_WR_REG(lcddev.setycmd);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(yStar);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(yEnd);
-
-	LCD_WriteRAM_Prepare();
-}
-
 /**
  * @func	LCD_DrawPoint
  * @brief	draw a point in LCD screen
@@ -209,6 +92,9 @@ void LCD_DrawPoint(
 		uint16_t x, uint16_t y,
 		uint16_t color
 ) {
+	if (x >= lcddev.width || y >= lcddev.height) {
+		return;
+	}
 	LCD_SetCursor(x,y);
 	LCD_WR_DATA(color);
 }
@@ -229,21 +115,14 @@ void LCD_DrawArea(
     uint16_t x1, uint16_t y1,
     uint16_t color, int fill
 ) {
-    uint16_t i, j;
-    uint16_t width = x1 - x0 + 1; // Calculate the width of the area
-    uint16_t height = y1 - y0 + 1; // Calculate the height of the area
-
-    // Set the drawing window to the specified area
-    LCD_SetWindows(x0, y0, x1, y1);
-
     // Fill the area with the specified color if the fill flag is set
     if (fill) {
-        for (i = 0; i < height; i++) {
-            for (j = 0; j < width; j++) {
-                // Write color data to the LCD
-                LCD_WR_DATA(color);
-            }
+        // Clip once against the active geometry, never per pixel
+        if (!LCD_ClipRect(&x0, &y0, &x1, &y1)) {
+            return;
         }
+        // One DMA band filled once and sent as often as the area needs
+        LCD_DMA_Fill(x0, y0, x1, y1, color);
     } else {
         // Draw the boundary of the area
         // Draw horizontal lines at the top and bottom edges
@@ -252,6 +131,7 @@ void LCD_DrawArea(
         // Draw vertical lines at the left and right edges
         LCD_DrawLine(x0, y0, x0, y1, color); // Left
         LCD_DrawLine(x1, y0, x1, y1, color); // Right
+        return;
     }
 
     // Reset the drawing window to the full screen
@@ -503,7 +383,7 @@ void LCD_DrawTriangle(
 			y:			the bebinning y coordinate of the Character display position
 			color:		the color value of display character. (WHITE, BLACK, BLUE, MAGENTA,...)
 			background:	the background color of display character. (WHITE, BLACK, BLUE, MAGENTA,...)
-			num:		the ascii code of display character (0~94)
+			num:		the ascii code of display character (' '~'~')
 			size:		the size of display character (>=12)
 			mode:		0-no overlying, 1-overlying
  * @retval	None
@@ -513,93 +393,30 @@ void LCD_ShowChar(
 		uint16_t color, uint16_t background,
 		uint8_t num, uint8_t size, uint8_t mode
 ) {
-	uint8_t temp;
-	uint8_t pos,t;
-	uint16_t colortemp=POINT_COLOR;
-
-	num=num-' ';
-	LCD_SetWindows(x,y,x+size/2-1,y+size-1);
-	if(!mode)
-	{
-		for(pos=0;pos<size;pos++)
-		{
-			if(size==12)temp=asc2_1206[num][pos];
-			else temp=asc2_1608[num][pos];
-			for(t=0;t<size/2;t++)
-		    {
-		        if(temp&0x01)LCD_WR_DATA(color);
-				else LCD_WR_DATA(background);
-				temp>>=1;
-
-		    }
+	uint8_t text[2] = { num, '\0' };
 
-		}
-	}else
-	{
-		for(pos=0;pos<size;pos++)
-		{
-			if(size==12)temp=asc2_1206[num][pos];
-			else temp=asc2_1608[num][pos];
-			for(t=0;t<size/2;t++)
-		    {
-				POINT_COLOR=color;
-		        if(temp&0x01)LCD_DrawPoint(x+t,y+pos, color);
-		        temp>>=1;
-		    }
-		}
-	}
-	POINT_COLOR=colortemp;
-	LCD_SetWindows(0,0,lcddev.width-1,lcddev.height-1);
+	LCD_FONT_Draw(x, y, color, background, text, size, mode);
 }
 
 /**
  * @func	LCD_ShowString
- * @brief	Display string
+ * @brief	Display a UTF-8 string
  * @param	x:			the bebinning x coordinate of the string
 			y:			the bebinning y coordinate of the string
 			color: 		the color of the font. (WHITE, BLACK, BLUE, MAGENTA,...)
 			background: the color of the background. (WHITE, BLACK, BLUE, MAGENTA,...)
-			text:		the start address of the string
+			text:		the start address of the UTF-8 string
 			size:		the size of display character (>= 12 to display)
 			mode:		0-no overlying, 1-overlying
  * @retval	None
+ * @note	Code points missing from the font are drawn as a box.
 */
 void LCD_ShowString(
     uint16_t x, uint16_t y,
     uint16_t color, uint16_t background,
     uint8_t *text, uint8_t size, uint8_t mode
 ) {
-	uint16_t colortemp=POINT_COLOR;
-    while (*text != '\0') {
-        if (*text >= ' ' && *text <= '~') {
-            // Display printable ASCII characters
-            uint8_t num = *text - ' '; // Convert to index suitable for font array
-            LCD_SetWindows(x, y, x + size / 2 - 1, y + size - 1);
-
-            if (!mode) {
-                for (uint8_t pos = 0; pos < size; pos++) {
-                    uint8_t temp = (size == 12) ? asc2_1206[num][pos] : asc2_1608[num][pos];
-                    for (uint8_t t = 0; t < size / 2; t++) {
-                        LCD_WR_DATA((temp & 0x01) ? color : background);
-                        temp >>= 1;
-                    }
-                }
-            } else {
-                for (uint8_t pos = 0; pos < size; pos++) {
-                    uint8_t temp = (size == 12) ? asc2_1206[num][pos] : asc2_1608[num][pos];
-                    for (uint8_t t = 0; t < size / 2; t++) {
-                        POINT_COLOR = color;
-                        if (temp & 0x01) LCD_DrawPoint(x + t, y + pos, color);
-                        temp >>= 1;
-                    }
-                }
-            }
-            POINT_COLOR = colortemp;
-            LCD_SetWindows(0, 0, lcddev.width - 1, lcddev.height - 1);
-            x += size / 2; // Adjust x position for the next character
-        }
-        text++; // Move to the next character in the string
-    }
+    LCD_FONT_Draw(x, y, color, background, text, size, mode);
 }
 
 /**
@@ -649,7 +466,7 @@ uint32_t mypow(uint32_t base, uint8_t exp) {
  * @brief	Show string in the middle of the LCD display
  * @param	color:		the color value of strings. (WHITE, BLACK, BLUE, MAGENTA,...)
  *			background:	the background color of strings. (WHITE, BLACK, BLUE, MAGENTA,...)
- *			str:		the start address of the Chinese and English strings
+ *			str:		the start address of the UTF-8 string
  *			size:		the size of English strings
  *			mode:		0-no overlying,1-overlying
  * @retval	None
@@ -658,8 +475,8 @@ void LCD_ShowCentredString(
     uint16_t color, uint16_t background,
     uint8_t *text, uint8_t size, uint8_t mode
 ) {
-    uint16_t len = strlen((const char *)text);
-    uint16_t x1 = (lcddev.width - len * size / 2) / 2;
+    uint16_t width = LCD_FONT_Width(text, size);
+    uint16_t x1 = width < lcddev.width ? (lcddev.width - width) / 2 : 0;
     uint16_t y1 = (lcddev.height - size) / 2; // Calculate starting y-coordinate for vertical centering
     LCD_ShowString(x1, y1, color, background, text, size, mode);
 }
@@ -677,38 +494,41 @@ void LCD_DrawBMP16(
 		const unsigned char *p
 ) {
   	int i;
-	unsigned char picH,picL;
-	LCD_SetWindows(x,y,x+40-1,y+40-1);
+	uint16_t x1 = x + 40 - 1, y1 = y + 40 - 1;
+	lcd_dma_stream_t s;
+
+	if (!LCD_ClipRect(&x, &y, &x1, &y1)) {
+		return;
+	}
+	LCD_DMA_Begin(&s,x,y,x1,y1);
 
-    for(i=0;i<40*40;i++) {
-	 	picL=*(p+i*2);
-		picH=*(p+i*2+1);
-		LCD_WR_DATA(picH<<8|picL);
+	// Only the visible part is sent, the image keeps its 40-pixel stride;
+	// pixels are stored low byte first and swapped into the band a row at a time
+	for(i=0;i<=y1-y;i++) {
+		LCD_DMA_PushPixels(&s,p+i*40*2,x1-x+1);
 	}
+	LCD_DMA_End(&s);
 
 	LCD_SetWindows(0,0,lcddev.width-1,lcddev.height-1);
 }
 
 void LCD_ShowImg(uint8_t width, uint8_t height) {
-    uint16_t x, y;
-
-    // 1. Thiết lập vùng hiển thị (Address Window)
-    LCD_SetWindows(0, 0, width - 1, height - 1);
-
-    // 2. Gửi toàn bộ dữ liệu ảnh (mảng bmp1) qua SPI
-    for (y = 0; y < height; y++) {
-        for (x = 0; x < width; x++) {
-            // Tính chỉ số pixel trong mảng bmp1 (mỗi pixel chiếm 2 byte)
-            uint32_t index = (y * width + x) + 1;
-            
-            // Đọc 2 byte dữ liệu và ghép thành giá trị RGB565
-            uint16_t color = image_data_160x128x16[index];
-
-            // Gửi pixel qua SPI (hoặc DMA nếu hỗ trợ)
-            LCD_WR_DATA(color);
-        }
+    uint16_t y;
+    uint16_t x0 = 0, y0 = 0, x1 = width - 1, y1 = height - 1;
+    lcd_dma_stream_t s;
+
+    // 1. Thiết lập vùng hiển thị (Address Window), cắt theo kích thước màn hình
+    if (!LCD_ClipRect(&x0, &y0, &x1, &y1)) {
+        return;
     }
-}
+    LCD_DMA_Begin(&s, 0, 0, x1, y1);
 
+    // 2. Gửi phần ảnh nằm trong màn hình qua SPI, giữ bước dòng = width.
+    //    Mỗi dòng được đảo byte vào band DMA một lần (pixel bắt đầu từ chỉ số 1)
+    for (y = 0; y <= y1; y++) {
+        LCD_DMA_PushPixels(&s, &image_data_160x128x16[y * width + 1], x1 + 1);
+    }
+    LCD_DMA_End(&s);
+}
 
 /* END FILE */
@@ -130,7 +130,7 @@ void LCD_DrawTriangle(
 			y:			the bebinning y coordinate of the Character display position
 			color:		the color value of display character. (WHITE, BLACK, BLUE, MAGENTA,...)
 			background:	the background color of display character. (WHITE, BLACK, BLUE, MAGENTA,...)
-			num:		the ascii code of display character (0~94)
+			num:		the ascii code of display character (' '~'~')
 			size:		the size of display character (>=12)
 			mode:		0-no overlying, 1-overlying
  * @retval	None
@@ -141,12 +141,12 @@ void LCD_ShowChar(uint16_t x, uint16_t y,
 
 /**
  * @func	LCD_ShowString
- * @brief	Display string
+ * @brief	Display a UTF-8 string
  * @param	x:			the bebinning x coordinate of the string
 			y:			the bebinning y coordinate of the string
 			color: 		the color of the font. (WHITE, BLACK, BLUE, MAGENTA,...)
 			background: the color of the background. (WHITE, BLACK, BLUE, MAGENTA,...)
-			text:		the start address of the string
+			text:		the start address of the UTF-8 string
 			size:		the size of display character (>= 12 to display)
 			mode:		0-no overlying, 1-overlying
  * @retval	None
@@ -175,7 +175,7 @@ void LCD_ShowNum(uint16_t x, uint16_t y,
  * @brief	Show string in the middle of the LCD display
  * @param	color:		the color value of strings. (WHITE, BLACK, BLUE, MAGENTA,...)
  *			background:	the background color of strings. (WHITE, BLACK, BLUE, MAGENTA,...)
- *			str:		the start address of the Chinese and English strings
+ *			str:		the start address of the UTF-8 string
  *			size:		the size of English strings
  *			mode:		0-no overlying,1-overlying
  * @retval	None
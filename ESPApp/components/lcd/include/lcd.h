@@ -7,13 +7,13 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_system.h"
+#include "sdkconfig.h"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 /*! @brief LCD Pins */
 #define LCD_SPI					SPI2_HOST
-#define PARALLEL_LINES 16
 
 #define LCD_CS_PIN				11
 #define LCD_SPI_GPIO_SCK		10
@@ -44,9 +44,28 @@
 
 #define USE_HORIZONTAL  		0
 
-/*! @brief LCD pixels */
-#define LCD_W 					130
-#define LCD_H 					161
+/*! @brief LCD pixels (visible area, native portrait orientation) */
+#define LCD_W 					128
+#define LCD_H 					160
+
+/*! @brief Visible area position inside the 132x162 ST7735S frame memory,
+ *         unmirrored. Kconfig gives it in the default rotation (MY|MX). */
+#define LCD_GRAM_COLS			132
+#define LCD_COL_OFFSET			(LCD_GRAM_COLS - LCD_W - CONFIG_LCD_COL_OFFSET)
+#define LCD_ROW_OFFSET			(LCD_GRAM_LINES - LCD_H - CONFIG_LCD_ROW_OFFSET)
+
+/*! @brief MADCTL bits */
+#define LCD_MADCTL_MY			0x80
+#define LCD_MADCTL_MX			0x40
+#define LCD_MADCTL_MV			0x20
+
+/*! @brief SPI clocks */
+#define LCD_SPI_CLOCK_HZ		(CONFIG_LCD_SPI_CLOCK_KHZ * 1000)
+#define LCD_SPI_SRC_HZ			(80 * 1000 * 1000)
+
+/*! @brief ST7735S frame memory lines and lines actually shown by the panel */
+#define LCD_GRAM_LINES			162
+#define LCD_PANEL_LINES			LCD_H
 
 /*! @brief Color */
 #define WHITE       			0xFFFF
@@ -65,15 +84,21 @@
 
 extern spi_device_handle_t spi;
 
-/*! @brief structure lcd */
+/*! @brief structure lcd: active display geometry, set by LCD_Direction */
 typedef struct
 {
-	uint16_t width;
-	uint16_t height;
+	uint16_t width;			/* Logical width for the active rotation */
+	uint16_t height;		/* Logical height for the active rotation */
+	uint16_t x_offset;		/* Added to x before CASET */
+	uint16_t y_offset;		/* Added to y before RASET */
+	uint8_t  rotation;		/* LCD_Direction argument */
+	uint8_t  madctl;		/* MADCTL value for the rotation */
 	uint16_t id;
 	uint16_t wramcmd;
 	uint16_t setxcmd;
 	uint16_t setycmd;
+	uint8_t  scroll_axis;	/* 0: hardware scroll moves y, 1: moves x (MV set) */
+	uint8_t  scroll_mirror;	/* 1 if the scroll axis runs against memory lines */
 }_lcd_dev;
 
 typedef struct
@@ -106,22 +131,45 @@ void LCD_Init(void);
 
 
 /**
- * @func	LCD_Clear
- * @brief	Full screen filled LCD screen
- * @param	color: Color of the screen (WHITE, BLACK, BLUE, MAGENTA, SKY,...)
+ * @func	LCD_SetWindows
+ * @brief	Set the GRAM write window in logical coordinates and start RAMWR
+ * @param	xStar, yStar:	top-left corner (inclusive)
+ *			xEnd, yEnd:		bottom-right corner (inclusive)
  * @retval	None
+ * @note	Panel offsets of the active rotation are applied here; callers
+ *			clip with LCD_ClipRect first.
 */
-void LCD_Clear(uint16_t color);
+void LCD_SetWindows(uint16_t xStar, uint16_t yStar, uint16_t xEnd, uint16_t yEnd);
+
+
+
+/**
+ * @func	LCD_ClipRect
+ * @brief	Clip an inclusive rectangle against the active geometry
+ * @param	x0, y0, x1, y1:	corners, updated in place
+ * @retval	1 if something is left to draw, 0 if fully outside or empty
+*/
+int LCD_ClipRect(uint16_t *x0, uint16_t *y0, uint16_t *x1, uint16_t *y1);
+
+
+
+/**
+ * @func	LCD_WR_DATA
+ * @brief	Write one 16-bit pixel into the current window
+ * @param	data: RGB565 color
+ * @retval	None
+*/
+void LCD_WR_DATA(uint16_t data);
 
 
 
 /**
- * @func	LCD_Clear_DMA
- * @brief	Full screen filled LCD screen mode DMA
+ * @func	LCD_Clear
+ * @brief	Full screen filled LCD screen
  * @param	color: Color of the screen (WHITE, BLACK, BLUE, MAGENTA, SKY,...)
  * @retval	None
 */
-void LCD_Clear_DMA(uint16_t color);
+void LCD_Clear(uint16_t color);
 
 
 
@@ -133,6 +181,43 @@ void LCD_Clear_DMA(uint16_t color);
 					   	2: 180 degree
 					   	3: 270 degree
  * @retval	None
+ * @note	Rotation is done by MADCTL only; lcddev is updated with the
+ *			logical size and panel offsets used by every primitive.
 */
 void LCD_Direction(uint8_t direction);
 
+
+
+/**
+ * @func	LCD_SetScrollArea
+ * @brief	Define the hardware scroll area (VSCRDEF)
+ * @param	top_fixed:	visible lines kept fixed before the scroll area
+ *			lines:		number of memory lines that scroll
+ * @retval	None
+ * @note	Lines run along y in portrait and along x in landscape
+ *			(see lcddev.scroll_axis). The bottom fixed area takes the rest
+ *			of the LCD_GRAM_LINES frame memory lines.
+*/
+void LCD_SetScrollArea(uint16_t top_fixed, uint16_t lines);
+
+
+
+/**
+ * @func	LCD_ScrollTo
+ * @brief	Show the scroll area starting at a logical offset (VSCRSADD)
+ * @param	offset:	logical pixels along lcddev.scroll_axis, content drawn at
+ *					offset appears at the start of the scroll area
+ * @retval	None
+*/
+void LCD_ScrollTo(uint16_t offset);
+
+
+
+/**
+ * @func	LCD_GetSpiClock
+ * @brief	Actual SPI clock of the panel device
+ * @param	None
+ * @retval	Clock in Hz
+*/
+uint32_t LCD_GetSpiClock(void);
+
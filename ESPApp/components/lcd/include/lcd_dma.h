@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * ST7735S for ESP-IDF
+ *
+ * Display memory: a fixed set of DMA-capable band buffers reserved once by
+ * LCD_Init and shared by every drawing path, so no pixel transfer touches the
+ * heap. A band holds LCD_DMA_LINE_PIXELS * lines pixels and is sent as one
+ * SPI transaction; windows wrap in GRAM, so bands need not match their width.
+ *
+*******************************************************************************/
+#ifndef _LCD_DMA_H_
+#define _LCD_DMA_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+#include "driver/spi_master.h"
+#include "sdkconfig.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*! @brief Longest line of any rotation and the largest band the bus must carry */
+#define LCD_DMA_LINE_PIXELS		160
+#define LCD_DMA_MAX_BANDS		4
+#define LCD_DMA_MAX_BYTES		(CONFIG_LCD_DMA_BAND_LINES * LCD_DMA_LINE_PIXELS * 2)
+
+/*! @brief Pixel stream into the current window, owned by the caller */
+typedef struct
+{
+	uint16_t *buf[2];			/* Bands held by the stream (buf[1] may be NULL) */
+	uint8_t band[2];			/* Pool indexes of buf[] */
+	uint8_t nbufs;				/* 1: send and wait, 2: fill one while the other is sent */
+	uint8_t cur;				/* Band being filled */
+	uint32_t fill;				/* Pixels in the current band */
+	spi_transaction_t trans[2];	/* trans[i] always carries buf[i] */
+	uint8_t busy[2];			/* trans[i] is queued and not collected yet */
+} lcd_dma_stream_t;
+
+/*! @brief Pool layout chosen at init */
+typedef struct
+{
+	uint8_t bands;				/* Bands in the pool */
+	uint16_t lines;				/* Lines per band */
+	uint32_t bytes;				/* Total bytes reserved */
+	uint32_t waits;				/* Acquires that found the pool empty */
+} lcd_dma_info_t;
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	LCD_DMA_Init
+ * @brief	Reserve the band buffers (called once by LCD_Init)
+ * @param	None
+ * @retval	None
+ * @note	Tries CONFIG_LCD_DMA_BANDS bands of CONFIG_LCD_DMA_BAND_LINES
+ *			lines, halving the lines while DMA memory is short and keeping
+ *			fewer bands if only some fit. With no DMA heap left at all the
+ *			pool falls back to a static one-line band.
+*/
+void LCD_DMA_Init(void);
+
+/**
+ * @func	LCD_DMA_Acquire
+ * @brief	Take a free band from the pool, lock-free
+ * @param	wait:	0 returns -1 at once when the pool is empty, otherwise
+ *					yield until a band is released
+ * @retval	Band index, or -1
+*/
+int LCD_DMA_Acquire(int wait);
+
+/**
+ * @func	LCD_DMA_Release
+ * @brief	Give a band back to the pool
+ * @param	band: index returned by LCD_DMA_Acquire
+ * @retval	None
+*/
+void LCD_DMA_Release(int band);
+
+/**
+ * @func	LCD_DMA_Band
+ * @brief	Buffer of a band
+ * @param	band:	index returned by LCD_DMA_Acquire
+ *			pixels:	receives the band capacity in pixels (may be NULL)
+ * @retval	DMA-capable buffer
+*/
+uint16_t *LCD_DMA_Band(int band, uint32_t *pixels);
+
+/**
+ * @func	LCD_DMA_Begin
+ * @brief	Open the window and start a pixel stream into it
+ * @param	s:					stream state, owned by the caller
+ *			x0, y0, x1, y1:		window, already clipped (inclusive)
+ * @retval	None
+*/
+void LCD_DMA_Begin(lcd_dma_stream_t *s, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @func	LCD_DMA_Push
+ * @brief	Append one RGB565 pixel, sending the band when it fills up
+ * @param	s:		stream from LCD_DMA_Begin
+ *			color:	pixel
+ * @retval	None
+*/
+void LCD_DMA_Push(lcd_dma_stream_t *s, uint16_t color);
+
+/**
+ * @func	LCD_DMA_PushPixels
+ * @brief	Append n little-endian RGB565 pixels (C arrays, BMP data)
+ * @param	s:		stream from LCD_DMA_Begin
+ *			src:	pixels, any alignment
+ *			n:		pixel count
+ * @retval	None
+ * @note	Copied into the band with LCD_PX_Swap, a band at a time.
+*/
+void LCD_DMA_PushPixels(lcd_dma_stream_t *s, const void *src, uint32_t n);
+
+/**
+ * @func	LCD_DMA_PushFill
+ * @brief	Append n pixels of one color
+ * @param	s:		stream from LCD_DMA_Begin
+ *			color:	RGB565 color
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_DMA_PushFill(lcd_dma_stream_t *s, uint16_t color, uint32_t n);
+
+/**
+ * @func	LCD_DMA_Claim
+ * @brief	Hand the caller n contiguous pixels of the current band
+ * @param	s:	stream from LCD_DMA_Begin
+ *			n:	pixel count, at most one band (see LCD_DMA_GetInfo)
+ * @retval	Pixels to write in panel byte order (LCD_PX_SWAP) before the
+ *			next call on s, NULL if n is larger than a band
+ * @note	Sends the band first when it has less than n pixels left.
+*/
+uint16_t *LCD_DMA_Claim(lcd_dma_stream_t *s, uint32_t n);
+
+/**
+ * @func	LCD_DMA_End
+ * @brief	Send what is left, wait for the bus and release the bands
+ * @param	s: stream from LCD_DMA_Begin
+ * @retval	None
+*/
+void LCD_DMA_End(lcd_dma_stream_t *s);
+
+/**
+ * @func	LCD_DMA_Fill
+ * @brief	Fill a window with one color
+ * @param	x0, y0, x1, y1:	window, already clipped (inclusive)
+ *			color:			RGB565 color
+ * @retval	None
+ * @note	One band is filled once and sent repeatedly.
+*/
+void LCD_DMA_Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @func	LCD_DMA_GetInfo
+ * @brief	Copy the pool layout
+ * @param	info: receives the layout
+ * @retval	None
+*/
+void LCD_DMA_GetInfo(lcd_dma_info_t *info);
+
+#endif
+
+/* END FILE */
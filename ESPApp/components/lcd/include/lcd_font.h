@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * ST7735S for ESP-IDF
+ *
+ * UTF-8 text: fonts are generated from BDF by utils/font2c.py. Glyphs are
+ * sorted by code point, so a lookup is a direct index for ASCII and a binary
+ * search for everything else (Vietnamese, GB2312 glyphs). Fonts may be
+ * proportional, with kerning pairs, and anti-aliased at 2 or 4 bits per
+ * pixel. Each glyph keeps only the box holding its ink.
+ *
+ * A line of text is laid out first, then composed straight into a DMA band
+ * (coverage, then colors through a background-to-ink ramp) and sent as one
+ * transaction.
+ *
+*******************************************************************************/
+#ifndef _LCD_FONT_H_
+#define _LCD_FONT_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*! @brief Decoded in place of malformed UTF-8, drawn in place of missing glyphs */
+#define LCD_UTF8_INVALID		0xFFFD
+
+/*! @brief One glyph of the index */
+typedef struct
+{
+	uint32_t code;				/* Unicode code point */
+	uint32_t offset : 24;		/* Ink box in bits[]: x (signed, from the pen),
+								   y (from the top), w, h, then w*h pixels */
+	uint32_t width : 8;			/* Advance */
+} lcd_glyph_t;
+
+/*! @brief Kerning pair, sorted by pair */
+typedef struct
+{
+	uint32_t pair;				/* Left glyph index << 16 | right glyph index */
+	int8_t dx;					/* Added to the left glyph's advance */
+} lcd_kern_t;
+
+/*! @brief A font, sorted by code point */
+typedef struct
+{
+	uint8_t height;				/* Line height */
+	uint8_t bpp;				/* Bits per pixel: 1, or 2/4 for anti-aliasing */
+	uint16_t ascii;				/* glyphs[i] is U+0020 + i for i < ascii */
+	uint16_t count;
+	uint16_t fallback;			/* Glyph drawn for missing code points */
+	const lcd_glyph_t *glyphs;
+	const uint8_t *bits;
+	const lcd_kern_t *kerns;	/* May be NULL */
+	uint16_t kern_count;
+} lcd_font_t;
+
+extern const lcd_font_t LCD_Font12;			/* 6x12 ASCII */
+extern const lcd_font_t LCD_FontSans15;		/* Proportional, 4-bit, Latin + Vietnamese */
+extern const lcd_font_t LCD_Font16;			/* 8x16 ASCII, Vietnamese, GB2312 glyphs */
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	LCD_UTF8_Next
+ * @brief	Decode the next code point of a UTF-8 string
+ * @param	text:	cursor, advanced past the sequence (not past the end)
+ * @retval	Code point, 0 at the end of the string, LCD_UTF8_INVALID for a
+ *			malformed, overlong or surrogate sequence (one byte is skipped)
+*/
+uint32_t LCD_UTF8_Next(const uint8_t **text);
+
+/**
+ * @func	LCD_FONT_ForSize
+ * @brief	Font used for a text size
+ * @param	size:	text size in pixels, as passed to LCD_ShowString
+ * @retval	LCD_Font12 below 14, LCD_FontSans15 for 14 and 15,
+ *			LCD_Font16 from 16
+*/
+const lcd_font_t *LCD_FONT_ForSize(uint8_t size);
+
+/**
+ * @func	LCD_FONT_Find
+ * @brief	Look a code point up
+ * @param	font:	the font
+ *			code:	Unicode code point
+ * @retval	The glyph, or the fallback glyph (never NULL)
+*/
+const lcd_glyph_t *LCD_FONT_Find(const lcd_font_t *font, uint32_t code);
+
+/**
+ * @func	LCD_FONT_Width
+ * @brief	Width of a UTF-8 string in pixels
+ * @param	text:	UTF-8 string
+ *			size:	text size
+ * @retval	Sum of the advances and kerning
+*/
+uint16_t LCD_FONT_Width(const uint8_t *text, uint8_t size);
+
+/**
+ * @func	LCD_FONT_Draw
+ * @brief	Draw a UTF-8 string on one line
+ * @param	x, y:		top-left corner
+ *			color:		ink color
+ *			background:	color under the text (mode 0)
+ *			text:		UTF-8 string
+ *			size:		text size, picks the font
+ *			mode:		0-opaque, 1-ink only
+ * @retval	x after the last glyph drawn
+ * @note	Glyphs are drawn whole or not at all. Mode 0 sends the line as
+ *			one transaction. Mode 1 cannot blend with an unknown background,
+ *			so anti-aliased pixels of at least half coverage are drawn solid.
+*/
+uint16_t LCD_FONT_Draw(uint16_t x, uint16_t y, uint16_t color, uint16_t background,
+		const uint8_t *text, uint8_t size, uint8_t mode);
+
+/**
+ * @func	LCD_FONT_DrawLine
+ * @brief	Draw a UTF-8 string into a box, replacing everything in it
+ * @param	x, y, w, h:	the box; text starts at its top-left corner and is
+ *						cut at the last glyph that fits, the rest is background
+ *			color:		ink color
+ *			background:	box color
+ *			text:		UTF-8 string (NULL for an empty box)
+ *			size:		text size, picks the font
+ * @retval	None
+ * @note	One transaction per band of rows, one in all for a text line.
+*/
+void LCD_FONT_DrawLine(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+		uint16_t color, uint16_t background, const uint8_t *text, uint8_t size);
+
+/**
+ * @func	LCD_FONT_Bench
+ * @brief	Log lookup and drawing throughput for ASCII, Vietnamese and CJK text
+ * @param	None
+ * @retval	None
+ * @note	Draws on the panel; call it before the first screen.
+*/
+void LCD_FONT_Bench(void);
+
+#endif
+
+/* END FILE */
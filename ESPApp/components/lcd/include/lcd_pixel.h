@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * ST7735S for ESP-IDF
+ *
+ * RGB565 pixel kernels used to prepare DMA bands: fill, byte swap, blit and
+ * blend. Aligned runs are processed two pixels per 32-bit word, unaligned
+ * heads and tails one pixel at a time. Results are bit-exact with a
+ * per-pixel reference (test/host runs the self-test on the host).
+ *
+*******************************************************************************/
+#ifndef _LCD_PIXEL_H_
+#define _LCD_PIXEL_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+#include "sdkconfig.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*! @brief One pixel in panel (high byte first) order */
+#define LCD_PX_SWAP(c)			((uint16_t)((c) >> 8 | (c) << 8))
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	LCD_PX_Fill
+ * @brief	Write one value into n pixels
+ * @param	dst:	destination (2-byte aligned)
+ *			value:	stored as is, pass LCD_PX_SWAP(color) for the panel
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_PX_Fill(uint16_t *dst, uint16_t value, uint32_t n);
+
+/**
+ * @func	LCD_PX_Swap
+ * @brief	Copy n pixels exchanging the two bytes of each
+ * @param	dst:	destination (2-byte aligned), may equal src
+ *			src:	source, any alignment (image arrays are byte arrays)
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_PX_Swap(uint16_t *dst, const void *src, uint32_t n);
+
+/**
+ * @func	LCD_PX_Blit
+ * @brief	Copy a w x h rectangle between buffers with their own strides
+ * @param	dst, dst_stride:	destination and its line length in pixels
+ *			src, src_stride:	source and its line length in pixels
+ *			w, h:				rectangle size
+ *			swap:				1 to byte-swap while copying
+ * @retval	None
+*/
+void LCD_PX_Blit(uint16_t *dst, uint32_t dst_stride,
+		const void *src, uint32_t src_stride,
+		uint16_t w, uint16_t h, int swap);
+
+/**
+ * @func	LCD_PX_Blend50
+ * @brief	dst = (a + b) / 2 per channel, rounding down
+ * @param	dst:	destination, may equal a or b
+ *			a, b:	native-order RGB565 pixels
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_PX_Blend50(uint16_t *dst, const uint16_t *a, const uint16_t *b, uint32_t n);
+
+/**
+ * @func	LCD_PX_Blend
+ * @brief	dst = fg * alpha + bg * (1 - alpha) per channel
+ * @param	dst:	destination, may equal fg or bg
+ *			fg, bg:	native-order RGB565 pixels
+ *			alpha:	0 (bg) .. 255 (fg), quantized to 32 steps
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_PX_Blend(uint16_t *dst, const uint16_t *fg, const uint16_t *bg, uint8_t alpha, uint32_t n);
+
+/**
+ * @func	LCD_PX_SelfTest
+ * @brief	Compare every kernel against a per-pixel reference and time both
+ * @param	None
+ * @retval	1 if all kernels are bit-exact, 0 otherwise
+ * @note	Logs the speedup of each kernel.
+*/
+int LCD_PX_SelfTest(void);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * ST7735S for ESP-IDF
+ *
+ * Shadow of the display memory: every pixel sent to GRAM is also stored in a
+ * copy in RAM, following the window and its cursor the way the controller
+ * does. The screen can then be read back without RAMRD (SDA is write-only on
+ * most boards) and without touching the bus. Rows come back with the hardware
+ * scroll applied, as the panel shows them. Rows written since the last look
+ * are tracked too, so a viewer can fetch only what changed.
+ *
+*******************************************************************************/
+#ifndef _LCD_SHADOW_H_
+#define _LCD_SHADOW_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*! @brief Longest row and most rows of any rotation */
+#define LCD_SHADOW_ROW_PIXELS	160
+#define LCD_SHADOW_MAX_ROWS		160
+
+/*! @brief A changed area of the screen */
+typedef struct
+{
+	uint16_t x, y;
+	uint16_t w, h;
+} lcd_shadow_rect_t;
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	LCD_SHADOW_Init
+ * @brief	Reserve the copy (called once by LCD_Init)
+ * @param	None
+ * @retval	None
+ * @note	Does nothing without CONFIG_LCD_SHADOW. PSRAM is used when
+ *			present, internal RAM otherwise.
+*/
+void LCD_SHADOW_Init(void);
+
+/**
+ * @func	LCD_SHADOW_Window
+ * @brief	Follow a new GRAM window (called by LCD_SetWindows)
+ * @param	x0, y0, x1, y1:	inclusive window, logical coordinates
+ * @retval	None
+*/
+void LCD_SHADOW_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @func	LCD_SHADOW_Write
+ * @brief	Store pixels written at the window cursor
+ * @param	px:	pixels in panel byte order, as sent on the bus
+ *			n:	count; the cursor wraps in the window like in GRAM
+ * @retval	None
+*/
+void LCD_SHADOW_Write(const uint16_t *px, uint32_t n);
+
+/**
+ * @func	LCD_SHADOW_Scroll
+ * @brief	Follow the hardware scroll (called by LCD_SetScrollArea/ScrollTo)
+ * @param	first:	first logical pixel of the scroll area along
+ *					lcddev.scroll_axis
+ *			lines:	size of the scroll area
+ *			offset:	content drawn at first + offset is shown at first
+ * @retval	None
+*/
+void LCD_SHADOW_Scroll(uint16_t first, uint16_t lines, uint16_t offset);
+
+/**
+ * @func	LCD_SHADOW_Size
+ * @brief	Size of the screen as read by LCD_SHADOW_Row
+ * @param	width, height:	receive the size in the current rotation
+ * @retval	0, or -1 without a shadow (disabled or out of memory)
+*/
+int LCD_SHADOW_Size(uint16_t *width, uint16_t *height);
+
+/**
+ * @func	LCD_SHADOW_Row
+ * @brief	Read one row of the screen as shown
+ * @param	y:		row, 0 .. lcddev.height - 1
+ *			dst:	receives lcddev.width pixels, native RGB565
+ * @retval	0, or -1 without a shadow or for a row off the screen
+ * @note	Drawing goes on while rows are read: a row is copied as it is at
+ *			that moment, so an image read during a redraw may mix two frames.
+*/
+int LCD_SHADOW_Row(uint16_t y, uint16_t *dst);
+
+/**
+ * @func	LCD_SHADOW_Damage
+ * @brief	Take the areas written since the last call
+ * @param	rects:	receives the areas, in the coordinates of LCD_SHADOW_Row
+ *			max:	size of rects (>= 1)
+ * @retval	Number of areas, 0 if nothing changed
+ * @note	Consecutive changed rows form one area spanning all of them; past
+ *			max areas, the last one grows to cover the rest. A scroll
+ *			change damages the whole screen.
+*/
+int LCD_SHADOW_Damage(lcd_shadow_rect_t *rects, int max);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * ST7735S for ESP-IDF
+ *
+ * Render scheduler: callers mark the UI dirty, a single task redraws it at
+ * most CONFIG_LCD_RENDER_FPS times per second.
+ *
+*******************************************************************************/
+#ifndef _RENDER_H_
+#define _RENDER_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*! @brief Function that draws one frame (runs on the render task) and
+ *         returns the area it sent to the panel, in pixels */
+typedef uint32_t (*render_fn_t)(void);
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	RENDER_Init
+ * @brief	Start the render task
+ * @param	fn:		frame function, the only code allowed to draw afterwards
+ *			fps:	maximum frame rate (0 uses CONFIG_LCD_RENDER_FPS)
+ * @retval	None
+*/
+void RENDER_Init(render_fn_t fn, uint8_t fps);
+
+/**
+ * @func	RENDER_Request
+ * @brief	Mark the UI dirty; safe to call from any task at any rate
+ * @param	None
+ * @retval	None
+*/
+void RENDER_Request(void);
+
+#endif
+
+/* END FILE */
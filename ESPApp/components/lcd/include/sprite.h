@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * ST7735S for ESP-IDF
+ *
+ * Sprites with an alpha channel (RGB565A8), produced by utils/sprite2c.py.
+ * The image is trimmed to its visible pixels and stored as runs per row:
+ * transparent runs cost a fill, opaque runs a copy, and only the pixels in
+ * between are blended. Colors are pre-multiplied by alpha, so compositing
+ * onto a background color is one add per blended pixel.
+ *
+*******************************************************************************/
+#ifndef _SPRITE_H_
+#define _SPRITE_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*! @brief Run byte: type in bits 7..6, length - 1 (1..64 pixels) in bits 5..0 */
+#define SPRITE_RUN_CLEAR		0x00	/* Transparent: background */
+#define SPRITE_RUN_OPAQUE		0x40	/* Copied from pixels[] */
+#define SPRITE_RUN_BLEND		0x80	/* pixels[] + background * (1 - alpha[]) */
+#define SPRITE_RUN_END			0xC0	/* End of row, the rest is background */
+#define SPRITE_RUN_TYPE(b)		((b) & 0xC0)
+#define SPRITE_RUN_LEN(b)		(((b) & 0x3F) + 1)
+
+/*! @brief Alpha byte to the 0..32 scale used for pre-multiplying */
+#define SPRITE_ALPHA5(a)		(((a) + 4) >> 3)
+
+/*! @brief One RGB565A8 sprite */
+typedef struct
+{
+	uint16_t width;				/* Design size, what widgets reserve */
+	uint16_t height;
+	uint16_t x;					/* Visible box inside the design */
+	uint16_t y;
+	uint16_t w;
+	uint16_t h;
+	const uint8_t *runs;		/* h rows of runs, each closed by SPRITE_RUN_END */
+	const uint16_t *pixels;		/* Opaque and blended pixels in run order, pre-multiplied */
+	const uint8_t *alpha;		/* One byte per blended pixel */
+	uint16_t opaque;			/* Pixel counts, for the benchmark */
+	uint16_t blended;
+} sprite_t;
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	SPRITE_Draw
+ * @brief	Composite a sprite onto a background color and send it
+ * @param	sp:			the sprite
+ *			x, y:		top-left corner of its design box
+ *			background:	color under the sprite
+ *			full:		1 repaints the whole design box (replacing another
+ *						sprite of the same size), 0 only the visible box
+ * @retval	None
+ * @note	Drawn whole or not at all, like glyphs.
+*/
+void SPRITE_Draw(const sprite_t *sp, uint16_t x, uint16_t y, uint16_t background, int full);
+
+/**
+ * @func	SPRITE_Compose
+ * @brief	Composite a sprite into memory
+ * @param	sp:			the sprite
+ *			background:	color under the sprite
+ *			dst:		width * height native-order pixels
+ * @retval	None
+*/
+void SPRITE_Compose(const sprite_t *sp, uint16_t background, uint16_t *dst);
+
+/**
+ * @func	SPRITE_Bench
+ * @brief	Log the cost of compositing a sprite
+ * @param	name:		label for the log line
+ *			sp:			the sprite
+ *			background:	color under the sprite
+ * @retval	Nanoseconds per composite
+*/
+uint32_t SPRITE_Bench(const char *name, const sprite_t *sp, uint16_t background);
+
+#endif
+
+/* END FILE */
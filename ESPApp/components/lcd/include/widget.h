@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * ST7735S for ESP-IDF
+ *
+ * Retained-mode widget layer: every widget remembers its bounds and the
+ * value it last put on the panel, so a render pass only touches widgets
+ * whose bound data changed, and within them only the pixels that differ.
+ *
+*******************************************************************************/
+#ifndef _WIDGET_H_
+#define _WIDGET_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+#include "sprite.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*! @brief Widget kinds */
+typedef enum
+{
+	WIDGET_BOX = 0,		/* Static filled box or outline */
+	WIDGET_LABEL,		/* Text bound to a string pointer */
+	WIDGET_TOGGLE,		/* ON/OFF indicator bound to an int */
+	WIDGET_ICON,		/* 40x40 BMP16 bound to an image pointer */
+	WIDGET_PROGRESS,	/* Horizontal bar bound to an int in [0, max] */
+	WIDGET_SPRITE,		/* Alpha sprite pair (OFF/ON) bound to an int */
+} widget_type_t;
+
+/*! @brief Rectangle in panel coordinates (inclusive start, exclusive end) */
+typedef struct
+{
+	uint16_t x;
+	uint16_t y;
+	uint16_t w;
+	uint16_t h;
+} widget_rect_t;
+
+/*! @brief One retained widget */
+typedef struct
+{
+	widget_type_t type;
+	widget_rect_t rect;
+	uint16_t color;			/* Foreground / fill / ON color */
+	uint16_t background;	/* Background / OFF color */
+	uint16_t alt_color;		/* Toggle: OFF text color */
+	const char *on_text;	/* Toggle: text when ON (default "ON ") */
+	const char *off_text;	/* Toggle: text when OFF (default "OFF") */
+	uint8_t size;			/* Font size for text widgets */
+	uint8_t fill;			/* Box: 1-filled, 0-outline */
+	union {
+		const char *const *text;				/* WIDGET_LABEL */
+		const volatile int *state;				/* WIDGET_TOGGLE, WIDGET_PROGRESS, WIDGET_SPRITE */
+		const unsigned char *const *image;		/* WIDGET_ICON */
+	} bind;
+	int32_t max;			/* Progress: full-scale value */
+	const sprite_t *sprites[2];	/* Sprite: OFF, ON (same design size) */
+	uint32_t last;			/* Value last rendered */
+	uint16_t last_len;		/* Label: length of the text last rendered */
+	widget_rect_t drawn;	/* Area holding what was last rendered */
+	uint8_t valid;			/* 0 until the widget has been rendered once */
+} widget_t;
+
+/*! @brief A screen is a z-ordered list of widgets in caller-owned storage */
+typedef struct
+{
+	widget_t *widgets;
+	uint16_t count;
+	uint16_t capacity;
+	widget_rect_t damage;	/* Union of the areas sent by the last render */
+} widget_screen_t;
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	WIDGET_ScreenInit
+ * @brief	Attach widget storage to a screen and empty it
+ * @param	screen:		the screen
+ *			storage:	array of at least capacity widgets
+ *			capacity:	number of widgets storage can hold
+ * @retval	None
+*/
+void WIDGET_ScreenInit(widget_screen_t *screen, widget_t *storage, uint16_t capacity);
+
+/**
+ * @func	WIDGET_AddBox
+ * @brief	Add a static box (drawn once, then only on invalidate)
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddBox(widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+		uint16_t color, int fill);
+
+/**
+ * @func	WIDGET_AddLabel
+ * @brief	Add a text label bound to a string pointer
+ * @param	text:	address of the string pointer; the label redraws when the
+ *					pointed-to text changes
+ *			w:		width of the label in pixels (text is cleared to this and
+ *					clipped to it), 0 for the width of the text bound now
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddLabel(widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint16_t w, uint8_t size,
+		uint16_t color, uint16_t background,
+		const char *const *text);
+
+/**
+ * @func	WIDGET_AddToggle
+ * @brief	Add an ON/OFF indicator bound to an int
+ * @param	on_color:	text color when *state != 0
+ *			off_color:	text color when *state == 0
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddToggle(widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint8_t size,
+		uint16_t on_color, uint16_t off_color, uint16_t background,
+		const volatile int *state);
+
+/**
+ * @func	WIDGET_SetToggleText
+ * @brief	Replace the ON/OFF texts of a toggle, resizing its bounds
+ * @param	w:		toggle widget
+ *			on:		text shown when the bound int is non-zero
+ *			off:	text shown when it is zero
+ * @retval	None
+*/
+void WIDGET_SetToggleText(widget_t *w, const char *on, const char *off);
+
+/**
+ * @func	WIDGET_AddIcon
+ * @brief	Add a 40x40 BMP16 icon bound to an image pointer
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddIcon(widget_screen_t *screen,
+		uint16_t x, uint16_t y,
+		const unsigned char *const *image);
+
+/**
+ * @func	WIDGET_AddProgress
+ * @brief	Add a horizontal progress bar bound to an int in [0, max]
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddProgress(widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+		uint16_t color, uint16_t background,
+		const volatile int *value, int32_t max);
+
+/**
+ * @func	WIDGET_AddSprite
+ * @brief	Add a sprite pair bound to an int, composited onto background
+ * @param	off:	sprite shown when *state == 0
+ *			on:		sprite shown when *state != 0 (same design size as off)
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddSprite(widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint16_t background,
+		const sprite_t *off, const sprite_t *on,
+		const volatile int *state);
+
+/**
+ * @func	WIDGET_Invalidate
+ * @brief	Force every widget of the screen to redraw on the next render
+ * @param	screen: the screen
+ * @retval	None
+*/
+void WIDGET_Invalidate(widget_screen_t *screen);
+
+/**
+ * @func	WIDGET_Render
+ * @brief	Redraw the widgets whose bound value changed since last render
+ * @param	screen: the screen
+ * @retval	Number of widgets redrawn
+ * @note	Each widget sends only its damage, the union of the area it
+ *			covered before and the area it covers now, minus what stays the
+ *			same. screen->damage receives the union of this pass (w == 0
+ *			when nothing was sent).
+*/
+uint16_t WIDGET_Render(widget_screen_t *screen);
+
+#endif
+
+/* END FILE */
@@ -2,20 +2,38 @@
 /*                              INCLUDE FILES                                 */
 /******************************************************************************/
 #include "lcd.h"
+#include "lcd_dma.h"
+#include "lcd_pixel.h"
+#include "lcd_shadow.h"
 #include "soc/spi_periph.h"
+#include "esp_attr.h"
+#include "esp_log.h"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
+#define LCD_TUNE_PIXELS			32		/* Pixels written/read per clock probe */
+#define LCD_TUNE_ROUNDS			3		/* Probes per clock, all must pass */
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
+static const char *TAG = "LCD";
+
 _lcd_dev lcddev;
 uint16_t POINT_COLOR = 0x0000;
 uint16_t BACK_COLOR = 0xFFFF;
 extern const unsigned char bmp1[40960];
 
 spi_device_handle_t spi;
+
+static uint32_t spi_clock_hz = LCD_SPI_CLOCK_HZ;
+
+static uint16_t scroll_top = LCD_ROW_OFFSET;
+static uint16_t scroll_lines = LCD_PANEL_LINES;
+static uint16_t scroll_offset;
+
+/* Data after RAMWR is pixels, mirrored to the shadow */
+static uint8_t gram_write;
 /******************************************************************************/
 /*                              EXPORTED DATA                                 */
 /******************************************************************************/
@@ -24,15 +42,21 @@ spi_device_handle_t spi;
 /******************************************************************************/
 static void LCDGPIO_Config(void);
 static void LCDSPI_Config(void);
+static esp_err_t LCDSPI_AddDevice(uint32_t hz, uint32_t flags);
+static void LCD_FrameRate_Config(void);
+#if CONFIG_LCD_SPI_AUTOTUNE
+static esp_err_t LCD_SetSpiClock(uint32_t hz);
+static int LCD_ProbeClock(uint32_t hz, uint32_t seed);
+static uint32_t LCD_AutoTuneSpiClock(uint32_t max_hz);
+#endif
 static void LCD_RESET(void);
 static uint8_t LCDSPI_WriteByte(uint8_t data);
 static void LCD_WR_REG(uint8_t data);
-static void LCD_WR_DATA(uint16_t data);
 static void LCD_WR_DATA8(uint8_t data);
 static void LCD_WriteReg(uint8_t LCD_Reg, uint16_t LCD_RegValue);
 static void LCD_WriteRAM_Prepare(void);
 static void LCD_SetCursor(uint16_t Xpos, uint16_t Ypos);
-static void LCD_SetWindows(uint16_t xStar, uint16_t yStar, uint16_t xEnd ,uint16_t yEnd);
+static void LCD_ScrollShadow(void);
 /******************************************************************************/
 /*                            EXPORTED FUNCTIONS                              */
 /******************************************************************************/
@@ -46,6 +70,7 @@ static void LCD_SetWindows(uint16_t xStar, uint16_t yStar, uint16_t xEnd ,uint16
 static
 void LCD_WR_REG(uint8_t data)
 {
+	gram_write = (data == lcddev.wramcmd);
 	LCD_SPI_CS_RESET;					//LCD_CS=0
 	LCD_SPI_RS_RESET;
 	LCDSPI_WriteByte(data);
@@ -58,7 +83,6 @@ void LCD_WR_REG(uint8_t data)
  * @param	data value to be written
  * @retval  None
 */
-static
 void LCD_WR_DATA(uint16_t data)
 {
 	LCD_SPI_CS_RESET;					//LCD_CS=0
@@ -66,6 +90,10 @@ void LCD_WR_DATA(uint16_t data)
 	LCDSPI_WriteByte(data>>8);
 	LCDSPI_WriteByte(data);
 	LCD_SPI_CS_SET;						//LCD_CS=1
+	if (gram_write) {
+		uint16_t px = LCD_PX_SWAP(data);
+		LCD_SHADOW_Write(&px, 1);
+	}
 }
 
 /**
@@ -148,22 +176,67 @@ void LCDSPI_Config(void)
         .sclk_io_num = LCD_SPI_GPIO_SCK,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
-        .max_transfer_sz = PARALLEL_LINES * 320 * 2 + 8
+        .max_transfer_sz = LCD_DMA_MAX_BYTES
     };
-    spi_device_interface_config_t devcfg = {
+    //Initialize the SPI bus
+    ret = spi_bus_initialize(LCD_SPI, &buscfg, SPI_DMA_CH_AUTO);
+    ESP_ERROR_CHECK(ret);
+    //Attach the LCD to the SPI bus
+    ret = LCDSPI_AddDevice(spi_clock_hz, 0);
+    ESP_ERROR_CHECK(ret);
+}
 
-        .clock_speed_hz = 10 * 1000 * 1000,     //Clock out at 10 MHz
+/**
+ * @func   LCDSPI_AddDevice
+ * @brief  Attach the panel to the SPI bus (replacing the current handle)
+ * @param  hz:    SPI clock
+ *         flags: spi_device_interface_config_t flags (3-wire readback)
+ * @retval spi_bus_add_device result
+ */
+static
+esp_err_t LCDSPI_AddDevice(uint32_t hz, uint32_t flags)
+{
+    spi_device_interface_config_t devcfg = {
+        .clock_speed_hz = hz,                   //Clock out at hz
         .mode = 0,                              //SPI mode 0
         .spics_io_num = LCD_CS_PIN,             //CS pin
+        .flags = flags,
         .queue_size = 7,                        //We want to be able to queue 7 transactions at a time
         // .pre_cb = lcd_spi_pre_transfer_callback, //Specify pre-transfer callback to handle D/C line
     };
-    //Initialize the SPI bus
-    ret = spi_bus_initialize(LCD_SPI, &buscfg, SPI_DMA_CH_AUTO);
-    ESP_ERROR_CHECK(ret);
-    //Attach the LCD to the SPI bus
-    ret = spi_bus_add_device(LCD_SPI, &devcfg, &spi);
-    ESP_ERROR_CHECK(ret);
+
+    if (spi != NULL) {
+        spi_bus_remove_device(spi);
+        spi = NULL;
+    }
+    return spi_bus_add_device(LCD_SPI, &devcfg, &spi);
+}
+
+/**
+ * @func   LCD_FrameRate_Config
+ * @brief  Program FRMCTR1 (normal), FRMCTR2 (idle) and FRMCTR3 (partial)
+ * @param  None
+ * @retval None
+ * @note   Frame rate = 850 kHz / ((RTNA * 2 + 40) * (160 + FPA + BPA + 2))
+ */
+static
+void LCD_FrameRate_Config(void)
+{
+	LCD_WR_REG(0xB1);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_RTNA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_FPA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_BPA);
+	LCD_WR_REG(0xB2);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_RTNA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_FPA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_BPA);
+	LCD_WR_REG(0xB3);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_RTNA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_FPA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_BPA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_RTNA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_FPA);
+	LCD_WR_DATA8(CONFIG_LCD_FRMCTR_BPA);
 }
 
 
@@ -231,34 +304,51 @@ void LCD_SetCursor(uint16_t Xpos, uint16_t Ypos)
 			yEnd:the endning y coordinate of the LCD display window
  * @retval	None
 */
-static
 void LCD_SetWindows(
 		uint16_t xStar, uint16_t yStar,
 		uint16_t xEnd ,uint16_t yEnd
 ) {
+	LCD_SHADOW_Window(xStar, yStar, xEnd, yEnd);
+
+	xStar += lcddev.x_offset;
+	xEnd  += lcddev.x_offset;
+	yStar += lcddev.y_offset;
+	yEnd  += lcddev.y_offset;
+
 	LCD_WR_REG(lcddev.setxcmd);
-	LCD_WR_DATA8(0x00);
+	LCD_WR_DATA8(xStar >> 8);
 	LCD_WR_DATA8(xStar);
-	LCD_WR_DATA8(0x00);
+	LCD_WR_DATA8(xEnd >> 8);
 	LCD_WR_DATA8(xEnd);
 
 	LCD_WR_REG(lcddev.setycmd);
-	LCD_WR_DATA8(0x00);
+	LCD_WR_DATA8(yStar >> 8);
 	LCD_WR_DATA8(yStar);
-	LCD_WR_DATA8(0x00);
+	LCD_WR_DATA8(yEnd >> 8);
 	LCD_WR_DATA8(yEnd);
 
 	LCD_WriteRAM_Prepare();
 }
 
 /**
- * @func	LCD_DrawPoint
- * @brief	Write a pixel data at a specified location
- * @param	x:the x coordinate of the pixel
-            y:the y coordinate of the pixel
-            color: color of the point
- * @retval	None
+ * @func	LCD_ClipRect
+ * @brief	Clip an inclusive rectangle against the active geometry
+ * @param	x0, y0, x1, y1:	corners, updated in place
+ * @retval	1 if something is left to draw, 0 if fully outside or empty
 */
+int LCD_ClipRect(uint16_t *x0, uint16_t *y0, uint16_t *x1, uint16_t *y1)
+{
+	if (*x0 > *x1 || *y0 > *y1 || *x0 >= lcddev.width || *y0 >= lcddev.height) {
+		return 0;
+	}
+	if (*x1 >= lcddev.width) {
+		*x1 = lcddev.width - 1;
+	}
+	if (*y1 >= lcddev.height) {
+		*y1 = lcddev.height - 1;
+	}
+	return 1;
+}
 
 /**
  * @func	LCD_Init
@@ -269,11 +359,14 @@ void LCD_SetWindows(
 void LCD_Init(void)
 {
 	LCDSPI_Config();
+	LCD_DMA_Init();
+	LCD_SHADOW_Init();
+#if CONFIG_LCD_PIXEL_SELFTEST
+	LCD_PX_SelfTest();
+#endif
 	LCDGPIO_Config();
 	LCD_RESET();
 
-	lcddev.width=128;
-	lcddev.height=160;
 	lcddev.wramcmd=0X2C;
 	lcddev.setxcmd=0X2A;
 	lcddev.setycmd=0X2B;
@@ -281,21 +374,7 @@ void LCD_Init(void)
 	LCD_WR_REG(0x11); //Sleep out
 	vTaskDelay(pdMS_TO_TICKS(120)); //Delay 120ms
 	//------------------------------------ST7735S Frame Rate-----------------------------------------//
-	LCD_WR_REG(0xB1);
-	LCD_WR_DATA8(0x05);
-	LCD_WR_DATA8(0x3C);
-	LCD_WR_DATA8(0x3C);
-	LCD_WR_REG(0xB2);
-	LCD_WR_DATA8(0x05);
-	LCD_WR_DATA8(0x3C);
-	LCD_WR_DATA8(0x3C);
-	LCD_WR_REG(0xB3);
-	LCD_WR_DATA8(0x05);
-	LCD_WR_DATA8(0x3C);
-	LCD_WR_DATA8(0x3C);
-	LCD_WR_DATA8(0x05);
-	LCD_WR_DATA8(0x3C);
-	LCD_WR_DATA8(0x3C);
+	LCD_FrameRate_Config();
 	//------------------------------------End ST7735S Frame Rate-----------------------------------------//
 	LCD_WR_REG(0xB4); //Dot inversion
 	LCD_WR_DATA8(0x03);
@@ -317,8 +396,7 @@ void LCD_Init(void)
 	//---------------------------------End ST7735S Power Sequence-------------------------------------//
 	LCD_WR_REG(0xC5); //VCOM
 	LCD_WR_DATA8(0x1A);
-	LCD_WR_REG(0x36); //MX, MY, RGB mode
-	LCD_WR_DATA8(0xC0);
+	LCD_Direction(0); //MX, MY, RGB mode
 	//------------------------------------ST7735S Gamma Sequence-----------------------------------------//
 	LCD_WR_REG(0xE0);
 	LCD_WR_DATA8(0x04);
@@ -359,6 +437,11 @@ void LCD_Init(void)
 	LCD_WR_DATA8(0x05);
 	LCD_WR_REG(0x29); //Display on
 
+#if CONFIG_LCD_SPI_AUTOTUNE
+	LCD_AutoTuneSpiClock(CONFIG_LCD_SPI_AUTOTUNE_MAX_KHZ * 1000);
+#endif
+	ESP_LOGI(TAG, "SPI clock %lu Hz", (unsigned long)LCD_GetSpiClock());
+
 	LCD_Clear(WHITE);
 }
 
@@ -370,104 +453,286 @@ void LCD_Init(void)
 */
 void LCD_Clear(uint16_t color)
 {
-	unsigned int i,m;
+	LCD_DMA_Fill(0, 0, lcddev.width - 1, lcddev.height - 1, color);
+}
 
-	LCD_SetWindows(0,0,lcddev.width-1,lcddev.height-1);
-	LCD_SPI_CS_RESET;
-	LCD_SPI_RS_SET;
+/**
+ * @func	LCD_Direction
+ * @brief	Setting the display direction of LCD screen
+ * @param	direction: (0: 0 degree
+                       	1: 90 degree
+					   	2: 180 degree
+					   	3: 270 degree
+ * @retval	None
+*/
+void LCD_Direction(uint8_t direction)
+{
+	/* MADCTL per rotation, RGB order: 0xC0 MY|MX, 0xA0 MY|MV, 0x00, 0x60 MX|MV */
+	static const uint8_t madctl[4] = {
+		LCD_MADCTL_MY | LCD_MADCTL_MX,
+		LCD_MADCTL_MY | LCD_MADCTL_MV,
+		0,
+		LCD_MADCTL_MX | LCD_MADCTL_MV,
+	};
+	uint16_t col_off, row_off;
+	uint8_t m;
+
+	if (direction > 3) {
+		return;
+	}
+	m = madctl[direction];
 
-	for(i=0;i<lcddev.height;i++) {
-		for(m=0;m<lcddev.width;m++) {
-			LCD_WR_DATA(color);
-		}
+	lcddev.setxcmd=0x2A;
+	lcddev.setycmd=0x2B;
+	lcddev.wramcmd=0x2C;
+	lcddev.rotation=direction;
+	lcddev.madctl=m;
+
+	/* Mirroring an axis moves the visible area to the other end of the
+	 * frame memory, so the offset is taken from that end */
+	col_off = (m & LCD_MADCTL_MX) ? LCD_GRAM_COLS - LCD_W - LCD_COL_OFFSET : LCD_COL_OFFSET;
+	row_off = (m & LCD_MADCTL_MY) ? LCD_GRAM_LINES - LCD_H - LCD_ROW_OFFSET : LCD_ROW_OFFSET;
+
+	if (m & LCD_MADCTL_MV) {
+		/* Row/column exchange: logical x walks memory lines */
+		lcddev.width=LCD_H;
+		lcddev.height=LCD_W;
+		lcddev.x_offset=row_off;
+		lcddev.y_offset=col_off;
+		lcddev.scroll_axis=1;
+	} else {
+		lcddev.width=LCD_W;
+		lcddev.height=LCD_H;
+		lcddev.x_offset=col_off;
+		lcddev.y_offset=row_off;
+		lcddev.scroll_axis=0;
 	}
+	lcddev.scroll_mirror=(m & LCD_MADCTL_MY) ? 1 : 0;
 
-	LCD_SPI_CS_SET;
+	LCD_WriteReg(0x36, m);
 }
 
+
 /**
- * @func	LCD_Clear_DMA
- * @brief	Full screen filled LCD screen mode DMA
- * @param	color: Color of the screen (WHITE, BLACK, BLUE, MAGENTA, SKY,...)
+ * @func	LCD_ScrollShadow
+ * @brief	Pass the scroll state to the shadow in logical pixels
+ * @param	None
  * @retval	None
+ * @note	A mirrored axis puts the scroll area at the other end of the
+ *			visible lines.
 */
-// LCD_Clear_DMA function in ESP-IDF
-void LCD_Clear_DMA(uint16_t color) {
-    uint32_t total_pixels = lcddev.width * lcddev.height;
-    uint16_t *buffer = heap_caps_malloc(total_pixels * sizeof(uint16_t), MALLOC_CAP_DMA);
-    if (!buffer) {
-        printf("Failed to allocate buffer for DMA\n");
-        return;
-    }
+static
+void LCD_ScrollShadow(void)
+{
+	uint16_t first = scroll_top - LCD_ROW_OFFSET;
 
-    // Fill buffer with the color
-    for (uint32_t i = 0; i < total_pixels; i++) {
-        buffer[i] = color;
-    }
+	if (lcddev.scroll_mirror) {
+		first = LCD_PANEL_LINES - first - scroll_lines;
+	}
+	LCD_SHADOW_Scroll(first, scroll_lines, scroll_offset);
+}
 
-    // Prepare the SPI transaction
-    spi_transaction_t transaction = {
-        .length = total_pixels * 16, // Total transfer size in bits
-        .tx_buffer = buffer,         // Pointer to the buffer
-        .rx_buffer = NULL,           // No data to receive
-    };
+/**
+ * @func	LCD_SetScrollArea
+ * @brief	Define the hardware scroll area (VSCRDEF)
+ * @param	top_fixed:	memory lines kept fixed before the scroll area
+ *			lines:		number of memory lines that scroll
+ * @retval	None
+*/
+void LCD_SetScrollArea(uint16_t top_fixed, uint16_t lines)
+{
+	/* Frame memory lines before the visible area stay outside the scroll */
+	top_fixed += LCD_ROW_OFFSET;
+	if (top_fixed + lines > LCD_GRAM_LINES) {
+		return;
+	}
+	scroll_top = top_fixed;
+	scroll_lines = lines;
+	LCD_ScrollShadow();
+
+	LCD_WR_REG(0x33);
+	LCD_WR_DATA(top_fixed);
+	LCD_WR_DATA(lines);
+	LCD_WR_DATA(LCD_GRAM_LINES - top_fixed - lines);
+}
 
-    LCD_SPI_CS_RESET;  // Select the LCD
-    LCD_SPI_RS_SET; // Set RS for data
+/**
+ * @func	LCD_ScrollTo
+ * @brief	Show the scroll area starting at a logical offset (VSCRSADD)
+ * @param	offset:	logical pixels along lcddev.scroll_axis
+ * @retval	None
+*/
+void LCD_ScrollTo(uint16_t offset)
+{
+	uint16_t line;
+
+	offset %= scroll_lines;
+	/* The panel scans memory lines in one direction only; when the active
+	 * MADCTL mirrors them, a positive logical offset is a negative one in
+	 * memory. */
+	if (lcddev.scroll_mirror && offset != 0) {
+		line = scroll_lines - offset;
+	} else {
+		line = offset;
+	}
 
-    // Transmit the data
-    esp_err_t ret = spi_device_transmit(spi, &transaction);
-    if (ret != ESP_OK) {
-        printf("SPI transaction failed: %s\n", esp_err_to_name(ret));
-    }
+	LCD_WR_REG(0x37);
+	LCD_WR_DATA(scroll_top + line);
 
-    LCD_SPI_CS_SET; // Deselect the LCD
+	scroll_offset = offset;
+	LCD_ScrollShadow();
+}
+
+#if CONFIG_LCD_SPI_AUTOTUNE
+/**
+ * @func	LCD_SetSpiClock
+ * @brief	Re-attach the panel to the bus with a new SPI clock
+ * @param	hz: requested clock, rounded down to 80 MHz / n by the driver
+ * @retval	ESP_OK, or the spi_bus_add_device error (the old clock is restored)
+ * @note	Removes the device from the bus, so nothing else may be drawing:
+ *			only the auto-tune in LCD_Init calls it, before RENDER_Init.
+*/
+static
+esp_err_t LCD_SetSpiClock(uint32_t hz)
+{
+	esp_err_t ret = LCDSPI_AddDevice(hz, 0);
 
-    // Free the buffer
-    heap_caps_free(buffer);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "SPI clock %lu Hz rejected: %s", (unsigned long)hz, esp_err_to_name(ret));
+		ESP_ERROR_CHECK(LCDSPI_AddDevice(spi_clock_hz, 0));
+		return ret;
+	}
+	spi_clock_hz = hz;
+	return ESP_OK;
 }
+#endif
 
 /**
- * @func	LCD_Direction
- * @brief	Setting the display direction of LCD screen
- * @param	direction: (0: 0 degree
-                       	1: 90 degree
-					   	2: 180 degree
-					   	3: 270 degree
- * @retval	None
+ * @func	LCD_GetSpiClock
+ * @brief	Actual SPI clock of the panel device
+ * @param	None
+ * @retval	Clock in Hz
 */
-void LCD_Direction(uint8_t direction)
+uint32_t LCD_GetSpiClock(void)
 {
-	lcddev.setxcmd=0x2A;
-	lcddev.setycmd=0x2B;
-	lcddev.wramcmd=0x2C;
+	int khz = 0;
 
-	switch(direction){
-		case 0:
-			lcddev.width=LCD_W;
-			lcddev.height=LCD_H;
-			LCD_WriteReg(0x36,(0<<3)|(1<<6)|(1<<7));//BGR==1,MY==0,MX==0,MV==0
-			break;
-		case 1:
-			lcddev.width=LCD_H;
-			lcddev.height=LCD_W;
-			LCD_WriteReg(0x36,(0<<3)|(1<<7)|(1<<5));//BGR==1,MY==1,MX==0,MV==1
-			break;
-		case 2:
-			lcddev.width=LCD_W;
-			lcddev.height=LCD_H;
-			LCD_WriteReg(0x36,(0<<3)|(0<<6)|(0<<7));//BGR==1,MY==0,MX==0,MV==0
+	if (spi != NULL && spi_device_get_actual_freq(spi, &khz) == ESP_OK) {
+		return (uint32_t)khz * 1000;
+	}
+	return spi_clock_hz;
+}
+
+#if CONFIG_LCD_SPI_AUTOTUNE
+/**
+ * @func	LCD_ProbeClock
+ * @brief	Write a pattern at hz, read it back at the safe read clock
+ * @param	hz:		write clock under test
+ *			seed:	varies the pattern between rounds
+ * @retval	1 if every pixel read back intact, 0 otherwise
+*/
+static
+int LCD_ProbeClock(uint32_t hz, uint32_t seed)
+{
+	DMA_ATTR static uint8_t tx[LCD_TUNE_PIXELS * 2];
+	DMA_ATTR static uint8_t rx[1 + LCD_TUNE_PIXELS * 3];
+	uint32_t x = seed * 2654435761u + 1;
+	int ok = 1;
+
+	/* Pseudo-random RGB565 words exercise every data bit */
+	for (int i = 0; i < LCD_TUNE_PIXELS; i++) {
+		x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+		tx[i * 2] = x >> 8;
+		tx[i * 2 + 1] = x;
+	}
+
+	if (LCD_SetSpiClock(hz) != ESP_OK) {
+		return 0;
+	}
+	LCD_SetWindows(0, 0, LCD_TUNE_PIXELS - 1, 0);
+	LCD_SPI_RS_SET;
+	spi_transaction_t wr = {
+		.length = sizeof(tx) * 8,
+		.tx_buffer = tx,
+	};
+	if (spi_device_transmit(spi, &wr) != ESP_OK) {
+		return 0;
+	}
+
+	/* Read back over the bidirectional SDA line: RAMRD, one dummy byte,
+	 * then 18-bit pixels (6 significant bits per byte) */
+	if (LCDSPI_AddDevice(CONFIG_LCD_SPI_READ_KHZ * 1000, SPI_DEVICE_3WIRE | SPI_DEVICE_HALFDUPLEX) != ESP_OK) {
+		ESP_ERROR_CHECK(LCDSPI_AddDevice(spi_clock_hz, 0));
+		return 0;
+	}
+	LCD_SetWindows(0, 0, LCD_TUNE_PIXELS - 1, 0);
+	uint8_t cmd = 0x2E;
+	spi_transaction_t rd = {
+		.length = 8,
+		.tx_buffer = &cmd,
+		.rxlength = sizeof(rx) * 8,
+		.rx_buffer = rx,
+	};
+	LCD_SPI_RS_RESET;
+	if (spi_device_transmit(spi, &rd) != ESP_OK) {
+		ok = 0;
+	}
+	LCD_SPI_RS_SET;
+
+	for (int i = 0; ok && i < LCD_TUNE_PIXELS; i++) {
+		uint16_t c = tx[i * 2] << 8 | tx[i * 2 + 1];
+		const uint8_t *p = &rx[1 + i * 3];
+		if ((p[0] >> 3) != (c >> 11) ||
+				(p[1] >> 2) != ((c >> 5) & 0x3F) ||
+				(p[2] >> 3) != (c & 0x1F)) {
+			ok = 0;
+		}
+	}
+
+	ESP_ERROR_CHECK(LCDSPI_AddDevice(spi_clock_hz, 0));
+	return ok;
+}
+
+/**
+ * @func	LCD_AutoTuneSpiClock
+ * @brief	Find the fastest clock whose GRAM writes read back intact
+ * @param	max_hz: highest clock to try
+ * @retval	Selected clock in Hz (the panel is left running at it)
+ * @note	Overwrites a few pixels of GRAM at (0,0); called from LCD_Init
+ *			before the screen is cleared and before anything else draws.
+*/
+static
+uint32_t LCD_AutoTuneSpiClock(uint32_t max_hz)
+{
+	uint32_t best = 0;
+
+	/* Exact dividers of the 80 MHz source, slowest first; stop at the first
+	 * failure so a marginal clock above a failing one is never picked */
+	for (uint32_t div = 8; div >= 1; div--) {
+		uint32_t hz = LCD_SPI_SRC_HZ / div;
+		int ok = 1;
+
+		if (hz > max_hz) {
 			break;
-		case 3:
-			lcddev.width=LCD_H;
-			lcddev.height=LCD_W;
-			LCD_WriteReg(0x36,(0<<3)|(0<<7)|(1<<6)|(1<<5));//BGR==1,MY==1,MX==0,MV==1
+		}
+		for (uint32_t round = 0; ok && round < LCD_TUNE_ROUNDS; round++) {
+			ok = LCD_ProbeClock(hz, div * LCD_TUNE_ROUNDS + round);
+		}
+		ESP_LOGI(TAG, "SPI probe %lu Hz: %s", (unsigned long)hz, ok ? "ok" : "fail");
+		if (!ok) {
 			break;
+		}
+		best = hz;
+	}
 
-		default:
-			break;
+	if (best == 0) {
+		ESP_LOGW(TAG, "SPI auto-tune found no working clock, keeping %lu Hz", (unsigned long)LCD_SPI_CLOCK_HZ);
+		best = LCD_SPI_CLOCK_HZ;
 	}
+	LCD_SetSpiClock(best);
+	return best;
 }
+#endif
 
 
 /* END FILE */
@@ -0,0 +1,439 @@
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdatomic.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "lcd.h"
+#include "lcd_dma.h"
+#include "lcd_pixel.h"
+#include "lcd_shadow.h"
+#include "metrics.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static const char *TAG = "LCD_DMA";
+
+static uint16_t *dma_band[LCD_DMA_MAX_BANDS];
+static uint32_t dma_band_pixels;
+static uint16_t dma_band_lines;
+static uint8_t dma_bands;
+
+/* Bit i set: band i is free */
+static atomic_uint dma_free;
+static atomic_uint dma_waits;
+
+/* Last resort when no DMA heap is left at init: one line in static DRAM */
+DMA_ATTR static uint16_t dma_reserve[LCD_DMA_LINE_PIXELS];
+
+static metric_t dma_bytes_metric = METRIC_GAUGE_INIT("smartlight_lcd_dma_bytes", NULL,
+		"DMA memory reserved for display bands");
+static metric_t dma_waits_metric = METRIC_COUNTER_INIT("smartlight_lcd_dma_waits_total", NULL,
+		"Band requests that found the pool empty");
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void LCD_DMA_Collect(lcd_dma_stream_t *s, uint8_t i);
+static void LCD_DMA_Send(lcd_dma_stream_t *s, uint8_t i, const uint16_t *buf, uint32_t pixels);
+static void LCD_DMA_Flush(lcd_dma_stream_t *s);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	LCD_DMA_Collect
+ * @brief	Wait until trans[i] of the stream is off the bus
+ * @param	s:	stream
+ *			i:	transaction slot
+ * @retval	None
+ * @note	Results come back in queue order, so an older slot may be
+ *			collected on the way.
+*/
+static
+void LCD_DMA_Collect(lcd_dma_stream_t *s, uint8_t i)
+{
+	spi_transaction_t *t;
+
+	while (s->busy[i]) {
+		if (spi_device_get_trans_result(spi, &t, portMAX_DELAY) != ESP_OK) {
+			s->busy[0] = s->busy[1] = 0;
+			return;
+		}
+		s->busy[t == &s->trans[1]] = 0;
+	}
+}
+
+/**
+ * @func	LCD_DMA_Send
+ * @brief	Queue pixels on transaction slot i
+ * @param	s:		stream
+ *			i:		transaction slot
+ *			buf:	DMA-capable pixels, byte-swapped
+ *			pixels:	count
+ * @retval	None
+*/
+static
+void LCD_DMA_Send(lcd_dma_stream_t *s, uint8_t i, const uint16_t *buf, uint32_t pixels)
+{
+	spi_transaction_t *t = &s->trans[i];
+	esp_err_t ret;
+
+	LCD_DMA_Collect(s, i);
+	memset(t, 0, sizeof(*t));
+	t->length = pixels * 16;
+	t->tx_buffer = buf;
+	ret = spi_device_queue_trans(spi, t, portMAX_DELAY);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "queue %lu pixels: %s", (unsigned long)pixels, esp_err_to_name(ret));
+		return;
+	}
+	s->busy[i] = 1;
+	/* Copied while the bus reads the same band */
+	LCD_SHADOW_Write(buf, pixels);
+}
+
+/**
+ * @func	LCD_DMA_Flush
+ * @brief	Send the current band and switch to the next one
+ * @param	s: stream
+ * @retval	None
+*/
+static
+void LCD_DMA_Flush(lcd_dma_stream_t *s)
+{
+	if (s->fill == 0) {
+		return;
+	}
+	LCD_DMA_Send(s, s->cur, s->buf[s->cur], s->fill);
+	s->fill = 0;
+	s->cur = (s->cur + 1) % s->nbufs;
+	/* The band about to be refilled must be off the bus */
+	LCD_DMA_Collect(s, s->cur);
+}
+
+/**
+ * @func	LCD_DMA_Init
+ * @brief	Reserve the band buffers (called once by LCD_Init)
+ * @param	None
+ * @retval	None
+*/
+void LCD_DMA_Init(void)
+{
+	uint16_t lines = CONFIG_LCD_DMA_BAND_LINES;
+	uint32_t bytes = 0;
+	uint8_t n = 0;
+
+	if (dma_bands != 0) {
+		return;
+	}
+
+	/* Under memory pressure a thinner band beats no band: halve until the
+	 * first one fits, then take as many more of that size as are free */
+	for (; lines > 0; lines /= 2) {
+		bytes = lines * LCD_DMA_LINE_PIXELS * sizeof(uint16_t);
+		dma_band[0] = heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+		if (dma_band[0] != NULL) {
+			break;
+		}
+	}
+	if (dma_band[0] == NULL) {
+		dma_band[0] = dma_reserve;
+		lines = 1;
+		n = 1;
+		ESP_LOGW(TAG, "no DMA heap left, drawing through a one-line static band");
+	} else {
+		for (n = 1; n < CONFIG_LCD_DMA_BANDS; n++) {
+			dma_band[n] = heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+			if (dma_band[n] == NULL) {
+				break;
+			}
+		}
+	}
+
+	dma_band_lines = lines;
+	dma_band_pixels = lines * LCD_DMA_LINE_PIXELS;
+	dma_bands = n;
+	atomic_store(&dma_free, (1u << n) - 1);
+
+	metrics_register(&dma_bytes_metric);
+	metrics_register(&dma_waits_metric);
+	metric_set(&dma_bytes_metric, dma_band[0] == dma_reserve ? 0 : n * bytes);
+
+	if (n < CONFIG_LCD_DMA_BANDS || lines < CONFIG_LCD_DMA_BAND_LINES) {
+		ESP_LOGW(TAG, "%u of %u bands, %u of %u lines each", n, CONFIG_LCD_DMA_BANDS,
+				lines, CONFIG_LCD_DMA_BAND_LINES);
+	} else {
+		ESP_LOGI(TAG, "%u bands of %u lines (%lu bytes)", n, lines, (unsigned long)(n * bytes));
+	}
+}
+
+/**
+ * @func	LCD_DMA_Acquire
+ * @brief	Take a free band from the pool, lock-free
+ * @param	wait:	0 returns -1 at once when the pool is empty, otherwise
+ *					yield until a band is released
+ * @retval	Band index, or -1
+*/
+int LCD_DMA_Acquire(int wait)
+{
+	unsigned int m = atomic_load(&dma_free);
+	int counted = 0;
+
+	while (1) {
+		if (m == 0) {
+			if (!wait) {
+				return -1;
+			}
+			if (!counted) {
+				counted = 1;
+				atomic_fetch_add(&dma_waits, 1);
+				metric_inc(&dma_waits_metric);
+			}
+			vTaskDelay(1);
+			m = atomic_load(&dma_free);
+			continue;
+		}
+		/* Claim the lowest free bit; on a race m is reloaded by the CAS */
+		unsigned int bit = m & -m;
+		if (atomic_compare_exchange_weak(&dma_free, &m, m & ~bit)) {
+			return __builtin_ctz(bit);
+		}
+	}
+}
+
+/**
+ * @func	LCD_DMA_Release
+ * @brief	Give a band back to the pool
+ * @param	band: index returned by LCD_DMA_Acquire
+ * @retval	None
+*/
+void LCD_DMA_Release(int band)
+{
+	if (band >= 0 && band < dma_bands) {
+		atomic_fetch_or(&dma_free, 1u << band);
+	}
+}
+
+/**
+ * @func	LCD_DMA_Band
+ * @brief	Buffer of a band
+ * @param	band:	index returned by LCD_DMA_Acquire
+ *			pixels:	receives the band capacity in pixels (may be NULL)
+ * @retval	DMA-capable buffer
+*/
+uint16_t *LCD_DMA_Band(int band, uint32_t *pixels)
+{
+	if (pixels != NULL) {
+		*pixels = dma_band_pixels;
+	}
+	return dma_band[band];
+}
+
+/**
+ * @func	LCD_DMA_Begin
+ * @brief	Open the window and start a pixel stream into it
+ * @param	s:					stream state, owned by the caller
+ *			x0, y0, x1, y1:		window, already clipped (inclusive)
+ * @retval	None
+*/
+void LCD_DMA_Begin(lcd_dma_stream_t *s, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	int b;
+
+	memset(s, 0, sizeof(*s));
+	b = LCD_DMA_Acquire(1);
+	s->band[0] = b;
+	s->buf[0] = dma_band[b];
+	s->nbufs = 1;
+	/* A second band is a bonus: fill it while the first one is sent */
+	b = LCD_DMA_Acquire(0);
+	if (b >= 0) {
+		s->band[1] = b;
+		s->buf[1] = dma_band[b];
+		s->nbufs = 2;
+	}
+
+	LCD_SetWindows(x0, y0, x1, y1);
+	LCD_SPI_CS_RESET;
+	LCD_SPI_RS_SET;
+}
+
+/**
+ * @func	LCD_DMA_Push
+ * @brief	Append one RGB565 pixel, sending the band when it fills up
+ * @param	s:		stream from LCD_DMA_Begin
+ *			color:	pixel
+ * @retval	None
+*/
+void LCD_DMA_Push(lcd_dma_stream_t *s, uint16_t color)
+{
+	/* A claim may have filled the band to the brim */
+	if (s->fill == dma_band_pixels) {
+		LCD_DMA_Flush(s);
+	}
+	/* The panel takes RGB565 high byte first, the CPU stores it low byte first */
+	s->buf[s->cur][s->fill++] = LCD_PX_SWAP(color);
+	if (s->fill == dma_band_pixels) {
+		LCD_DMA_Flush(s);
+	}
+}
+
+/**
+ * @func	LCD_DMA_PushPixels
+ * @brief	Append n little-endian RGB565 pixels (C arrays, BMP data)
+ * @param	s:		stream from LCD_DMA_Begin
+ *			src:	pixels, any alignment
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_DMA_PushPixels(lcd_dma_stream_t *s, const void *src, uint32_t n)
+{
+	const uint8_t *p = src;
+	uint32_t room;
+
+	while (n > 0) {
+		room = dma_band_pixels - s->fill;
+		if (room > n) {
+			room = n;
+		}
+		LCD_PX_Swap(&s->buf[s->cur][s->fill], p, room);
+		s->fill += room;
+		p += room * sizeof(uint16_t);
+		n -= room;
+		if (s->fill == dma_band_pixels) {
+			LCD_DMA_Flush(s);
+		}
+	}
+}
+
+/**
+ * @func	LCD_DMA_PushFill
+ * @brief	Append n pixels of one color
+ * @param	s:		stream from LCD_DMA_Begin
+ *			color:	RGB565 color
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_DMA_PushFill(lcd_dma_stream_t *s, uint16_t color, uint32_t n)
+{
+	uint16_t v = LCD_PX_SWAP(color);
+	uint32_t room;
+
+	while (n > 0) {
+		room = dma_band_pixels - s->fill;
+		if (room > n) {
+			room = n;
+		}
+		LCD_PX_Fill(&s->buf[s->cur][s->fill], v, room);
+		s->fill += room;
+		n -= room;
+		if (s->fill == dma_band_pixels) {
+			LCD_DMA_Flush(s);
+		}
+	}
+}
+
+/**
+ * @func	LCD_DMA_Claim
+ * @brief	Hand the caller n contiguous pixels of the current band
+ * @param	s:	stream from LCD_DMA_Begin
+ *			n:	pixel count, at most one band
+ * @retval	Pixels to write in panel byte order before the next call on s,
+ *			NULL if n is larger than a band
+ * @note	Sends the band first when it has less than n pixels left, so
+ *			composing straight into the band costs no copy.
+*/
+uint16_t *LCD_DMA_Claim(lcd_dma_stream_t *s, uint32_t n)
+{
+	uint16_t *p;
+
+	if (n > dma_band_pixels) {
+		return NULL;
+	}
+	if (dma_band_pixels - s->fill < n) {
+		LCD_DMA_Flush(s);
+	}
+	p = &s->buf[s->cur][s->fill];
+	s->fill += n;
+	return p;
+}
+
+/**
+ * @func	LCD_DMA_End
+ * @brief	Send what is left, wait for the bus and release the bands
+ * @param	s: stream from LCD_DMA_Begin
+ * @retval	None
+*/
+void LCD_DMA_End(lcd_dma_stream_t *s)
+{
+	LCD_DMA_Flush(s);
+	LCD_DMA_Collect(s, 0);
+	LCD_DMA_Collect(s, 1);
+	LCD_SPI_CS_SET;
+
+	for (uint8_t i = 0; i < s->nbufs; i++) {
+		LCD_DMA_Release(s->band[i]);
+	}
+	s->nbufs = 0;
+}
+
+/**
+ * @func	LCD_DMA_Fill
+ * @brief	Fill a window with one color
+ * @param	x0, y0, x1, y1:	window, already clipped (inclusive)
+ *			color:			RGB565 color
+ * @retval	None
+*/
+void LCD_DMA_Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+	lcd_dma_stream_t s;
+	uint32_t total = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+	uint32_t cap, n, chunk;
+	uint16_t *buf;
+	uint8_t i = 0;
+	int b;
+
+	b = LCD_DMA_Acquire(1);
+	buf = LCD_DMA_Band(b, &cap);
+	n = total < cap ? total : cap;
+	LCD_PX_Fill(buf, LCD_PX_SWAP(color), n);
+
+	memset(&s, 0, sizeof(s));
+	LCD_SetWindows(x0, y0, x1, y1);
+	LCD_SPI_CS_RESET;
+	LCD_SPI_RS_SET;
+	/* The band is only read by DMA, two transactions keep the bus busy */
+	while (total > 0) {
+		chunk = total < n ? total : n;
+		LCD_DMA_Send(&s, i, buf, chunk);
+		total -= chunk;
+		i ^= 1;
+	}
+	LCD_DMA_Collect(&s, 0);
+	LCD_DMA_Collect(&s, 1);
+	LCD_SPI_CS_SET;
+
+	LCD_DMA_Release(b);
+}
+
+/**
+ * @func	LCD_DMA_GetInfo
+ * @brief	Copy the pool layout
+ * @param	info: receives the layout
+ * @retval	None
+*/
+void LCD_DMA_GetInfo(lcd_dma_info_t *info)
+{
+	info->bands = dma_bands;
+	info->lines = dma_band_lines;
+	info->bytes = dma_band[0] == dma_reserve ? 0 : dma_bands * dma_band_pixels * sizeof(uint16_t);
+	info->waits = atomic_load(&dma_waits);
+}
+
+
+/* END FILE */
@@ -0,0 +1,483 @@
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lcd.h"
+#include "lcd_dma.h"
+#include "lcd_font.h"
+#include "lcd_pixel.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Enough for the widest line at the narrowest advance */
+#define LCD_FONT_LINE_GLYPHS	64
+#define LCD_FONT_BENCH_LOOKUPS	1000
+#define LCD_FONT_BENCH_DRAWS	20
+
+/*! @brief A glyph placed on a line */
+typedef struct
+{
+	uint16_t glyph;				/* Index in the font */
+	int16_t pen;				/* Pen x from the left of the line */
+} lcd_font_place_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static const char *TAG = "FONT";
+
+static const struct
+{
+	const char *name;
+	const char *text;
+	uint8_t size;
+} LCD_FONT_BENCH[] = {
+	{ "ascii", "SmartLight 0123456789", 16 },
+	{ "vi", "Điều khiển thiết bị", 16 },
+	{ "cjk", "深圳市全动电子技术", 16 },
+	{ "sans", "SmartLight 0123456789", 15 },
+	{ "sans-vi", "Điều khiển thiết bị", 15 },
+};
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static int8_t LCD_FONT_Kern(const lcd_font_t *font, uint16_t left, uint16_t right);
+static uint16_t LCD_FONT_Layout(const lcd_font_t *font, const uint8_t *text, uint16_t room,
+		lcd_font_place_t *line, uint16_t *n);
+static void LCD_FONT_Compose(const lcd_font_t *font, const lcd_font_place_t *line, uint16_t n,
+		uint16_t *px, uint16_t w, uint16_t r0, uint16_t rows);
+static void LCD_FONT_Send(const lcd_font_t *font, const lcd_font_place_t *line, uint16_t n,
+		uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, uint16_t background);
+static void LCD_FONT_Ink(const lcd_font_t *font, const lcd_font_place_t *line, uint16_t n,
+		uint16_t x, uint16_t y, uint16_t color);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	LCD_UTF8_Next
+ * @brief	Decode the next code point of a UTF-8 string
+ * @param	text:	cursor, advanced past the sequence (not past the end)
+ * @retval	Code point, 0 at the end, LCD_UTF8_INVALID for a bad sequence
+*/
+uint32_t LCD_UTF8_Next(const uint8_t **text)
+{
+	const uint8_t *p = *text;
+	uint32_t c = p[0];
+	uint32_t min;
+	int n;
+
+	if (c < 0x80) {
+		if (c != 0) {
+			*text = p + 1;
+		}
+		return c;
+	}
+	if (c >= 0xC2 && c <= 0xDF) {
+		n = 1, c &= 0x1F, min = 0x80;
+	} else if ((c & 0xF0) == 0xE0) {
+		n = 2, c &= 0x0F, min = 0x800;
+	} else if (c >= 0xF0 && c <= 0xF4) {
+		n = 3, c &= 0x07, min = 0x10000;
+	} else {
+		*text = p + 1;
+		return LCD_UTF8_INVALID;
+	}
+	// A missing continuation byte (including the terminator) ends the sequence
+	for (int i = 1; i <= n; i++) {
+		if ((p[i] & 0xC0) != 0x80) {
+			*text = p + 1;
+			return LCD_UTF8_INVALID;
+		}
+		c = (c << 6) | (p[i] & 0x3F);
+	}
+	*text = p + 1;
+	if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+		return LCD_UTF8_INVALID;
+	}
+	*text = p + 1 + n;
+	return c;
+}
+
+/**
+ * @func	LCD_FONT_ForSize
+ * @brief	Font used for a text size
+ * @param	size:	text size in pixels
+ * @retval	The font
+*/
+const lcd_font_t *LCD_FONT_ForSize(uint8_t size)
+{
+	if (size < 14) {
+		return &LCD_Font12;
+	}
+	return size < 16 ? &LCD_FontSans15 : &LCD_Font16;
+}
+
+/**
+ * @func	LCD_FONT_Find
+ * @brief	Look a code point up: direct for ASCII, binary search otherwise
+ * @param	font:	the font
+ *			code:	Unicode code point
+ * @retval	The glyph, or the fallback glyph
+*/
+const lcd_glyph_t *LCD_FONT_Find(const lcd_font_t *font, uint32_t code)
+{
+	const lcd_glyph_t *g = font->glyphs;
+	uint32_t lo = font->ascii, hi = font->count, mid;
+
+	if (code - 0x20 < font->ascii) {
+		return &g[code - 0x20];
+	}
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (g[mid].code < code) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return (lo < font->count && g[lo].code == code) ? &g[lo] : &g[font->fallback];
+}
+
+/**
+ * @func	LCD_FONT_Kern
+ * @brief	Kerning between two glyphs
+ * @param	font:		the font
+ *			left:		index of the left glyph
+ *			right:		index of the right glyph
+ * @retval	Pixels added to the left glyph's advance
+*/
+static
+int8_t LCD_FONT_Kern(const lcd_font_t *font, uint16_t left, uint16_t right)
+{
+	uint32_t pair = (uint32_t)left << 16 | right;
+	uint32_t lo = 0, hi = font->kern_count, mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (font->kerns[mid].pair < pair) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return (lo < font->kern_count && font->kerns[lo].pair == pair) ? font->kerns[lo].dx : 0;
+}
+
+/**
+ * @func	LCD_FONT_Width
+ * @brief	Width of a UTF-8 string in pixels
+ * @param	text:	UTF-8 string
+ *			size:	text size
+ * @retval	Sum of the advances and kerning
+*/
+uint16_t LCD_FONT_Width(const uint8_t *text, uint8_t size)
+{
+	const lcd_font_t *font = LCD_FONT_ForSize(size);
+	const lcd_glyph_t *g;
+	int32_t width = 0, prev = -1;
+	uint32_t code;
+
+	while ((code = LCD_UTF8_Next(&text)) != 0) {
+		g = LCD_FONT_Find(font, code);
+		if (prev >= 0) {
+			width += LCD_FONT_Kern(font, prev, g - font->glyphs);
+		}
+		width += g->width;
+		prev = g - font->glyphs;
+	}
+	return width;
+}
+
+/**
+ * @func	LCD_FONT_Layout
+ * @brief	Place the glyphs of a string that fit in a width
+ * @param	font:	the font
+ *			text:	UTF-8 string
+ *			room:	width available
+ *			line:	receives LCD_FONT_LINE_GLYPHS placements at most
+ *			n:		receives the number of glyphs placed
+ * @retval	Width used
+*/
+static
+uint16_t LCD_FONT_Layout(const lcd_font_t *font, const uint8_t *text, uint16_t room,
+		lcd_font_place_t *line, uint16_t *n)
+{
+	const lcd_glyph_t *g;
+	int32_t pen = 0, kern;
+	uint32_t code;
+
+	for (*n = 0; *n < LCD_FONT_LINE_GLYPHS && (code = LCD_UTF8_Next(&text)) != 0; (*n)++) {
+		g = LCD_FONT_Find(font, code);
+		kern = *n > 0 ? LCD_FONT_Kern(font, line[*n - 1].glyph, g - font->glyphs) : 0;
+		// Glyphs are drawn whole or not at all
+		if (pen + kern + g->width > room) {
+			break;
+		}
+		pen += kern;
+		line[*n].glyph = g - font->glyphs;
+		line[*n].pen = pen;
+		pen += g->width;
+	}
+	return pen;
+}
+
+/**
+ * @func	LCD_FONT_Compose
+ * @brief	Coverage of a band of rows of a laid-out line
+ * @param	font:	the font
+ *			line:	placements
+ *			n:		number of glyphs
+ *			px:		receives w * rows coverage values (0 .. 2^bpp - 1)
+ *			w:		line width
+ *			r0:		first row of the band
+ *			rows:	rows in the band
+ * @retval	None
+ * @note	Overlapping ink (kerned or overhanging glyphs) keeps the larger
+ *			coverage.
+*/
+static
+void LCD_FONT_Compose(const lcd_font_t *font, const lcd_font_place_t *line, uint16_t n,
+		uint16_t *px, uint16_t w, uint16_t r0, uint16_t rows)
+{
+	const uint8_t bpp = font->bpp, mask = (1u << bpp) - 1;
+	const uint8_t *box, *bits;
+	uint16_t *dst;
+	int32_t bx, X, ra, rb;
+	uint32_t k, v;
+	uint8_t by, bw, bh;
+
+	memset(px, 0, (uint32_t)w * rows * sizeof(uint16_t));
+	for (const lcd_font_place_t *p = line; p < line + n; p++) {
+		box = font->bits + font->glyphs[p->glyph].offset;
+		bx = p->pen + (int8_t)box[0];
+		by = box[1];
+		bw = box[2];
+		bh = box[3];
+		bits = box + 4;
+		ra = by > r0 ? by : r0;
+		rb = by + bh < r0 + rows ? by + bh : r0 + rows;
+		for (int32_t r = ra; r < rb; r++) {
+			dst = px + (r - r0) * w;
+			k = (uint32_t)(r - by) * bw * bpp;
+			for (uint8_t c = 0; c < bw; c++, k += bpp) {
+				X = bx + c;
+				if (X < 0 || X >= w) {
+					continue;
+				}
+				v = (bits[k >> 3] >> (8 - bpp - (k & 7))) & mask;
+				if (v > dst[X]) {
+					dst[X] = v;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @func	LCD_FONT_Send
+ * @brief	Compose a laid-out line into DMA bands and send it
+ * @param	font:		the font
+ *			line:		placements
+ *			n:			number of glyphs
+ *			x, y, w, h:	window, already clipped
+ *			color:		ink color
+ *			background:	window color
+ * @retval	None
+ * @note	Coverage is written straight into the band and turned into
+ *			colors in place, so a line that fits one band is one transaction.
+*/
+static
+void LCD_FONT_Send(const lcd_font_t *font, const lcd_font_place_t *line, uint16_t n,
+		uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, uint16_t background)
+{
+	const uint32_t top = (1u << font->bpp) - 1;
+	int32_t r = background >> 11, g = (background >> 5) & 0x3F, b = background & 0x1F;
+	int32_t dr = (color >> 11) - r, dg = ((color >> 5) & 0x3F) - g, db = (color & 0x1F) - b;
+	uint16_t ramp[16];
+	lcd_dma_info_t info;
+	lcd_dma_stream_t s;
+	uint16_t *px;
+	uint32_t band, rows;
+
+	// Background-to-ink ramp, one entry per coverage level, in panel order
+	for (uint32_t i = 0; i <= top; i++) {
+		ramp[i] = LCD_PX_SWAP((uint16_t)((r + dr * (int32_t)i / (int32_t)top) << 11 |
+				(g + dg * (int32_t)i / (int32_t)top) << 5 | (b + db * (int32_t)i / (int32_t)top)));
+	}
+	LCD_DMA_GetInfo(&info);
+	band = (uint32_t)info.lines * LCD_DMA_LINE_PIXELS / w;
+
+	LCD_DMA_Begin(&s, x, y, x + w - 1, y + h - 1);
+	for (uint16_t r0 = 0; r0 < h; r0 += rows) {
+		rows = h - r0 < band ? h - r0 : band;
+		px = LCD_DMA_Claim(&s, w * rows);
+		LCD_FONT_Compose(font, line, n, px, w, r0, rows);
+		for (uint32_t i = 0; i < w * rows; i++) {
+			px[i] = ramp[px[i]];
+		}
+	}
+	LCD_DMA_End(&s);
+}
+
+/**
+ * @func	LCD_FONT_Ink
+ * @brief	Draw only the ink of a laid-out line, one span at a time
+ * @param	font:	the font
+ *			line:	placements
+ *			n:		number of glyphs
+ *			x, y:	top-left corner of the line
+ *			color:	ink color
+ * @retval	None
+ * @note	Pixels of at least half coverage count as ink.
+*/
+static
+void LCD_FONT_Ink(const lcd_font_t *font, const lcd_font_place_t *line, uint16_t n,
+		uint16_t x, uint16_t y, uint16_t color)
+{
+	const uint8_t bpp = font->bpp, mask = (1u << bpp) - 1, half = 1u << (bpp - 1);
+	const uint8_t *box, *bits;
+	int32_t bx, X, start;
+	uint32_t k;
+	uint8_t by, bw, bh, ink;
+
+	for (const lcd_font_place_t *p = line; p < line + n; p++) {
+		box = font->bits + font->glyphs[p->glyph].offset;
+		bx = x + p->pen + (int8_t)box[0];
+		by = box[1];
+		bw = box[2];
+		bh = box[3];
+		bits = box + 4;
+		k = 0;
+		for (uint8_t r = 0; r < bh; r++) {
+			// c == bw closes the last span of the row
+			start = -1;
+			for (uint8_t c = 0; c <= bw; c++) {
+				X = bx + c;
+				ink = 0;
+				if (c < bw) {
+					ink = X >= 0 && X < lcddev.width &&
+							((bits[k >> 3] >> (8 - bpp - (k & 7))) & mask) >= half;
+					k += bpp;
+				}
+				if (ink && start < 0) {
+					start = X;
+				} else if (!ink && start >= 0) {
+					LCD_DMA_Fill(start, y + by + r, X - 1, y + by + r, color);
+					start = -1;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @func	LCD_FONT_Draw
+ * @brief	Draw a UTF-8 string on one line
+ * @param	x, y:		top-left corner
+ *			color:		ink color
+ *			background:	color under the text (mode 0)
+ *			text:		UTF-8 string
+ *			size:		text size
+ *			mode:		0-opaque, 1-ink only
+ * @retval	x after the last glyph drawn
+*/
+uint16_t LCD_FONT_Draw(uint16_t x, uint16_t y, uint16_t color, uint16_t background,
+		const uint8_t *text, uint8_t size, uint8_t mode)
+{
+	const lcd_font_t *font = LCD_FONT_ForSize(size);
+	lcd_font_place_t line[LCD_FONT_LINE_GLYPHS];
+	uint16_t n, w;
+
+	if (x >= lcddev.width || y + font->height > lcddev.height) {
+		return x;
+	}
+	w = LCD_FONT_Layout(font, text, lcddev.width - x, line, &n);
+	if (n == 0) {
+		return x;
+	}
+	if (!mode) {
+		LCD_FONT_Send(font, line, n, x, y, w, font->height, color, background);
+	} else {
+		LCD_FONT_Ink(font, line, n, x, y, color);
+	}
+	LCD_SetWindows(0, 0, lcddev.width - 1, lcddev.height - 1);
+	return x + w;
+}
+
+/**
+ * @func	LCD_FONT_DrawLine
+ * @brief	Draw a UTF-8 string into a box, replacing everything in it
+ * @param	x, y, w, h:	the box
+ *			color:		ink color
+ *			background:	box color
+ *			text:		UTF-8 string (NULL for an empty box)
+ *			size:		text size
+ * @retval	None
+*/
+void LCD_FONT_DrawLine(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+		uint16_t color, uint16_t background, const uint8_t *text, uint8_t size)
+{
+	const lcd_font_t *font = LCD_FONT_ForSize(size);
+	lcd_font_place_t line[LCD_FONT_LINE_GLYPHS];
+	uint16_t n = 0;
+
+	if (x >= lcddev.width || y >= lcddev.height || w == 0 || h == 0) {
+		return;
+	}
+	if (x + w > lcddev.width) {
+		w = lcddev.width - x;
+	}
+	if (y + h > lcddev.height) {
+		h = lcddev.height - y;
+	}
+	if (text != NULL) {
+		LCD_FONT_Layout(font, text, w, line, &n);
+	}
+	LCD_FONT_Send(font, line, n, x, y, w, h, color, background);
+	LCD_SetWindows(0, 0, lcddev.width - 1, lcddev.height - 1);
+}
+
+/**
+ * @func	LCD_FONT_Bench
+ * @brief	Log lookup and drawing throughput for ASCII, Vietnamese and CJK text
+ * @param	None
+ * @retval	None
+*/
+void LCD_FONT_Bench(void)
+{
+	const uint8_t *text, *p;
+	uint32_t glyphs, lookup, draw;
+	uint8_t size;
+	int64_t t0;
+
+	for (size_t i = 0; i < sizeof(LCD_FONT_BENCH) / sizeof(LCD_FONT_BENCH[0]); i++) {
+		text = (const uint8_t *)LCD_FONT_BENCH[i].text;
+		size = LCD_FONT_BENCH[i].size;
+		for (glyphs = 0, p = text; LCD_UTF8_Next(&p) != 0; glyphs++) {
+		}
+
+		// Decode + lookup + kerning only
+		t0 = esp_timer_get_time();
+		for (int k = 0; k < LCD_FONT_BENCH_LOOKUPS; k++) {
+			LCD_FONT_Width(text, size);
+		}
+		lookup = (uint32_t)((esp_timer_get_time() - t0) * 1000 / LCD_FONT_BENCH_LOOKUPS / glyphs);
+
+		// Layout + compose + bus, one transaction per line
+		t0 = esp_timer_get_time();
+		for (int k = 0; k < LCD_FONT_BENCH_DRAWS; k++) {
+			LCD_FONT_Draw(0, 0, WHITE, BLACK, text, size, 0);
+		}
+		draw = (uint32_t)((esp_timer_get_time() - t0) / LCD_FONT_BENCH_DRAWS);
+
+		ESP_LOGI(TAG, "%-7s %2lu glyphs, %u px wide: %lu ns/glyph lookup, %lu us/line drawn (%lu glyphs/s)",
+				LCD_FONT_BENCH[i].name, (unsigned long)glyphs, LCD_FONT_Width(text, size),
+				(unsigned long)lookup, (unsigned long)draw,
+				(unsigned long)(draw ? glyphs * 1000000UL / draw : 0));
+	}
+}
+
+
+/* END FILE */
@@ -0,0 +1,165 @@
+/* Sinh bởi utils/font2c.py từ smartlight12.bdf, không sửa tay:
+ *   python font2c.py ../assets/fonts/smartlight12.bdf -n LCD_Font12 -o ../components/lcd/lcd_font12.c
+ */
+#include "lcd_font.h"
+
+static const lcd_glyph_t lcd_font12_glyphs[95] = {
+	{ 0x0020,     0,  6 },
+	{ 0x0021,     4,  6 },	/* ! */
+	{ 0x0022,     9,  6 },	/* " */
+	{ 0x0023,    15,  6 },	/* # */
+	{ 0x0024,    25,  6 },	/* $ */
+	{ 0x0025,    36,  6 },	/* % */
+	{ 0x0026,    46,  6 },	/* & */
+	{ 0x0027,    56,  6 },	/* ' */
+	{ 0x0028,    61,  6 },	/* ( */
+	{ 0x0029,    69,  6 },	/* ) */
+	{ 0x002A,    77,  6 },	/* * */
+	{ 0x002B,    85,  6 },	/* + */
+	{ 0x002C,    94,  6 },	/* , */
+	{ 0x002D,    99,  6 },	/* - */
+	{ 0x002E,   104,  6 },	/* . */
+	{ 0x002F,   109,  6 },	/* / */
+	{ 0x0030,   120,  6 },	/* 0 */
+	{ 0x0031,   129,  6 },	/* 1 */
+	{ 0x0032,   136,  6 },	/* 2 */
+	{ 0x0033,   145,  6 },	/* 3 */
+	{ 0x0034,   154,  6 },	/* 4 */
+	{ 0x0035,   163,  6 },	/* 5 */
+	{ 0x0036,   172,  6 },	/* 6 */
+	{ 0x0037,   181,  6 },	/* 7 */
+	{ 0x0038,   190,  6 },	/* 8 */
+	{ 0x0039,   199,  6 },	/* 9 */
+	{ 0x003A,   208,  6 },	/* : */
+	{ 0x003B,   213,  6 },	/* ; */
+	{ 0x003C,   218,  6 },	/* < */
+	{ 0x003D,   228,  6 },	/* = */
+	{ 0x003E,   235,  6 },	/* > */
+	{ 0x003F,   245,  6 },	/* ? */
+	{ 0x0040,   254,  6 },	/* @ */
+	{ 0x0041,   263,  6 },	/* A */
+	{ 0x0042,   273,  6 },	/* B */
+	{ 0x0043,   282,  6 },	/* C */
+	{ 0x0044,   291,  6 },	/* D */
+	{ 0x0045,   300,  6 },	/* E */
+	{ 0x0046,   309,  6 },	/* F */
+	{ 0x0047,   318,  6 },	/* G */
+	{ 0x0048,   328,  6 },	/* H */
+	{ 0x0049,   338,  6 },	/* I */
+	{ 0x004A,   347,  6 },	/* J */
+	{ 0x004B,   358,  6 },	/* K */
+	{ 0x004C,   368,  6 },	/* L */
+	{ 0x004D,   378,  6 },	/* M */
+	{ 0x004E,   387,  6 },	/* N */
+	{ 0x004F,   397,  6 },	/* O */
+	{ 0x0050,   406,  6 },	/* P */
+	{ 0x0051,   415,  6 },	/* Q */
+	{ 0x0052,   425,  6 },	/* R */
+	{ 0x0053,   435,  6 },	/* S */
+	{ 0x0054,   444,  6 },	/* T */
+	{ 0x0055,   453,  6 },	/* U */
+	{ 0x0056,   463,  6 },	/* V */
+	{ 0x0057,   473,  6 },	/* W */
+	{ 0x0058,   482,  6 },	/* X */
+	{ 0x0059,   491,  6 },	/* Y */
+	{ 0x005A,   500,  6 },	/* Z */
+	{ 0x005B,   509,  6 },	/* [ */
+	{ 0x005C,   517,  6 },
+	{ 0x005D,   526,  6 },	/* ] */
+	{ 0x005E,   534,  6 },	/* ^ */
+	{ 0x005F,   539,  6 },	/* _ */
+	{ 0x0060,   544,  6 },	/* ` */
+	{ 0x0061,   549,  6 },	/* a */
+	{ 0x0062,   557,  6 },	/* b */
+	{ 0x0063,   566,  6 },	/* c */
+	{ 0x0064,   573,  6 },	/* d */
+	{ 0x0065,   582,  6 },	/* e */
+	{ 0x0066,   589,  6 },	/* f */
+	{ 0x0067,   598,  6 },	/* g */
+	{ 0x0068,   607,  6 },	/* h */
+	{ 0x0069,   617,  6 },	/* i */
+	{ 0x006A,   624,  6 },	/* j */
+	{ 0x006B,   633,  6 },	/* k */
+	{ 0x006C,   643,  6 },	/* l */
+	{ 0x006D,   652,  6 },	/* m */
+	{ 0x006E,   660,  6 },	/* n */
+	{ 0x006F,   668,  6 },	/* o */
+	{ 0x0070,   675,  6 },	/* p */
+	{ 0x0071,   684,  6 },	/* q */
+	{ 0x0072,   693,  6 },	/* r */
+	{ 0x0073,   701,  6 },	/* s */
+	{ 0x0074,   708,  6 },	/* t */
+	{ 0x0075,   716,  6 },	/* u */
+	{ 0x0076,   724,  6 },	/* v */
+	{ 0x0077,   732,  6 },	/* w */
+	{ 0x0078,   740,  6 },	/* x */
+	{ 0x0079,   748,  6 },	/* y */
+	{ 0x007A,   758,  6 },	/* z */
+	{ 0x007B,   765,  6 },	/* { */
+	{ 0x007C,   773,  6 },	/* | */
+	{ 0x007D,   779,  6 },	/* } */
+	{ 0x007E,   787,  6 },	/* ~ */
+};
+
+static const uint8_t lcd_font12_bits[794] = {
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x08, 0xFD, 0x01, 0x01, 0x04, 0x03, 0x5A, 0xA0, 0x00,
+	0x02, 0x06, 0x08, 0x28, 0xAF, 0xCA, 0x53, 0xF5, 0x14, 0x00, 0x01, 0x05, 0x0A, 0x23, 0xEB, 0x46,
+	0x18, 0xB5, 0xF1, 0x00, 0x00, 0x02, 0x06, 0x08, 0x4A, 0xAB, 0x14, 0x28, 0xD5, 0x52, 0x00, 0x02,
+	0x06, 0x08, 0x21, 0x45, 0x1E, 0xAA, 0xA9, 0x1B, 0x00, 0x01, 0x02, 0x03, 0x58, 0x03, 0x01, 0x03,
+	0x0A, 0x2A, 0x49, 0x24, 0x44, 0x01, 0x01, 0x03, 0x0A, 0x88, 0x92, 0x49, 0x50, 0x00, 0x03, 0x05,
+	0x06, 0x25, 0x5C, 0xEA, 0x90, 0x00, 0x02, 0x05, 0x07, 0x21, 0x09, 0xF2, 0x10, 0x80, 0x00, 0x09,
+	0x02, 0x03, 0x58, 0x00, 0x05, 0x05, 0x01, 0xF8, 0x01, 0x09, 0x01, 0x01, 0x80, 0x00, 0x01, 0x05,
+	0x0A, 0x08, 0x84, 0x22, 0x11, 0x08, 0x44, 0x00, 0x00, 0x02, 0x05, 0x08, 0x74, 0x63, 0x18, 0xC6,
+	0x2E, 0x01, 0x02, 0x03, 0x08, 0x59, 0x24, 0x97, 0x00, 0x02, 0x05, 0x08, 0x74, 0x62, 0x22, 0x22,
+	0x1F, 0x00, 0x02, 0x05, 0x08, 0x74, 0x42, 0x60, 0x86, 0x2E, 0x00, 0x02, 0x05, 0x08, 0x11, 0x94,
+	0xA9, 0x3C, 0x43, 0x00, 0x02, 0x05, 0x08, 0xFC, 0x21, 0xE0, 0x86, 0x2E, 0x00, 0x02, 0x05, 0x08,
+	0x74, 0xA1, 0xE8, 0xC6, 0x2E, 0x00, 0x02, 0x05, 0x08, 0xFC, 0x84, 0x42, 0x10, 0x84, 0x00, 0x02,
+	0x05, 0x08, 0x74, 0x62, 0xE8, 0xC6, 0x2E, 0x00, 0x02, 0x05, 0x08, 0x74, 0x63, 0x17, 0x85, 0x2E,
+	0x02, 0x04, 0x01, 0x06, 0x84, 0x02, 0x05, 0x01, 0x06, 0x8C, 0x01, 0x01, 0x05, 0x09, 0x08, 0x88,
+	0x88, 0x20, 0x82, 0x08, 0x00, 0x04, 0x05, 0x04, 0xF8, 0x01, 0xF0, 0x01, 0x01, 0x05, 0x09, 0x82,
+	0x08, 0x20, 0x88, 0x88, 0x80, 0x00, 0x02, 0x05, 0x08, 0x74, 0x62, 0x22, 0x10, 0x04, 0x00, 0x02,
+	0x05, 0x08, 0x74, 0x67, 0x5A, 0xDE, 0x0F, 0x00, 0x02, 0x06, 0x08, 0x20, 0x83, 0x14, 0x51, 0xE4,
+	0xB3, 0x00, 0x02, 0x05, 0x08, 0xF2, 0x52, 0xE4, 0xA5, 0x3E, 0x00, 0x02, 0x05, 0x08, 0x7C, 0x61,
+	0x08, 0x42, 0x2E, 0x00, 0x02, 0x05, 0x08, 0xF2, 0x52, 0x94, 0xA5, 0x3E, 0x00, 0x02, 0x05, 0x08,
+	0xFA, 0x54, 0xE5, 0x21, 0x3F, 0x00, 0x02, 0x05, 0x08, 0xFA, 0x54, 0xE5, 0x21, 0x1C, 0x00, 0x02,
+	0x06, 0x08, 0x39, 0x28, 0x20, 0x9E, 0x24, 0x8C, 0x00, 0x02, 0x06, 0x08, 0xCD, 0x24, 0x9E, 0x49,
+	0x24, 0xB3, 0x00, 0x02, 0x05, 0x08, 0xF9, 0x08, 0x42, 0x10, 0x9F, 0x00, 0x02, 0x06, 0x09, 0x7C,
+	0x41, 0x04, 0x10, 0x41, 0x24, 0xE0, 0x00, 0x02, 0x06, 0x08, 0xED, 0x25, 0x18, 0x51, 0x44, 0xBB,
+	0x00, 0x02, 0x06, 0x08, 0xE1, 0x04, 0x10, 0x41, 0x04, 0x7F, 0x00, 0x02, 0x05, 0x08, 0xDE, 0xF7,
+	0xBA, 0xD6, 0xB5, 0x00, 0x02, 0x06, 0x08, 0xDD, 0x26, 0x9A, 0x59, 0x64, 0xBA, 0x00, 0x02, 0x05,
+	0x08, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x00, 0x02, 0x05, 0x08, 0xF2, 0x52, 0xE4, 0x21, 0x1C, 0x00,
+	0x02, 0x05, 0x09, 0x74, 0x63, 0x18, 0xF6, 0x6E, 0x18, 0x00, 0x02, 0x06, 0x08, 0xF1, 0x24, 0x9C,
+	0x51, 0x24, 0xBB, 0x00, 0x02, 0x05, 0x08, 0x7C, 0x60, 0xC1, 0x06, 0x3E, 0x00, 0x02, 0x05, 0x08,
+	0xFD, 0x48, 0x42, 0x10, 0x8E, 0x00, 0x02, 0x06, 0x08, 0xCD, 0x24, 0x92, 0x49, 0x24, 0x8C, 0x00,
+	0x02, 0x06, 0x08, 0xCD, 0x24, 0x94, 0x50, 0xC2, 0x08, 0x00, 0x02, 0x05, 0x08, 0xAD, 0x6A, 0xE5,
+	0x29, 0x4A, 0x00, 0x02, 0x05, 0x08, 0xDA, 0x94, 0x42, 0x29, 0x5B, 0x00, 0x02, 0x05, 0x08, 0xDA,
+	0x94, 0x42, 0x10, 0x8E, 0x00, 0x02, 0x05, 0x08, 0xFC, 0x84, 0x42, 0x21, 0x3F, 0x02, 0x01, 0x03,
+	0x0A, 0xF2, 0x49, 0x24, 0x9C, 0x01, 0x01, 0x04, 0x09, 0x88, 0x84, 0x42, 0x22, 0x10, 0x01, 0x01,
+	0x03, 0x0A, 0xE4, 0x92, 0x49, 0x3C, 0x01, 0x01, 0x03, 0x02, 0x54, 0x00, 0x0B, 0x06, 0x01, 0xFC,
+	0x02, 0x01, 0x01, 0x01, 0x80, 0x01, 0x05, 0x05, 0x05, 0x64, 0x9D, 0x27, 0x80, 0x00, 0x02, 0x05,
+	0x08, 0xC2, 0x10, 0xE4, 0xA5, 0x2E, 0x01, 0x05, 0x04, 0x05, 0x79, 0x88, 0x70, 0x01, 0x02, 0x05,
+	0x08, 0x30, 0x84, 0xE9, 0x4A, 0x4F, 0x01, 0x05, 0x04, 0x05, 0x69, 0xF8, 0x70, 0x01, 0x02, 0x05,
+	0x08, 0x3A, 0x11, 0xE4, 0x21, 0x1E, 0x01, 0x05, 0x05, 0x07, 0x7C, 0x99, 0x0F, 0x45, 0xC0, 0x00,
+	0x02, 0x06, 0x08, 0xC1, 0x04, 0x1C, 0x49, 0x24, 0xBB, 0x01, 0x02, 0x03, 0x08, 0x40, 0x64, 0x97,
+	0x00, 0x02, 0x04, 0x0A, 0x10, 0x03, 0x11, 0x11, 0x1E, 0x00, 0x02, 0x06, 0x08, 0xC1, 0x04, 0x17,
+	0x51, 0xC4, 0xBB, 0x00, 0x02, 0x05, 0x08, 0xE1, 0x08, 0x42, 0x10, 0x9F, 0x00, 0x05, 0x05, 0x05,
+	0xF5, 0x6B, 0x5A, 0x80, 0x00, 0x05, 0x06, 0x05, 0xF1, 0x24, 0x92, 0xEC, 0x01, 0x05, 0x04, 0x05,
+	0x69, 0x99, 0x60, 0x00, 0x05, 0x05, 0x07, 0xF2, 0x52, 0x97, 0x23, 0x80, 0x01, 0x05, 0x05, 0x07,
+	0x74, 0xA5, 0x27, 0x08, 0xE0, 0x00, 0x05, 0x05, 0x05, 0xDB, 0x10, 0x8E, 0x00, 0x01, 0x05, 0x04,
+	0x05, 0xF8, 0x61, 0xF0, 0x01, 0x03, 0x04, 0x07, 0x44, 0xE4, 0x44, 0x30, 0x00, 0x05, 0x06, 0x05,
+	0xD9, 0x24, 0x92, 0x3C, 0x00, 0x05, 0x06, 0x05, 0xED, 0x25, 0x0C, 0x20, 0x00, 0x05, 0x05, 0x05,
+	0xAD, 0x5C, 0xA5, 0x00, 0x00, 0x05, 0x05, 0x05, 0xDA, 0x88, 0xAD, 0x80, 0x00, 0x05, 0x06, 0x07,
+	0xED, 0x25, 0x0C, 0x20, 0x8C, 0x00, 0x01, 0x05, 0x04, 0x05, 0xF2, 0x44, 0xF0, 0x02, 0x01, 0x03,
+	0x0A, 0x69, 0x28, 0x92, 0x4C, 0x03, 0x00, 0x01, 0x0C, 0xFF, 0xF0, 0x01, 0x01, 0x03, 0x0A, 0xC9,
+	0x22, 0x92, 0x58, 0x00, 0x00, 0x06, 0x03, 0x42, 0x91, 0x80,
+};
+
+const lcd_font_t LCD_Font12 = {
+	.height = 12,
+	.bpp = 1,
+	.ascii = 95,
+	.count = 95,
+	.fallback = 31,
+	.glyphs = lcd_font12_glyphs,
+	.bits = lcd_font12_bits,
+};
@@ -0,0 +1,626 @@
+/* Sinh bởi utils/font2c.py từ smartlight16.bdf, không sửa tay:
+ *   python font2c.py ../assets/fonts/smartlight16.bdf -n LCD_Font16 -o ../components/lcd/lcd_font16.c
+ */
+#include "lcd_font.h"
+
+static const lcd_glyph_t lcd_font16_glyphs[292] = {
+	{ 0x0020,     0,  8 },
+	{ 0x0021,     4,  8 },	/* ! */
+	{ 0x0022,    11,  8 },	/* " */
+	{ 0x0023,    18,  8 },	/* # */
+	{ 0x0024,    32,  8 },	/* $ */
+	{ 0x0025,    45,  8 },	/* % */
+	{ 0x0026,    59,  8 },	/* & */
+	{ 0x0027,    74,  8 },	/* ' */
+	{ 0x0028,    80,  8 },	/* ( */
+	{ 0x0029,    91,  8 },	/* ) */
+	{ 0x002A,   102,  8 },	/* * */
+	{ 0x002B,   113,  8 },	/* + */
+	{ 0x002C,   125,  8 },	/* , */
+	{ 0x002D,   131,  8 },	/* - */
+	{ 0x002E,   136,  8 },	/* . */
+	{ 0x002F,   141,  8 },	/* / */
+	{ 0x0030,   157,  8 },	/* 0 */
+	{ 0x0031,   170,  8 },	/* 1 */
+	{ 0x0032,   181,  8 },	/* 2 */
+	{ 0x0033,   194,  8 },	/* 3 */
+	{ 0x0034,   207,  8 },	/* 4 */
+	{ 0x0035,   220,  8 },	/* 5 */
+	{ 0x0036,   233,  8 },	/* 6 */
+	{ 0x0037,   246,  8 },	/* 7 */
+	{ 0x0038,   259,  8 },	/* 8 */
+	{ 0x0039,   272,  8 },	/* 9 */
+	{ 0x003A,   285,  8 },	/* : */
+	{ 0x003B,   291,  8 },	/* ; */
+	{ 0x003C,   298,  8 },	/* < */
+	{ 0x003D,   311,  8 },	/* = */
+	{ 0x003E,   320,  8 },	/* > */
+	{ 0x003F,   333,  8 },	/* ? */
+	{ 0x0040,   346,  8 },	/* @ */
+	{ 0x0041,   360,  8 },	/* A */
+	{ 0x0042,   375,  8 },	/* B */
+	{ 0x0043,   389,  8 },	/* C */
+	{ 0x0044,   403,  8 },	/* D */
+	{ 0x0045,   417,  8 },	/* E */
+	{ 0x0046,   431,  8 },	/* F */
+	{ 0x0047,   445,  8 },	/* G */
+	{ 0x0048,   459,  8 },	/* H */
+	{ 0x0049,   474,  8 },	/* I */
+	{ 0x004A,   485,  8 },	/* J */
+	{ 0x004B,   501,  8 },	/* K */
+	{ 0x004C,   515,  8 },	/* L */
+	{ 0x004D,   529,  8 },	/* M */
+	{ 0x004E,   543,  8 },	/* N */
+	{ 0x004F,   558,  8 },	/* O */
+	{ 0x0050,   572,  8 },	/* P */
+	{ 0x0051,   586,  8 },	/* Q */
+	{ 0x0052,   601,  8 },	/* R */
+	{ 0x0053,   616,  8 },	/* S */
+	{ 0x0054,   629,  8 },	/* T */
+	{ 0x0055,   643,  8 },	/* U */
+	{ 0x0056,   658,  8 },	/* V */
+	{ 0x0057,   673,  8 },	/* W */
+	{ 0x0058,   687,  8 },	/* X */
+	{ 0x0059,   702,  8 },	/* Y */
+	{ 0x005A,   716,  8 },	/* Z */
+	{ 0x005B,   730,  8 },	/* [ */
+	{ 0x005C,   741,  8 },
+	{ 0x005D,   756,  8 },	/* ] */
+	{ 0x005E,   767,  8 },	/* ^ */
+	{ 0x005F,   773,  8 },	/* _ */
+	{ 0x0060,   778,  8 },	/* ` */
+	{ 0x0061,   783,  8 },	/* a */
+	{ 0x0062,   794,  8 },	/* b */
+	{ 0x0063,   808,  8 },	/* c */
+	{ 0x0064,   818,  8 },	/* d */
+	{ 0x0065,   832,  8 },	/* e */
+	{ 0x0066,   842,  8 },	/* f */
+	{ 0x0067,   856,  8 },	/* g */
+	{ 0x0068,   867,  8 },	/* h */
+	{ 0x0069,   882,  8 },	/* i */
+	{ 0x006A,   893,  8 },	/* j */
+	{ 0x006B,   906,  8 },	/* k */
+	{ 0x006C,   920,  8 },	/* l */
+	{ 0x006D,   931,  8 },	/* m */
+	{ 0x006E,   942,  8 },	/* n */
+	{ 0x006F,   953,  8 },	/* o */
+	{ 0x0070,   963,  8 },	/* p */
+	{ 0x0071,   975,  8 },	/* q */
+	{ 0x0072,   987,  8 },	/* r */
+	{ 0x0073,   998,  8 },	/* s */
+	{ 0x0074,  1008,  8 },	/* t */
+	{ 0x0075,  1018,  8 },	/* u */
+	{ 0x0076,  1029,  8 },	/* v */
+	{ 0x0077,  1040,  8 },	/* w */
+	{ 0x0078,  1051,  8 },	/* x */
+	{ 0x0079,  1061,  8 },	/* y */
+	{ 0x007A,  1074,  8 },	/* z */
+	{ 0x007B,  1084,  8 },	/* { */
+	{ 0x007C,  1095,  8 },	/* | */
+	{ 0x007D,  1101,  8 },	/* } */
+	{ 0x007E,  1112,  8 },	/* ~ */
+	{ 0x00C0,  1119,  8 },	/* À */
+	{ 0x00C1,  1136,  8 },	/* Á */
+	{ 0x00C2,  1153,  8 },	/* Â */
+	{ 0x00C3,  1170,  8 },	/* Ã */
+	{ 0x00C8,  1187,  8 },	/* È */
+	{ 0x00C9,  1203,  8 },	/* É */
+	{ 0x00CA,  1219,  8 },	/* Ê */
+	{ 0x00CC,  1235,  8 },	/* Ì */
+	{ 0x00CD,  1248,  8 },	/* Í */
+	{ 0x00D2,  1261,  8 },	/* Ò */
+	{ 0x00D3,  1277,  8 },	/* Ó */
+	{ 0x00D4,  1293,  8 },	/* Ô */
+	{ 0x00D5,  1309,  8 },	/* Õ */
+	{ 0x00D9,  1325,  8 },	/* Ù */
+	{ 0x00DA,  1342,  8 },	/* Ú */
+	{ 0x00DD,  1359,  8 },	/* Ý */
+	{ 0x00E0,  1375,  8 },	/* à */
+	{ 0x00E1,  1387,  8 },	/* á */
+	{ 0x00E2,  1399,  8 },	/* â */
+	{ 0x00E3,  1411,  8 },	/* ã */
+	{ 0x00E8,  1423,  8 },	/* è */
+	{ 0x00E9,  1434,  8 },	/* é */
+	{ 0x00EA,  1445,  8 },	/* ê */
+	{ 0x00EC,  1456,  8 },	/* ì */
+	{ 0x00ED,  1466,  8 },	/* í */
+	{ 0x00F2,  1476,  8 },	/* ò */
+	{ 0x00F3,  1487,  8 },	/* ó */
+	{ 0x00F4,  1498,  8 },	/* ô */
+	{ 0x00F5,  1509,  8 },	/* õ */
+	{ 0x00F9,  1520,  8 },	/* ù */
+	{ 0x00FA,  1533,  8 },	/* ú */
+	{ 0x00FD,  1546,  8 },	/* ý */
+	{ 0x0102,  1561,  8 },	/* Ă */
+	{ 0x0103,  1578,  8 },	/* ă */
+	{ 0x0110,  1590,  8 },	/* Đ */
+	{ 0x0111,  1604,  8 },	/* đ */
+	{ 0x0128,  1618,  8 },	/* Ĩ */
+	{ 0x0129,  1631,  8 },	/* ĩ */
+	{ 0x0168,  1641,  8 },	/* Ũ */
+	{ 0x0169,  1658,  8 },	/* ũ */
+	{ 0x01A0,  1671,  8 },	/* Ơ */
+	{ 0x01A1,  1687,  8 },	/* ơ */
+	{ 0x01AF,  1698,  8 },	/* Ư */
+	{ 0x01B0,  1714,  8 },	/* ư */
+	{ 0x1EA0,  1726,  8 },	/* Ạ */
+	{ 0x1EA1,  1742,  8 },	/* ạ */
+	{ 0x1EA2,  1753,  8 },	/* Ả */
+	{ 0x1EA3,  1771,  8 },	/* ả */
+	{ 0x1EA4,  1784,  8 },	/* Ấ */
+	{ 0x1EA5,  1802,  8 },	/* ấ */
+	{ 0x1EA6,  1816,  8 },	/* Ầ */
+	{ 0x1EA7,  1834,  8 },	/* ầ */
+	{ 0x1EA8,  1848,  8 },	/* Ẩ */
+	{ 0x1EA9,  1866,  8 },	/* ẩ */
+	{ 0x1EAA,  1881,  8 },	/* Ẫ */
+	{ 0x1EAB,  1899,  8 },	/* ẫ */
+	{ 0x1EAC,  1913,  8 },	/* Ậ */
+	{ 0x1EAD,  1931,  8 },	/* ậ */
+	{ 0x1EAE,  1944,  8 },	/* Ắ */
+	{ 0x1EAF,  1962,  8 },	/* ắ */
+	{ 0x1EB0,  1976,  8 },	/* Ằ */
+	{ 0x1EB1,  1994,  8 },	/* ằ */
+	{ 0x1EB2,  2008,  8 },	/* Ẳ */
+	{ 0x1EB3,  2026,  8 },	/* ẳ */
+	{ 0x1EB4,  2041,  8 },	/* Ẵ */
+	{ 0x1EB5,  2059,  8 },	/* ẵ */
+	{ 0x1EB6,  2073,  8 },	/* Ặ */
+	{ 0x1EB7,  2091,  8 },	/* ặ */
+	{ 0x1EB8,  2104,  8 },	/* Ẹ */
+	{ 0x1EB9,  2119,  8 },	/* ẹ */
+	{ 0x1EBA,  2129,  8 },	/* Ẻ */
+	{ 0x1EBB,  2146,  8 },	/* ẻ */
+	{ 0x1EBC,  2158,  8 },	/* Ẽ */
+	{ 0x1EBD,  2174,  8 },	/* ẽ */
+	{ 0x1EBE,  2185,  8 },	/* Ế */
+	{ 0x1EBF,  2203,  8 },	/* ế */
+	{ 0x1EC0,  2216,  8 },	/* Ề */
+	{ 0x1EC1,  2234,  8 },	/* ề */
+	{ 0x1EC2,  2247,  8 },	/* Ể */
+	{ 0x1EC3,  2265,  8 },	/* ể */
+	{ 0x1EC4,  2278,  8 },	/* Ễ */
+	{ 0x1EC5,  2296,  8 },	/* ễ */
+	{ 0x1EC6,  2309,  8 },	/* Ệ */
+	{ 0x1EC7,  2326,  8 },	/* ệ */
+	{ 0x1EC8,  2338,  8 },	/* Ỉ */
+	{ 0x1EC9,  2351,  8 },	/* ỉ */
+	{ 0x1ECA,  2362,  8 },	/* Ị */
+	{ 0x1ECB,  2374,  8 },	/* ị */
+	{ 0x1ECC,  2383,  8 },	/* Ọ */
+	{ 0x1ECD,  2398,  8 },	/* ọ */
+	{ 0x1ECE,  2408,  8 },	/* Ỏ */
+	{ 0x1ECF,  2425,  8 },	/* ỏ */
+	{ 0x1ED0,  2437,  8 },	/* Ố */
+	{ 0x1ED1,  2455,  8 },	/* ố */
+	{ 0x1ED2,  2468,  8 },	/* Ồ */
+	{ 0x1ED3,  2486,  8 },	/* ồ */
+	{ 0x1ED4,  2499,  8 },	/* Ổ */
+	{ 0x1ED5,  2517,  8 },	/* ổ */
+	{ 0x1ED6,  2530,  8 },	/* Ỗ */
+	{ 0x1ED7,  2548,  8 },	/* ỗ */
+	{ 0x1ED8,  2561,  8 },	/* Ộ */
+	{ 0x1ED9,  2578,  8 },	/* ộ */
+	{ 0x1EDA,  2590,  8 },	/* Ớ */
+	{ 0x1EDB,  2607,  8 },	/* ớ */
+	{ 0x1EDC,  2619,  8 },	/* Ờ */
+	{ 0x1EDD,  2636,  8 },	/* ờ */
+	{ 0x1EDE,  2648,  8 },	/* Ở */
+	{ 0x1EDF,  2666,  8 },	/* ở */
+	{ 0x1EE0,  2679,  8 },	/* Ỡ */
+	{ 0x1EE1,  2696,  8 },	/* ỡ */
+	{ 0x1EE2,  2708,  8 },	/* Ợ */
+	{ 0x1EE3,  2725,  8 },	/* ợ */
+	{ 0x1EE4,  2737,  8 },	/* Ụ */
+	{ 0x1EE5,  2753,  8 },	/* ụ */
+	{ 0x1EE6,  2765,  8 },	/* Ủ */
+	{ 0x1EE7,  2783,  8 },	/* ủ */
+	{ 0x1EE8,  2797,  8 },	/* Ứ */
+	{ 0x1EE9,  2814,  8 },	/* ứ */
+	{ 0x1EEA,  2827,  8 },	/* Ừ */
+	{ 0x1EEB,  2844,  8 },	/* ừ */
+	{ 0x1EEC,  2857,  8 },	/* Ử */
+	{ 0x1EED,  2875,  8 },	/* ử */
+	{ 0x1EEE,  2889,  8 },	/* Ữ */
+	{ 0x1EEF,  2906,  8 },	/* ữ */
+	{ 0x1EF0,  2919,  8 },	/* Ự */
+	{ 0x1EF1,  2936,  8 },	/* ự */
+	{ 0x1EF2,  2949,  8 },	/* Ỳ */
+	{ 0x1EF3,  2965,  8 },	/* ỳ */
+	{ 0x1EF4,  2980,  8 },	/* Ỵ */
+	{ 0x1EF5,  2995,  8 },	/* ỵ */
+	{ 0x1EF6,  3008,  8 },	/* Ỷ */
+	{ 0x1EF7,  3025,  8 },	/* ỷ */
+	{ 0x1EF8,  3041,  8 },	/* Ỹ */
+	{ 0x1EF9,  3057,  8 },	/* ỹ */
+	{ 0x4E2D,  3072, 16 },	/* 中 */
+	{ 0x4EAE,  3099, 16 },	/* 亮 */
+	{ 0x5145,  3130, 16 },	/* 充 */
+	{ 0x5149,  3161, 16 },	/* 光 */
+	{ 0x5168,  3192, 16 },	/* 全 */
+	{ 0x516C,  3223, 16 },	/* 公 */
+	{ 0x51C6,  3256, 16 },	/* 准 */
+	{ 0x52A8,  3290, 16 },	/* 动 */
+	{ 0x5355,  3319, 16 },	/* 单 */
+	{ 0x53F8,  3350, 16 },	/* 司 */
+	{ 0x5408,  3377, 16 },	/* 合 */
+	{ 0x56FE,  3406, 16 },	/* 图 */
+	{ 0x5706,  3435, 16 },	/* 圆 */
+	{ 0x5733,  3464, 16 },	/* 圳 */
+	{ 0x586B,  3496, 16 },	/* 填 */
+	{ 0x5B50,  3525, 16 },	/* 子 */
+	{ 0x5C4F,  3554, 16 },	/* 屏 */
+	{ 0x5E02,  3585, 16 },	/* 市 */
+	{ 0x5E55,  3615, 16 },	/* 幕 */
+	{ 0x5E8F,  3649, 16 },	/* 序 */
+	{ 0x5EA6,  3678, 16 },	/* 度 */
+	{ 0x5F00,  3709, 16 },	/* 开 */
+	{ 0x5F62,  3742, 16 },	/* 形 */
+	{ 0x60A8,  3771, 16 },	/* 您 */
+	{ 0x6240,  3805, 16 },	/* 所 */
+	{ 0x6280,  3834, 16 },	/* 技 */
+	{ 0x6309,  3868, 16 },	/* 按 */
+	{ 0x6478,  3902, 16 },	/* 摸 */
+	{ 0x6587,  3936, 16 },	/* 文 */
+	{ 0x65CB,  3969, 16 },	/* 旋 */
+	{ 0x663E,  4003, 16 },	/* 显 */
+	{ 0x6676,  4032, 16 },	/* 晶 */
+	{ 0x6709,  4062, 16 },	/* 有 */
+	{ 0x672F,  4096, 16 },	/* 术 */
+	{ 0x6743,  4130, 16 },	/* 权 */
+	{ 0x6821,  4161, 16 },	/* 校 */
+	{ 0x6B22,  4195, 16 },	/* 欢 */
+	{ 0x6D4B,  4229, 16 },	/* 测 */
+	{ 0x6DB2,  4260, 16 },	/* 液 */
+	{ 0x6DF1,  4294, 16 },	/* 深 */
+	{ 0x6E90,  4327, 16 },	/* 源 */
+	{ 0x7247,  4360, 16 },	/* 片 */
+	{ 0x7248,  4391, 16 },	/* 版 */
+	{ 0x7535,  4420, 16 },	/* 电 */
+	{ 0x753B,  4451, 16 },	/* 画 */
+	{ 0x77E9,  4480, 16 },	/* 矩 */
+	{ 0x793A,  4509, 16 },	/* 示 */
+	{ 0x7A0B,  4538, 16 },	/* 程 */
+	{ 0x7AD9,  4567, 16 },	/* 站 */
+	{ 0x7EAF,  4601, 16 },	/* 纯 */
+	{ 0x7EFC,  4632, 16 },	/* 综 */
+	{ 0x7F51,  4661, 16 },	/* 网 */
+	{ 0x8272,  4690, 16 },	/* 色 */
+	{ 0x82F1,  4719, 16 },	/* 英 */
+	{ 0x83DC,  4748, 16 },	/* 菜 */
+	{ 0x89E6,  4779, 16 },	/* 触 */
+	{ 0x8BD5,  4813, 16 },	/* 试 */
+	{ 0x8C03,  4842, 16 },	/* 调 */
+	{ 0x8F6C,  4873, 16 },	/* 转 */
+	{ 0x8FCE,  4907, 16 },	/* 迎 */
+	{ 0x952E,  4938, 16 },	/* 键 */
+	{ 0x9650,  4971, 16 },	/* 限 */
+	{ 0xFFFD,  5002,  8 },
+};
+
+static const uint8_t lcd_font16_bits[5015] = {
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x02, 0x0B, 0xAA, 0xA8, 0x3C, 0x01, 0x01, 0x06, 0x04, 0x25,
+	0xB4, 0xA4, 0x00, 0x03, 0x07, 0x0B, 0x24, 0x48, 0x97, 0xF4, 0x89, 0x12, 0x7F, 0x48, 0x91, 0x20,
+	0x01, 0x02, 0x05, 0x0E, 0x23, 0xAB, 0x5A, 0x30, 0xC5, 0x2D, 0x6A, 0xE2, 0x10, 0x00, 0x03, 0x07,
+	0x0B, 0x45, 0x4A, 0xA5, 0x4A, 0x8A, 0x86, 0x95, 0x2A, 0x55, 0x10, 0x00, 0x03, 0x08, 0x0B, 0x30,
+	0x48, 0x48, 0x48, 0x50, 0x6E, 0xA4, 0x94, 0x88, 0x89, 0x76, 0x00, 0x01, 0x03, 0x04, 0x6C, 0xE0,
+	0x03, 0x01, 0x04, 0x0E, 0x12, 0x44, 0x88, 0x88, 0x88, 0x44, 0x21, 0x01, 0x01, 0x04, 0x0E, 0x84,
+	0x22, 0x11, 0x11, 0x11, 0x22, 0x48, 0x00, 0x04, 0x07, 0x08, 0x10, 0x23, 0x59, 0xC3, 0x9A, 0xC4,
+	0x08, 0x00, 0x04, 0x07, 0x09, 0x10, 0x20, 0x40, 0x8F, 0xE2, 0x04, 0x08, 0x10, 0x00, 0x0C, 0x03,
+	0x04, 0x6C, 0xE0, 0x01, 0x08, 0x07, 0x01, 0xFE, 0x01, 0x0C, 0x02, 0x02, 0xF0, 0x01, 0x02, 0x07,
+	0x0D, 0x02, 0x08, 0x10, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x04, 0x08, 0x00, 0x01, 0x03, 0x06,
+	0x0B, 0x31, 0x28, 0x61, 0x86, 0x18, 0x61, 0x85, 0x23, 0x00, 0x01, 0x03, 0x05, 0x0B, 0x27, 0x08,
+	0x42, 0x10, 0x84, 0x21, 0x3E, 0x01, 0x03, 0x06, 0x0B, 0x7A, 0x18, 0x61, 0x08, 0x21, 0x08, 0x42,
+	0x1F, 0xC0, 0x01, 0x03, 0x06, 0x0B, 0x7A, 0x18, 0x42, 0x30, 0x20, 0x41, 0x86, 0x27, 0x00, 0x01,
+	0x03, 0x06, 0x0B, 0x08, 0x62, 0x92, 0x4A, 0x28, 0xBF, 0x08, 0x23, 0xC0, 0x01, 0x03, 0x06, 0x0B,
+	0xFE, 0x08, 0x20, 0xB3, 0x20, 0x41, 0x86, 0x27, 0x00, 0x01, 0x03, 0x06, 0x0B, 0x39, 0x28, 0x20,
+	0xB3, 0x28, 0x61, 0x85, 0x23, 0x00, 0x01, 0x03, 0x06, 0x0B, 0xFE, 0x28, 0x84, 0x10, 0x82, 0x08,
+	0x20, 0x82, 0x00, 0x01, 0x03, 0x06, 0x0B, 0x7A, 0x18, 0x61, 0x48, 0xC4, 0xA1, 0x86, 0x17, 0x80,
+	0x01, 0x03, 0x06, 0x0B, 0x31, 0x28, 0x61, 0x85, 0x33, 0x41, 0x05, 0x27, 0x00, 0x03, 0x06, 0x02,
+	0x08, 0xF0, 0x0F, 0x02, 0x07, 0x02, 0x09, 0x40, 0x05, 0x80, 0x01, 0x03, 0x06, 0x0B, 0x04, 0x21,
+	0x08, 0x42, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x06, 0x07, 0x05, 0xFE, 0x00, 0x00, 0x0F, 0xE0,
+	0x01, 0x03, 0x06, 0x0B, 0x81, 0x02, 0x04, 0x08, 0x10, 0x84, 0x21, 0x08, 0x00, 0x01, 0x03, 0x06,
+	0x0B, 0x7A, 0x18, 0x71, 0x04, 0x21, 0x04, 0x00, 0xC3, 0x00, 0x00, 0x03, 0x07, 0x0B, 0x38, 0x89,
+	0x6D, 0x5A, 0xB5, 0x6A, 0xDA, 0x42, 0x88, 0xE0, 0x00, 0x03, 0x08, 0x0B, 0x10, 0x10, 0x18, 0x28,
+	0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x00, 0x03, 0x07, 0x0B, 0xF8, 0x89, 0x12, 0x27, 0x88,
+	0x90, 0xA1, 0x42, 0x8B, 0xE0, 0x00, 0x03, 0x07, 0x0B, 0x3E, 0x85, 0x0C, 0x08, 0x10, 0x20, 0x40,
+	0x42, 0x88, 0xE0, 0x00, 0x03, 0x07, 0x0B, 0xF8, 0x89, 0x0A, 0x14, 0x28, 0x50, 0xA1, 0x42, 0x8B,
+	0xE0, 0x00, 0x03, 0x07, 0x0B, 0xFC, 0x85, 0x22, 0x47, 0x89, 0x12, 0x20, 0x42, 0x87, 0xF0, 0x00,
+	0x03, 0x07, 0x0B, 0xFC, 0x85, 0x22, 0x47, 0x89, 0x12, 0x20, 0x40, 0x83, 0x80, 0x00, 0x03, 0x07,
+	0x0B, 0x3C, 0x89, 0x14, 0x08, 0x10, 0x23, 0xC2, 0x44, 0x88, 0xE0, 0x00, 0x03, 0x08, 0x0B, 0xE7,
+	0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0xE7, 0x01, 0x03, 0x05, 0x0B, 0xF9, 0x08,
+	0x42, 0x10, 0x84, 0x21, 0x3E, 0x00, 0x03, 0x07, 0x0D, 0x3E, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04,
+	0x08, 0x10, 0x24, 0x4F, 0x00, 0x00, 0x03, 0x07, 0x0B, 0xEE, 0x89, 0x22, 0x87, 0x0A, 0x12, 0x24,
+	0x44, 0x8B, 0xB8, 0x00, 0x03, 0x07, 0x0B, 0xE0, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x87,
+	0xF8, 0x00, 0x03, 0x07, 0x0B, 0xEE, 0xD9, 0xB3, 0x66, 0xCA, 0x95, 0x2A, 0x54, 0xAB, 0x58, 0x00,
+	0x03, 0x08, 0x0B, 0xC7, 0x62, 0x62, 0x52, 0x52, 0x4A, 0x4A, 0x4A, 0x46, 0x46, 0xE2, 0x00, 0x03,
+	0x07, 0x0B, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x82, 0x88, 0xE0, 0x00, 0x03, 0x07, 0x0B,
+	0xFC, 0x85, 0x0A, 0x14, 0x2F, 0x90, 0x20, 0x40, 0x83, 0x80, 0x00, 0x03, 0x07, 0x0C, 0x38, 0x8A,
+	0x0C, 0x18, 0x30, 0x60, 0xD9, 0xCA, 0x98, 0xE0, 0x30, 0x00, 0x03, 0x08, 0x0B, 0xFC, 0x42, 0x42,
+	0x42, 0x7C, 0x48, 0x48, 0x44, 0x44, 0x42, 0xE3, 0x01, 0x03, 0x06, 0x0B, 0x7E, 0x18, 0x60, 0x40,
+	0xC0, 0x81, 0x86, 0x1F, 0x80, 0x00, 0x03, 0x07, 0x0B, 0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x08,
+	0x10, 0x20, 0xE0, 0x00, 0x03, 0x08, 0x0B, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+	0x42, 0x3C, 0x00, 0x03, 0x08, 0x0B, 0xE7, 0x42, 0x42, 0x44, 0x24, 0x24, 0x28, 0x28, 0x18, 0x10,
+	0x10, 0x00, 0x03, 0x07, 0x0B, 0xD7, 0x26, 0x4C, 0x99, 0x35, 0x6A, 0xB6, 0x44, 0x89, 0x10, 0x00,
+	0x03, 0x08, 0x0B, 0xE7, 0x42, 0x24, 0x24, 0x18, 0x18, 0x18, 0x24, 0x24, 0x42, 0xE7, 0x00, 0x03,
+	0x07, 0x0B, 0xEE, 0x89, 0x11, 0x42, 0x82, 0x04, 0x08, 0x10, 0x20, 0xE0, 0x00, 0x03, 0x07, 0x0B,
+	0x7F, 0x08, 0x10, 0x40, 0x82, 0x08, 0x10, 0x42, 0x87, 0xF0, 0x03, 0x01, 0x04, 0x0E, 0xF8, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x8F, 0x01, 0x02, 0x06, 0x0E, 0x82, 0x04, 0x10, 0x20, 0x82, 0x04, 0x10,
+	0x20, 0x82, 0x04, 0x10, 0x01, 0x01, 0x04, 0x0E, 0xF1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F, 0x02,
+	0x01, 0x05, 0x02, 0x74, 0x40, 0x00, 0x0F, 0x08, 0x01, 0xFF, 0x01, 0x01, 0x03, 0x02, 0xC4, 0x01,
+	0x07, 0x07, 0x07, 0x79, 0x08, 0xF2, 0x28, 0x50, 0x9F, 0x80, 0x00, 0x03, 0x07, 0x0B, 0xC0, 0x81,
+	0x02, 0x05, 0x8C, 0x90, 0xA1, 0x42, 0xC9, 0x60, 0x01, 0x07, 0x06, 0x07, 0x39, 0x18, 0x20, 0x81,
+	0x13, 0x80, 0x01, 0x03, 0x07, 0x0B, 0x0C, 0x08, 0x10, 0x23, 0xC8, 0xA1, 0x42, 0x84, 0x98, 0xD8,
+	0x01, 0x07, 0x06, 0x07, 0x7A, 0x1F, 0xE0, 0x82, 0x17, 0x80, 0x01, 0x03, 0x07, 0x0B, 0x1E, 0x44,
+	0x81, 0x0F, 0xC4, 0x08, 0x10, 0x20, 0x43, 0xE0, 0x01, 0x07, 0x06, 0x09, 0x7E, 0x28, 0x9C, 0x81,
+	0xE8, 0x61, 0x78, 0x00, 0x03, 0x08, 0x0B, 0xC0, 0x40, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x42,
+	0x42, 0xE7, 0x01, 0x03, 0x05, 0x0B, 0x63, 0x00, 0x0E, 0x10, 0x84, 0x21, 0x3E, 0x01, 0x03, 0x05,
+	0x0D, 0x18, 0xC0, 0x03, 0x84, 0x21, 0x08, 0x43, 0x1F, 0x00, 0x00, 0x03, 0x07, 0x0B, 0xC0, 0x81,
+	0x02, 0x04, 0xE9, 0x14, 0x34, 0x48, 0x8B, 0xB8, 0x01, 0x03, 0x05, 0x0B, 0xE1, 0x08, 0x42, 0x10,
+	0x84, 0x21, 0x3E, 0x00, 0x07, 0x08, 0x07, 0xFE, 0x49, 0x49, 0x49, 0x49, 0x49, 0xED, 0x00, 0x07,
+	0x08, 0x07, 0xDC, 0x62, 0x42, 0x42, 0x42, 0x42, 0xE7, 0x01, 0x07, 0x06, 0x07, 0x7A, 0x18, 0x61,
+	0x86, 0x17, 0x80, 0x00, 0x07, 0x07, 0x09, 0xD8, 0xC9, 0x0A, 0x14, 0x28, 0x9E, 0x20, 0xE0, 0x01,
+	0x07, 0x07, 0x09, 0x3C, 0x8A, 0x14, 0x28, 0x48, 0x8F, 0x02, 0x0E, 0x00, 0x07, 0x07, 0x07, 0xEE,
+	0x64, 0x81, 0x02, 0x04, 0x3E, 0x00, 0x01, 0x07, 0x06, 0x07, 0x7E, 0x18, 0x1E, 0x06, 0x1F, 0x80,
+	0x01, 0x05, 0x05, 0x09, 0x21, 0x3E, 0x42, 0x10, 0x84, 0x18, 0x00, 0x07, 0x08, 0x07, 0xC6, 0x42,
+	0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x07, 0x08, 0x07, 0xE7, 0x42, 0x24, 0x24, 0x28, 0x10, 0x10,
+	0x00, 0x07, 0x08, 0x07, 0xD7, 0x92, 0x92, 0xAA, 0xAA, 0x44, 0x44, 0x01, 0x07, 0x06, 0x07, 0xDD,
+	0x23, 0x0C, 0x31, 0x2E, 0xC0, 0x00, 0x07, 0x08, 0x09, 0xE7, 0x42, 0x24, 0x24, 0x28, 0x18, 0x10,
+	0x10, 0xE0, 0x01, 0x07, 0x06, 0x07, 0xFE, 0x21, 0x08, 0x21, 0x1F, 0xC0, 0x04, 0x01, 0x04, 0x0E,
+	0x34, 0x44, 0x44, 0x84, 0x44, 0x44, 0x43, 0x04, 0x00, 0x01, 0x10, 0xFF, 0xFF, 0x01, 0x01, 0x04,
+	0x0E, 0xC2, 0x22, 0x22, 0x12, 0x22, 0x22, 0x2C, 0x01, 0x00, 0x07, 0x03, 0x61, 0x32, 0x18, 0x00,
+	0x01, 0x08, 0x0D, 0x10, 0x08, 0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7,
+	0x00, 0x01, 0x08, 0x0D, 0x08, 0x10, 0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42,
+	0xE7, 0x00, 0x01, 0x08, 0x0D, 0x10, 0x28, 0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42,
+	0x42, 0xE7, 0x00, 0x01, 0x08, 0x0D, 0x14, 0x28, 0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44,
+	0x42, 0x42, 0xE7, 0x00, 0x01, 0x07, 0x0D, 0x20, 0x23, 0xF2, 0x14, 0x89, 0x1E, 0x24, 0x48, 0x81,
+	0x0A, 0x1F, 0xC0, 0x00, 0x01, 0x07, 0x0D, 0x10, 0x43, 0xF2, 0x14, 0x89, 0x1E, 0x24, 0x48, 0x81,
+	0x0A, 0x1F, 0xC0, 0x00, 0x01, 0x07, 0x0D, 0x10, 0x53, 0xF2, 0x14, 0x89, 0x1E, 0x24, 0x48, 0x81,
+	0x0A, 0x1F, 0xC0, 0x01, 0x01, 0x05, 0x0D, 0x41, 0x3E, 0x42, 0x10, 0x84, 0x21, 0x08, 0x4F, 0x80,
+	0x01, 0x01, 0x05, 0x0D, 0x22, 0x3E, 0x42, 0x10, 0x84, 0x21, 0x08, 0x4F, 0x80, 0x00, 0x01, 0x07,
+	0x0D, 0x20, 0x20, 0xE2, 0x28, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0A, 0x23, 0x80, 0x00, 0x01, 0x07,
+	0x0D, 0x10, 0x40, 0xE2, 0x28, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0A, 0x23, 0x80, 0x00, 0x01, 0x07,
+	0x0D, 0x10, 0x50, 0xE2, 0x28, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0A, 0x23, 0x80, 0x00, 0x01, 0x07,
+	0x0D, 0x14, 0x50, 0xE2, 0x28, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0A, 0x23, 0x80, 0x00, 0x01, 0x08,
+	0x0D, 0x10, 0x08, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x01,
+	0x08, 0x0D, 0x08, 0x10, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00,
+	0x01, 0x07, 0x0D, 0x10, 0x43, 0xBA, 0x24, 0x45, 0x0A, 0x08, 0x10, 0x20, 0x40, 0x83, 0x80, 0x01,
+	0x05, 0x07, 0x09, 0x10, 0x11, 0xE4, 0x23, 0xC8, 0xA1, 0x42, 0x7E, 0x01, 0x05, 0x07, 0x09, 0x08,
+	0x21, 0xE4, 0x23, 0xC8, 0xA1, 0x42, 0x7E, 0x01, 0x05, 0x07, 0x09, 0x10, 0x51, 0xE4, 0x23, 0xC8,
+	0xA1, 0x42, 0x7E, 0x01, 0x05, 0x07, 0x09, 0x28, 0xA1, 0xE4, 0x23, 0xC8, 0xA1, 0x42, 0x7E, 0x01,
+	0x05, 0x06, 0x09, 0x20, 0x47, 0xA1, 0xFE, 0x08, 0x21, 0x78, 0x01, 0x05, 0x06, 0x09, 0x10, 0x87,
+	0xA1, 0xFE, 0x08, 0x21, 0x78, 0x01, 0x05, 0x06, 0x09, 0x21, 0x47, 0xA1, 0xFE, 0x08, 0x21, 0x78,
+	0x01, 0x05, 0x05, 0x09, 0x41, 0x38, 0x42, 0x10, 0x84, 0xF8, 0x01, 0x05, 0x05, 0x09, 0x22, 0x38,
+	0x42, 0x10, 0x84, 0xF8, 0x01, 0x05, 0x06, 0x09, 0x20, 0x47, 0xA1, 0x86, 0x18, 0x61, 0x78, 0x01,
+	0x05, 0x06, 0x09, 0x10, 0x87, 0xA1, 0x86, 0x18, 0x61, 0x78, 0x01, 0x05, 0x06, 0x09, 0x21, 0x47,
+	0xA1, 0x86, 0x18, 0x61, 0x78, 0x01, 0x05, 0x06, 0x09, 0x29, 0x47, 0xA1, 0x86, 0x18, 0x61, 0x78,
+	0x00, 0x05, 0x08, 0x09, 0x10, 0x08, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x05, 0x08,
+	0x09, 0x08, 0x10, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x05, 0x08, 0x0B, 0x08, 0x10,
+	0xE7, 0x42, 0x24, 0x24, 0x28, 0x18, 0x10, 0x10, 0xE0, 0x00, 0x01, 0x08, 0x0D, 0x24, 0x18, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x05, 0x07, 0x09, 0x48, 0x61,
+	0xE4, 0x23, 0xC8, 0xA1, 0x42, 0x7E, 0x00, 0x03, 0x07, 0x0B, 0xF8, 0x89, 0x0A, 0x14, 0x3C, 0x50,
+	0xA1, 0x42, 0x8B, 0xE0, 0x01, 0x03, 0x07, 0x0B, 0x0C, 0x3C, 0x10, 0x23, 0xC8, 0xA1, 0x42, 0x84,
+	0x98, 0xD8, 0x01, 0x01, 0x05, 0x0D, 0x2A, 0xBE, 0x42, 0x10, 0x84, 0x21, 0x08, 0x4F, 0x80, 0x01,
+	0x05, 0x05, 0x09, 0x2A, 0xB8, 0x42, 0x10, 0x84, 0xF8, 0x00, 0x01, 0x08, 0x0D, 0x14, 0x28, 0xE7,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x05, 0x08, 0x09, 0x14, 0x28,
+	0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x02, 0x08, 0x0C, 0x03, 0x3A, 0x44, 0x82, 0x82,
+	0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x01, 0x06, 0x07, 0x08, 0x06, 0xFA, 0x14, 0x28, 0x50,
+	0xA1, 0x3C, 0x00, 0x02, 0x08, 0x0C, 0x03, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+	0x42, 0x3C, 0x00, 0x06, 0x08, 0x08, 0x03, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x03,
+	0x08, 0x0C, 0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x08, 0x01, 0x07,
+	0x07, 0x08, 0x79, 0x08, 0xF2, 0x28, 0x50, 0x9F, 0x88, 0x00, 0x00, 0x08, 0x0E, 0x18, 0x08, 0x10,
+	0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x04, 0x07, 0x0A, 0x18,
+	0x10, 0x43, 0xC8, 0x47, 0x91, 0x42, 0x84, 0xFC, 0x00, 0x00, 0x08, 0x0E, 0x01, 0x22, 0x50, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x03, 0x07, 0x0B, 0x08, 0x20,
+	0x41, 0x47, 0x90, 0x8F, 0x22, 0x85, 0x09, 0xF8, 0x00, 0x00, 0x08, 0x0E, 0x02, 0x21, 0x50, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x03, 0x07, 0x0B, 0x10, 0x10,
+	0x41, 0x47, 0x90, 0x8F, 0x22, 0x85, 0x09, 0xF8, 0x00, 0x00, 0x08, 0x0E, 0x03, 0x21, 0x50, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x02, 0x07, 0x0C, 0x18, 0x10,
+	0x40, 0x82, 0x8F, 0x21, 0x1E, 0x45, 0x0A, 0x13, 0xF0, 0x00, 0x00, 0x08, 0x0E, 0x01, 0x22, 0x50,
+	0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x03, 0x07, 0x0B, 0x28,
+	0xA0, 0x41, 0x47, 0x90, 0x8F, 0x22, 0x85, 0x09, 0xF8, 0x00, 0x01, 0x08, 0x0E, 0x10, 0x28, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x08, 0x01, 0x05, 0x07, 0x0A, 0x10,
+	0x51, 0xE4, 0x23, 0xC8, 0xA1, 0x42, 0x7E, 0x20, 0x00, 0x00, 0x08, 0x0E, 0x01, 0x4A, 0x30, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x03, 0x07, 0x0B, 0x08, 0x21,
+	0x21, 0x87, 0x90, 0x8F, 0x22, 0x85, 0x09, 0xF8, 0x00, 0x00, 0x08, 0x0E, 0x02, 0x49, 0x30, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x03, 0x07, 0x0B, 0x10, 0x11,
+	0x21, 0x87, 0x90, 0x8F, 0x22, 0x85, 0x09, 0xF8, 0x00, 0x00, 0x08, 0x0E, 0x03, 0x49, 0x30, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x02, 0x07, 0x0C, 0x18, 0x10,
+	0x42, 0x43, 0x0F, 0x21, 0x1E, 0x45, 0x0A, 0x13, 0xF0, 0x00, 0x00, 0x08, 0x0E, 0x01, 0x4A, 0x30,
+	0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x01, 0x03, 0x07, 0x0B, 0x28,
+	0xA1, 0x21, 0x87, 0x90, 0x8F, 0x22, 0x85, 0x09, 0xF8, 0x00, 0x01, 0x08, 0x0E, 0x24, 0x18, 0x10,
+	0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, 0x08, 0x01, 0x05, 0x07, 0x0A, 0x48,
+	0x61, 0xE4, 0x23, 0xC8, 0xA1, 0x42, 0x7E, 0x20, 0x00, 0x03, 0x07, 0x0C, 0xFC, 0x85, 0x22, 0x47,
+	0x89, 0x12, 0x20, 0x42, 0x87, 0xF0, 0x80, 0x01, 0x07, 0x06, 0x08, 0x7A, 0x1F, 0xE0, 0x82, 0x17,
+	0x84, 0x00, 0x00, 0x07, 0x0E, 0x30, 0x20, 0x87, 0xE4, 0x29, 0x12, 0x3C, 0x48, 0x91, 0x02, 0x14,
+	0x3F, 0x80, 0x01, 0x04, 0x06, 0x0A, 0x30, 0x42, 0x1E, 0x87, 0xF8, 0x20, 0x85, 0xE0, 0x00, 0x01,
+	0x07, 0x0D, 0x14, 0x53, 0xF2, 0x14, 0x89, 0x1E, 0x24, 0x48, 0x81, 0x0A, 0x1F, 0xC0, 0x01, 0x05,
+	0x06, 0x09, 0x29, 0x47, 0xA1, 0xFE, 0x08, 0x21, 0x78, 0x00, 0x00, 0x08, 0x0E, 0x01, 0x22, 0x50,
+	0xFC, 0x42, 0x48, 0x48, 0x78, 0x48, 0x48, 0x40, 0x42, 0x42, 0xFC, 0x01, 0x03, 0x06, 0x0B, 0x10,
+	0x82, 0x14, 0x7A, 0x1F, 0xE0, 0x82, 0x17, 0x80, 0x00, 0x00, 0x08, 0x0E, 0x02, 0x21, 0x50, 0xFC,
+	0x42, 0x48, 0x48, 0x78, 0x48, 0x48, 0x40, 0x42, 0x42, 0xFC, 0x01, 0x03, 0x06, 0x0B, 0x20, 0x42,
+	0x14, 0x7A, 0x1F, 0xE0, 0x82, 0x17, 0x80, 0x00, 0x00, 0x08, 0x0E, 0x03, 0x21, 0x50, 0xFC, 0x42,
+	0x48, 0x48, 0x78, 0x48, 0x48, 0x40, 0x42, 0x42, 0xFC, 0x01, 0x02, 0x06, 0x0C, 0x30, 0x42, 0x08,
+	0x51, 0xE8, 0x7F, 0x82, 0x08, 0x5E, 0x00, 0x00, 0x08, 0x0E, 0x01, 0x22, 0x50, 0xFC, 0x42, 0x48,
+	0x48, 0x78, 0x48, 0x48, 0x40, 0x42, 0x42, 0xFC, 0x01, 0x03, 0x06, 0x0B, 0x29, 0x42, 0x14, 0x7A,
+	0x1F, 0xE0, 0x82, 0x17, 0x80, 0x00, 0x01, 0x07, 0x0E, 0x10, 0x53, 0xF2, 0x14, 0x89, 0x1E, 0x24,
+	0x48, 0x81, 0x0A, 0x1F, 0xC2, 0x00, 0x01, 0x05, 0x06, 0x0A, 0x21, 0x47, 0xA1, 0xFE, 0x08, 0x21,
+	0x78, 0x40, 0x01, 0x00, 0x05, 0x0E, 0x61, 0x11, 0xF2, 0x10, 0x84, 0x21, 0x08, 0x42, 0x7C, 0x01,
+	0x04, 0x05, 0x0A, 0x61, 0x11, 0xC2, 0x10, 0x84, 0x27, 0xC0, 0x01, 0x03, 0x05, 0x0C, 0xF9, 0x08,
+	0x42, 0x10, 0x84, 0x21, 0x3E, 0x40, 0x01, 0x07, 0x05, 0x08, 0xE1, 0x08, 0x42, 0x13, 0xE4, 0x00,
+	0x03, 0x07, 0x0C, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x82, 0x88, 0xE0, 0x80, 0x01, 0x07,
+	0x06, 0x08, 0x7A, 0x18, 0x61, 0x86, 0x17, 0x84, 0x00, 0x00, 0x07, 0x0E, 0x30, 0x20, 0x81, 0xC4,
+	0x50, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x14, 0x47, 0x00, 0x01, 0x04, 0x06, 0x0A, 0x30, 0x42, 0x1E,
+	0x86, 0x18, 0x61, 0x85, 0xE0, 0x00, 0x00, 0x08, 0x0E, 0x01, 0x22, 0x50, 0x38, 0x44, 0x82, 0x82,
+	0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x01, 0x03, 0x06, 0x0B, 0x10, 0x82, 0x14, 0x7A, 0x18,
+	0x61, 0x86, 0x17, 0x80, 0x00, 0x00, 0x08, 0x0E, 0x02, 0x21, 0x50, 0x38, 0x44, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x01, 0x03, 0x06, 0x0B, 0x20, 0x42, 0x14, 0x7A, 0x18, 0x61,
+	0x86, 0x17, 0x80, 0x00, 0x00, 0x08, 0x0E, 0x03, 0x21, 0x50, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x82, 0x44, 0x38, 0x01, 0x02, 0x06, 0x0C, 0x30, 0x42, 0x08, 0x51, 0xE8, 0x61, 0x86,
+	0x18, 0x5E, 0x00, 0x00, 0x08, 0x0E, 0x01, 0x22, 0x50, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x44, 0x38, 0x01, 0x03, 0x06, 0x0B, 0x29, 0x42, 0x14, 0x7A, 0x18, 0x61, 0x86, 0x17,
+	0x80, 0x00, 0x01, 0x07, 0x0E, 0x10, 0x50, 0xE2, 0x28, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0A, 0x23,
+	0x82, 0x00, 0x01, 0x05, 0x06, 0x0A, 0x21, 0x47, 0xA1, 0x86, 0x18, 0x61, 0x78, 0x40, 0x00, 0x01,
+	0x08, 0x0D, 0x10, 0x23, 0x3A, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x01,
+	0x05, 0x07, 0x09, 0x10, 0x4D, 0xF4, 0x28, 0x50, 0xA1, 0x42, 0x78, 0x00, 0x01, 0x08, 0x0D, 0x20,
+	0x13, 0x3A, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x01, 0x05, 0x07, 0x09,
+	0x20, 0x2D, 0xF4, 0x28, 0x50, 0xA1, 0x42, 0x78, 0x00, 0x00, 0x08, 0x0E, 0x30, 0x10, 0x23, 0x3A,
+	0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x01, 0x04, 0x07, 0x0A, 0x30, 0x20,
+	0x9B, 0xE8, 0x50, 0xA1, 0x42, 0x84, 0xF0, 0x00, 0x01, 0x08, 0x0D, 0x14, 0x2B, 0x3A, 0x44, 0x82,
+	0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x01, 0x05, 0x07, 0x09, 0x28, 0xAD, 0xF4, 0x28,
+	0x50, 0xA1, 0x42, 0x78, 0x00, 0x02, 0x08, 0x0D, 0x03, 0x3A, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x44, 0x38, 0x10, 0x01, 0x06, 0x07, 0x09, 0x06, 0xFA, 0x14, 0x28, 0x50, 0xA1, 0x3C,
+	0x10, 0x00, 0x03, 0x08, 0x0C, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C,
+	0x08, 0x00, 0x07, 0x08, 0x08, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x08, 0x00, 0x00, 0x08,
+	0x0E, 0x18, 0x08, 0x10, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00,
+	0x04, 0x08, 0x0A, 0x18, 0x08, 0x10, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x01, 0x08,
+	0x0D, 0x08, 0x13, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x05,
+	0x08, 0x09, 0x08, 0x13, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x01, 0x08, 0x0D, 0x10,
+	0x0B, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x05, 0x08, 0x09,
+	0x10, 0x0B, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x00, 0x08, 0x0E, 0x18, 0x08, 0x13,
+	0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x04, 0x08, 0x0A, 0x18,
+	0x08, 0x13, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x01, 0x08, 0x0D, 0x14, 0x2B, 0xE7,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x05, 0x08, 0x09, 0x14, 0x2B,
+	0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, 0x00, 0x02, 0x08, 0x0D, 0x03, 0xE7, 0x42, 0x42, 0x42,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x08, 0x00, 0x06, 0x08, 0x09, 0x03, 0xC6, 0x42, 0x42,
+	0x42, 0x42, 0x46, 0x3B, 0x08, 0x00, 0x01, 0x07, 0x0D, 0x20, 0x23, 0xBA, 0x24, 0x45, 0x0A, 0x08,
+	0x10, 0x20, 0x40, 0x83, 0x80, 0x00, 0x05, 0x08, 0x0B, 0x10, 0x08, 0xE7, 0x42, 0x24, 0x24, 0x28,
+	0x18, 0x10, 0x10, 0xE0, 0x00, 0x03, 0x07, 0x0C, 0xEE, 0x89, 0x11, 0x42, 0x82, 0x04, 0x08, 0x10,
+	0x20, 0xE0, 0x20, 0x00, 0x07, 0x08, 0x09, 0xE7, 0x42, 0x24, 0x24, 0x28, 0x18, 0x10, 0x12, 0xE0,
+	0x00, 0x00, 0x07, 0x0E, 0x30, 0x20, 0x87, 0x74, 0x48, 0x8A, 0x14, 0x10, 0x20, 0x40, 0x81, 0x07,
+	0x00, 0x00, 0x04, 0x08, 0x0C, 0x18, 0x08, 0x10, 0xE7, 0x42, 0x24, 0x24, 0x28, 0x18, 0x10, 0x10,
+	0xE0, 0x00, 0x01, 0x07, 0x0D, 0x14, 0x53, 0xBA, 0x24, 0x45, 0x0A, 0x08, 0x10, 0x20, 0x40, 0x83,
+	0x80, 0x00, 0x05, 0x08, 0x0B, 0x14, 0x28, 0xE7, 0x42, 0x24, 0x24, 0x28, 0x18, 0x10, 0x10, 0xE0,
+	0x02, 0x01, 0x0C, 0x0F, 0x04, 0x00, 0x40, 0x04, 0x0F, 0xFF, 0x84, 0x18, 0x41, 0x84, 0x18, 0x41,
+	0x84, 0x18, 0x41, 0xFF, 0xF0, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x01, 0x01, 0x0E, 0x0F, 0x02,
+	0x00, 0x08, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xF1, 0x00, 0x47, 0xFF, 0x1F, 0xFC, 0x80, 0x0E, 0x3E,
+	0x19, 0x04, 0x84, 0x10, 0x10, 0x44, 0x81, 0x1C, 0x07, 0xC0, 0x01, 0x01, 0x0E, 0x0F, 0x02, 0x00,
+	0x08, 0x0F, 0xFF, 0xC1, 0x10, 0x08, 0x20, 0x20, 0x41, 0x00, 0x9F, 0xFE, 0x08, 0x84, 0x22, 0x00,
+	0x88, 0x02, 0x21, 0x10, 0x84, 0x82, 0x1C, 0x0F, 0xC0, 0x01, 0x01, 0x0E, 0x0F, 0x02, 0x00, 0x08,
+	0x22, 0x21, 0x04, 0x84, 0x12, 0x20, 0x49, 0x0F, 0xFF, 0xC2, 0x20, 0x08, 0x80, 0x22, 0x00, 0x88,
+	0x04, 0x21, 0x10, 0x84, 0x82, 0x1C, 0x0F, 0x80, 0x01, 0x02, 0x0F, 0x0E, 0x03, 0x00, 0x09, 0x00,
+	0x21, 0x81, 0x80, 0x8C, 0x00, 0xC7, 0xFE, 0x40, 0x80, 0x01, 0x00, 0x02, 0x00, 0xFF, 0xE0, 0x08,
+	0x00, 0x10, 0x00, 0x20, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x80, 0x09, 0x00, 0x12,
+	0x00, 0x42, 0x00, 0x84, 0x02, 0x04, 0x08, 0x04, 0x21, 0x04, 0x82, 0x06, 0x08, 0x00, 0x11, 0x00,
+	0x41, 0x01, 0x02, 0x07, 0xFE, 0x04, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x01, 0x40, 0x82, 0x40,
+	0x84, 0x81, 0x1F, 0xF0, 0x22, 0x02, 0xC4, 0x06, 0xFF, 0x09, 0x10, 0x22, 0x20, 0x47, 0xFB, 0x88,
+	0x81, 0x11, 0x02, 0x22, 0x04, 0x7F, 0xC8, 0x80, 0x01, 0x00, 0x01, 0x02, 0x0E, 0x0E, 0x00, 0x41,
+	0xF1, 0x00, 0x0F, 0x80, 0x11, 0x00, 0x47, 0xF9, 0x12, 0x04, 0x48, 0x11, 0x24, 0x44, 0x91, 0x14,
+	0x48, 0x51, 0xA1, 0x7B, 0x04, 0x04, 0xE0, 0x01, 0x01, 0x0E, 0x0F, 0x00, 0x20, 0x40, 0x80, 0x84,
+	0x1F, 0xFC, 0x42, 0x09, 0x08, 0x27, 0xFF, 0x90, 0x82, 0x42, 0x09, 0xFF, 0xC0, 0x20, 0x3F, 0xFF,
+	0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x01, 0x01, 0x0C, 0x0F, 0x7F, 0xF0, 0x01, 0x00, 0x1F, 0xFD,
+	0x00, 0x10, 0x01, 0x3F, 0x12, 0x11, 0x21, 0x12, 0x11, 0x21, 0x13, 0xF1, 0x21, 0x10, 0x05, 0x00,
+	0x20, 0x01, 0x02, 0x0E, 0x0E, 0x03, 0x00, 0x12, 0x00, 0x86, 0x0C, 0x04, 0xC0, 0x0C, 0xFF, 0xC0,
+	0x00, 0x0F, 0xFC, 0x40, 0x09, 0x00, 0x24, 0x00, 0x90, 0x02, 0x40, 0x08, 0xFF, 0xC0, 0x01, 0x02,
+	0x0E, 0x0E, 0x7F, 0xFE, 0x20, 0x18, 0xFE, 0x66, 0x11, 0xA6, 0xC6, 0x04, 0x18, 0x6C, 0x6F, 0x0D,
+	0x83, 0x06, 0x03, 0x18, 0x60, 0x60, 0x61, 0x80, 0x45, 0xFF, 0xE0, 0x01, 0x02, 0x0E, 0x0E, 0xFF,
+	0xFE, 0x3F, 0x19, 0x02, 0x64, 0x09, 0x8F, 0xC6, 0x7F, 0x9A, 0x02, 0x68, 0x09, 0xA2, 0x26, 0x88,
+	0x98, 0x52, 0x62, 0x39, 0xB0, 0x15, 0xFF, 0xE0, 0x00, 0x00, 0x0E, 0x10, 0x11, 0x04, 0x44, 0x91,
+	0x12, 0x44, 0x49, 0x11, 0x27, 0xF4, 0x91, 0x12, 0x44, 0x49, 0x11, 0x24, 0x44, 0x91, 0x12, 0x47,
+	0x49, 0xE1, 0x25, 0x08, 0x90, 0x20, 0x41, 0x01, 0x01, 0x02, 0x0E, 0x0E, 0x40, 0x81, 0x1F, 0xF4,
+	0x08, 0x3C, 0xFE, 0x44, 0x09, 0x1F, 0xE4, 0x40, 0x91, 0xFE, 0x44, 0x09, 0x1F, 0xE7, 0x40, 0xB2,
+	0xFD, 0x03, 0x30, 0x10, 0x20, 0x01, 0x02, 0x0E, 0x0E, 0x7F, 0xF0, 0x00, 0x80, 0x0C, 0x00, 0x40,
+	0x02, 0x00, 0x04, 0x0F, 0xFF, 0xC0, 0x20, 0x00, 0x80, 0x01, 0x00, 0x04, 0x00, 0x10, 0x30, 0x80,
+	0x3C, 0x00, 0x00, 0x01, 0x0E, 0x0F, 0x3F, 0xF8, 0x80, 0x22, 0x00, 0x8F, 0xFE, 0x24, 0x10, 0x88,
+	0x82, 0xFF, 0x88, 0x88, 0x22, 0x20, 0xFF, 0xF2, 0x22, 0x10, 0x88, 0x44, 0x22, 0x10, 0x80, 0x82,
+	0x00, 0x01, 0x00, 0x0D, 0x10, 0x04, 0x00, 0x10, 0x00, 0x01, 0xFF, 0xF0, 0x20, 0x01, 0x00, 0x08,
+	0x0F, 0xFE, 0x42, 0x12, 0x10, 0x90, 0x84, 0x84, 0x24, 0x25, 0x21, 0x10, 0x08, 0x00, 0x40, 0x00,
+	0x00, 0x0F, 0x10, 0x04, 0x40, 0xFF, 0xF8, 0x11, 0x00, 0xFF, 0x81, 0x01, 0x03, 0xFE, 0x04, 0x04,
+	0x0F, 0xF8, 0x04, 0x01, 0xFF, 0xFC, 0x44, 0x41, 0xFF, 0xCD, 0x11, 0x62, 0x2A, 0x04, 0x48, 0x00,
+	0x80, 0x01, 0x02, 0x0E, 0x0E, 0x01, 0x01, 0xFF, 0xF8, 0x00, 0x23, 0xFE, 0x84, 0x12, 0x09, 0x88,
+	0x18, 0x2F, 0xFF, 0x80, 0x86, 0x02, 0x18, 0x08, 0xA0, 0x24, 0x80, 0x82, 0x22, 0x00, 0x00, 0x02,
+	0x0F, 0x0E, 0x00, 0x80, 0x7F, 0xFD, 0x10, 0x42, 0xFF, 0xE4, 0x41, 0x08, 0x82, 0x10, 0xFC, 0x20,
+	0x00, 0x5F, 0xF8, 0x88, 0x11, 0x08, 0xC2, 0x0E, 0x04, 0x36, 0x17, 0x83, 0xC0, 0x00, 0x01, 0x0F,
+	0x0F, 0x7F, 0xFC, 0x10, 0x40, 0x20, 0x80, 0x41, 0x00, 0x82, 0x01, 0x04, 0x3F, 0xFF, 0x84, 0x10,
+	0x08, 0x20, 0x10, 0x40, 0x20, 0x80, 0x81, 0x01, 0x02, 0x04, 0x04, 0x10, 0x08, 0x00, 0x01, 0x02,
+	0x0E, 0x0E, 0xFF, 0x09, 0x10, 0x44, 0x46, 0x11, 0x60, 0x44, 0x05, 0x10, 0x2F, 0xF9, 0x11, 0x18,
+	0x45, 0x85, 0x10, 0x14, 0x40, 0x91, 0x04, 0x44, 0x62, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x09,
+	0x00, 0x12, 0x00, 0x47, 0xF1, 0x90, 0x25, 0x44, 0x93, 0x2A, 0x04, 0x52, 0x09, 0x22, 0x14, 0x44,
+	0x22, 0x80, 0x42, 0x00, 0x10, 0x05, 0x10, 0x4A, 0x22, 0x64, 0x04, 0x87, 0xF8, 0x01, 0x02, 0x0E,
+	0x0E, 0x7E, 0xF9, 0x02, 0x04, 0x08, 0x1F, 0x20, 0x44, 0xFD, 0x12, 0x24, 0x48, 0x91, 0x22, 0x7D,
+	0x09, 0x04, 0x24, 0x10, 0xA0, 0x42, 0x82, 0x0A, 0x10, 0x20, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x20,
+	0x20, 0x40, 0x40, 0x80, 0x9F, 0xFF, 0xC2, 0x02, 0x04, 0x04, 0x08, 0x0A, 0xFE, 0x18, 0x84, 0x61,
+	0x13, 0x41, 0x20, 0x82, 0x81, 0x02, 0x02, 0x0A, 0x14, 0x62, 0x13, 0x03, 0x00, 0x00, 0x0F, 0x10,
+	0x10, 0x40, 0x20, 0x40, 0x40, 0x80, 0x9F, 0xFF, 0xA0, 0x22, 0x88, 0x84, 0x10, 0x0D, 0xFF, 0x30,
+	0x89, 0xA1, 0x10, 0x44, 0x20, 0x86, 0x81, 0x02, 0x02, 0x0A, 0x14, 0x22, 0x11, 0x82, 0x00, 0x00,
+	0x0F, 0x10, 0x11, 0x10, 0x22, 0x20, 0x5F, 0xF0, 0x88, 0x8F, 0xC0, 0x02, 0x7F, 0x04, 0x82, 0x0B,
+	0xFC, 0x1A, 0x08, 0x67, 0xF3, 0x41, 0x00, 0xBF, 0xE1, 0x0A, 0x02, 0x22, 0x14, 0x82, 0x12, 0x03,
+	0x00, 0x01, 0x0F, 0x0F, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0xFB, 0xE0, 0x81, 0x01, 0x02, 0x01,
+	0x04, 0x02, 0x10, 0x02, 0x20, 0x04, 0x80, 0x06, 0x00, 0x0C, 0x00, 0x26, 0x03, 0x83, 0x38, 0x01,
+	0x80, 0x00, 0x00, 0x0F, 0x10, 0x20, 0x80, 0x21, 0x00, 0x43, 0xF8, 0x08, 0x0F, 0xE0, 0x04, 0x3F,
+	0x88, 0x09, 0x1E, 0x12, 0x24, 0xA0, 0x49, 0x40, 0x92, 0xF1, 0x25, 0x02, 0x4A, 0x08, 0xAC, 0x15,
+	0x4F, 0xC5, 0x00, 0x01, 0x02, 0x0E, 0x0E, 0x7F, 0xF9, 0x00, 0x24, 0x00, 0x9F, 0xFE, 0x40, 0x09,
+	0x00, 0x23, 0xFF, 0x12, 0x22, 0x28, 0x90, 0xA2, 0x42, 0x89, 0x06, 0x28, 0x08, 0x83, 0xFF, 0xF0,
+	0x01, 0x00, 0x0D, 0x10, 0x1F, 0xC0, 0x82, 0x04, 0x10, 0x3F, 0x81, 0x04, 0x08, 0x20, 0x7F, 0x00,
+	0x00, 0xFD, 0xFC, 0x28, 0x61, 0x43, 0xFB, 0xF8, 0x50, 0xC2, 0x87, 0xF7, 0xF0, 0xA1, 0x00, 0x00,
+	0x0F, 0x10, 0x02, 0x00, 0x04, 0x03, 0xFF, 0xF8, 0x20, 0x00, 0x40, 0x01, 0xFE, 0x02, 0x04, 0x0C,
+	0x08, 0x2F, 0xF0, 0x90, 0x22, 0x20, 0x40, 0x7F, 0x80, 0x81, 0x01, 0x02, 0x02, 0x14, 0x04, 0x10,
+	0x00, 0x00, 0x0F, 0x10, 0x01, 0x00, 0x02, 0x40, 0x04, 0x40, 0x08, 0x87, 0xFF, 0xC0, 0x70, 0x01,
+	0x50, 0x02, 0xA0, 0x09, 0x20, 0x22, 0x20, 0x84, 0x22, 0x08, 0x28, 0x10, 0x20, 0x20, 0x00, 0x40,
+	0x00, 0x80, 0x01, 0x01, 0x0E, 0x0F, 0x20, 0x00, 0x80, 0x02, 0x7F, 0xBE, 0x82, 0x22, 0x08, 0xC8,
+	0x23, 0x10, 0x9A, 0x44, 0xA0, 0x92, 0x82, 0x82, 0x04, 0x08, 0x28, 0x21, 0x10, 0x98, 0x22, 0x80,
+	0x40, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x40, 0x20, 0x40, 0x40, 0x80, 0x8F, 0xFF, 0xC0, 0x02, 0x11,
+	0x0C, 0x41, 0x1D, 0x01, 0x54, 0x88, 0xA1, 0x12, 0x41, 0x40, 0x82, 0x81, 0x02, 0x02, 0x0A, 0x04,
+	0x22, 0x09, 0x83, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x80, 0x01, 0x03, 0xF2, 0x00, 0x27, 0xE0, 0x50,
+	0x49, 0x21, 0x0A, 0x90, 0x0A, 0x20, 0x10, 0x40, 0x51, 0x40, 0x92, 0x82, 0x28, 0x88, 0x11, 0x00,
+	0x41, 0x01, 0x01, 0x04, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x67, 0xC2, 0x28, 0xA4, 0x15, 0x48, 0x2A,
+	0x9C, 0x55, 0x24, 0xAA, 0x41, 0x54, 0x82, 0xA9, 0x15, 0x52, 0x2E, 0xA4, 0x8A, 0x09, 0x12, 0x14,
+	0x44, 0x29, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x80, 0x40, 0x80, 0x5F, 0xF8, 0x89, 0x08,
+	0x12, 0x08, 0x47, 0x90, 0x91, 0x0B, 0x32, 0x12, 0x94, 0x46, 0x93, 0x89, 0x21, 0x11, 0x82, 0x22,
+	0x04, 0x4A, 0x08, 0xA2, 0x01, 0x83, 0x00, 0x01, 0x0F, 0x0F, 0x27, 0xFC, 0x28, 0x08, 0x52, 0x94,
+	0x08, 0x84, 0x20, 0x88, 0x08, 0x04, 0x10, 0x0B, 0xFE, 0x20, 0x41, 0xC1, 0xC0, 0x85, 0x41, 0x12,
+	0x42, 0xC4, 0x64, 0x08, 0x00, 0x10, 0x00, 0x00, 0x01, 0x0F, 0x0F, 0x27, 0xFE, 0x28, 0x40, 0x51,
+	0x04, 0x2F, 0xE4, 0x50, 0x48, 0xBF, 0x85, 0x41, 0x0A, 0xFE, 0x25, 0x25, 0xC8, 0x40, 0x92, 0xA1,
+	0x49, 0x22, 0xA2, 0x26, 0x14, 0x00, 0x10, 0x00, 0x01, 0x01, 0x0E, 0x0F, 0x00, 0x81, 0x02, 0x04,
+	0x08, 0x10, 0x20, 0x7F, 0xFD, 0x00, 0x04, 0x00, 0x10, 0x00, 0x7F, 0xC1, 0x00, 0x84, 0x02, 0x10,
+	0x08, 0x40, 0x22, 0x00, 0x88, 0x02, 0x00, 0x01, 0x02, 0x0E, 0x0E, 0x91, 0xFE, 0x48, 0x09, 0x20,
+	0x24, 0x80, 0xFD, 0xFE, 0x0C, 0x18, 0x28, 0xBC, 0xA2, 0x8A, 0x52, 0x29, 0x48, 0xA2, 0x22, 0x94,
+	0x8C, 0x88, 0x1C, 0x10, 0x01, 0x01, 0x0E, 0x0F, 0x02, 0x00, 0x08, 0x03, 0xFE, 0x30, 0x86, 0x82,
+	0x0A, 0x08, 0x2F, 0xFF, 0xA0, 0x82, 0x82, 0x0A, 0x08, 0x2F, 0xFF, 0x80, 0x80, 0x02, 0x04, 0x08,
+	0x10, 0x3F, 0x80, 0x01, 0x02, 0x0E, 0x0E, 0xFF, 0xFC, 0x00, 0x01, 0xFE, 0x08, 0x88, 0x22, 0x20,
+	0x88, 0x8A, 0x22, 0x6F, 0xF9, 0xA2, 0x26, 0x88, 0x9A, 0x22, 0x67, 0xF9, 0x80, 0x07, 0xFF, 0xE0,
+	0x01, 0x02, 0x0E, 0x0E, 0x40, 0xFD, 0xF4, 0x09, 0x10, 0x24, 0x40, 0x91, 0xFE, 0x44, 0x1F, 0xF0,
+	0x44, 0x41, 0x19, 0x04, 0xA7, 0xD2, 0x50, 0x91, 0x40, 0x43, 0x02, 0x07, 0xF0, 0x01, 0x02, 0x0E,
+	0x0E, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x04, 0x01, 0x12, 0x04, 0x44, 0x21,
+	0x10, 0x84, 0x24, 0x10, 0x90, 0x41, 0x81, 0x04, 0x3C, 0x00, 0x01, 0x02, 0x0E, 0x0E, 0x33, 0xFF,
+	0x90, 0x12, 0x40, 0x49, 0x01, 0xFB, 0xF8, 0xC0, 0x03, 0x7F, 0xDA, 0x10, 0xA0, 0x42, 0x9F, 0xF2,
+	0x04, 0x08, 0x10, 0x20, 0x40, 0x9F, 0xF0, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x20, 0x10, 0x40, 0x20,
+	0x83, 0xF1, 0x00, 0x03, 0xE0, 0x84, 0x11, 0x08, 0x22, 0x10, 0x25, 0xFC, 0x52, 0x08, 0xA4, 0x10,
+	0x78, 0x2F, 0x10, 0x48, 0x20, 0x80, 0x7F, 0x00, 0x82, 0x01, 0x01, 0x0E, 0x0F, 0x00, 0x40, 0x81,
+	0x02, 0x7F, 0xD0, 0x10, 0x4C, 0x4A, 0x51, 0x2F, 0x44, 0x89, 0x12, 0x44, 0x49, 0x1F, 0xEF, 0x84,
+	0x00, 0x11, 0x08, 0x47, 0xC1, 0x10, 0x07, 0x80, 0x01, 0x02, 0x0E, 0x0E, 0x20, 0x40, 0x8F, 0xF4,
+	0x40, 0x51, 0x01, 0x93, 0xFA, 0xC0, 0x06, 0x00, 0x09, 0xFF, 0x4A, 0x53, 0xC9, 0x20, 0x24, 0x86,
+	0x92, 0xE4, 0x44, 0x15, 0x10, 0x01, 0x01, 0x0D, 0x0F, 0xFF, 0xFC, 0x00, 0x60, 0x03, 0x08, 0x5A,
+	0x52, 0xCA, 0x56, 0x21, 0x31, 0x09, 0x94, 0xAC, 0xA5, 0x69, 0x4B, 0x84, 0x18, 0x00, 0xC0, 0x16,
+	0x00, 0x40, 0x01, 0x02, 0x0E, 0x0E, 0x08, 0x00, 0x7F, 0x82, 0x04, 0x10, 0x10, 0xFF, 0xF9, 0x04,
+	0x24, 0x10, 0x90, 0x42, 0x41, 0x09, 0xFF, 0xC4, 0x00, 0x10, 0x01, 0x40, 0x04, 0xFF, 0xF0, 0x01,
+	0x02, 0x0E, 0x0E, 0x10, 0x43, 0xFF, 0xF1, 0x04, 0x04, 0x90, 0x02, 0x01, 0xFF, 0xC4, 0x21, 0x10,
+	0x84, 0x42, 0x10, 0xFF, 0xA0, 0x28, 0x01, 0x10, 0x18, 0x23, 0x80, 0x70, 0x01, 0x01, 0x0E, 0x0F,
+	0x00, 0x40, 0x41, 0x0F, 0xFF, 0xC0, 0x10, 0x00, 0xF1, 0xFC, 0x42, 0x21, 0x04, 0x48, 0x12, 0x43,
+	0xFF, 0xF0, 0x30, 0x01, 0xA0, 0x1A, 0x61, 0x88, 0x68, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x10, 0x20,
+	0x20, 0x40, 0x41, 0xE0, 0x82, 0x4F, 0xE9, 0x12, 0x4F, 0xA4, 0x95, 0x49, 0x2A, 0x92, 0x7D, 0xFC,
+	0xAA, 0x49, 0x50, 0x83, 0xE1, 0x45, 0x42, 0x4A, 0xFF, 0xD1, 0x40, 0xC6, 0x00, 0x01, 0x02, 0x0E,
+	0x0E, 0x40, 0x28, 0x80, 0xA2, 0xFF, 0xC0, 0x09, 0x00, 0x23, 0x00, 0x82, 0x7E, 0x08, 0x48, 0x21,
+	0x20, 0x84, 0x82, 0x92, 0x4A, 0x75, 0x3E, 0x14, 0x00, 0x30, 0x00, 0x02, 0x0F, 0x0E, 0x23, 0xFE,
+	0x24, 0x44, 0x0B, 0xE8, 0x11, 0x1E, 0x22, 0x22, 0x5F, 0xC4, 0x9C, 0x89, 0x45, 0x12, 0x8A, 0x25,
+	0x14, 0x5A, 0xE8, 0xD2, 0x11, 0x20, 0x20, 0x81, 0xC0, 0x00, 0x00, 0x0F, 0x10, 0x20, 0x20, 0x40,
+	0x40, 0x80, 0x87, 0xEF, 0xE4, 0x02, 0x0A, 0x08, 0x24, 0xFF, 0xFE, 0x20, 0x10, 0x80, 0x23, 0xF8,
+	0x70, 0x17, 0x84, 0x45, 0x05, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08, 0x00, 0x01, 0x0F, 0x0E, 0x20,
+	0x80, 0x26, 0x78, 0x48, 0x90, 0x11, 0x20, 0x22, 0x5E, 0x44, 0x84, 0x89, 0x09, 0x12, 0x12, 0xB4,
+	0x26, 0x50, 0x48, 0x80, 0x81, 0x02, 0x82, 0x08, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0x20, 0x10,
+	0x40, 0x20, 0xED, 0xF1, 0x08, 0xA4, 0x1F, 0xEF, 0x42, 0xA8, 0x9F, 0x13, 0x88, 0xF9, 0x7C, 0x4A,
+	0x20, 0x97, 0xF9, 0x10, 0x82, 0xA1, 0x06, 0xA0, 0x0A, 0x3F, 0x80, 0x01, 0x01, 0x0E, 0x0F, 0xF7,
+	0xF2, 0x50, 0x4A, 0x41, 0x29, 0xFC, 0xC4, 0x12, 0x90, 0x49, 0x7F, 0x25, 0x22, 0x94, 0x93, 0x51,
+	0x8A, 0x44, 0x21, 0x08, 0x85, 0x12, 0x18, 0x38, 0x40, 0x00, 0x01, 0x03, 0x06, 0x0B, 0xFE, 0x18,
+	0x61, 0x86, 0x18, 0x61, 0x86, 0x1F, 0xC0,
+};
+
+const lcd_font_t LCD_Font16 = {
+	.height = 16,
+	.bpp = 1,
+	.ascii = 95,
+	.count = 292,
+	.fallback = 291,
+	.glyphs = lcd_font16_glyphs,
+	.bits = lcd_font16_bits,
+};
@@ -0,0 +1,1154 @@
+/* Sinh bởi utils/font2c.py từ smartlight_sans15.bdf, không sửa tay:
+ *   python font2c.py ../assets/fonts/smartlight_sans15.bdf -n LCD_FontSans15 --bpp 4 --kern ../assets/fonts/smartlight_sans15.kern -o ../components/lcd/lcd_font_sans15.c
+ */
+#include "lcd_font.h"
+
+static const lcd_glyph_t lcd_fontsans15_glyphs[231] = {
+	{ 0x0020,     0,  4 },
+	{ 0x0021,     4,  5 },	/* ! */
+	{ 0x0022,    17,  6 },	/* " */
+	{ 0x0023,    27, 10 },	/* # */
+	{ 0x0024,    71,  8 },	/* $ */
+	{ 0x0025,   108, 11 },	/* % */
+	{ 0x0026,   162,  9 },	/* & */
+	{ 0x0027,   207,  3 },	/* ' */
+	{ 0x0028,   214,  5 },	/* ( */
+	{ 0x0029,   235,  5 },	/* ) */
+	{ 0x002A,   256,  6 },	/* * */
+	{ 0x002B,   278, 10 },	/* + */
+	{ 0x002C,   310,  4 },	/* , */
+	{ 0x002D,   317,  4 },	/* - */
+	{ 0x002E,   323,  4 },	/* . */
+	{ 0x002F,   329,  4 },	/* / */
+	{ 0x0030,   353,  8 },	/* 0 */
+	{ 0x0031,   389,  8 },	/* 1 */
+	{ 0x0032,   420,  8 },	/* 2 */
+	{ 0x0033,   456,  8 },	/* 3 */
+	{ 0x0034,   492,  8 },	/* 4 */
+	{ 0x0035,   528,  8 },	/* 5 */
+	{ 0x0036,   564,  8 },	/* 6 */
+	{ 0x0037,   600,  8 },	/* 7 */
+	{ 0x0038,   631,  8 },	/* 8 */
+	{ 0x0039,   667,  8 },	/* 9 */
+	{ 0x003A,   703,  4 },	/* : */
+	{ 0x003B,   713,  4 },	/* ; */
+	{ 0x003C,   724, 10 },	/* < */
+	{ 0x003D,   752, 10 },	/* = */
+	{ 0x003E,   768, 10 },	/* > */
+	{ 0x003F,   796,  6 },	/* ? */
+	{ 0x0040,   827, 12 },	/* @ */
+	{ 0x0041,   897,  8 },	/* A */
+	{ 0x0042,   937,  8 },	/* B */
+	{ 0x0043,   973,  8 },	/* C */
+	{ 0x0044,  1013,  9 },	/* D */
+	{ 0x0045,  1053,  8 },	/* E */
+	{ 0x0046,  1084,  7 },	/* F */
+	{ 0x0047,  1115,  9 },	/* G */
+	{ 0x0048,  1160,  9 },	/* H */
+	{ 0x0049,  1196,  4 },	/* I */
+	{ 0x004A,  1209,  4 },	/* J */
+	{ 0x004B,  1235,  8 },	/* K */
+	{ 0x004C,  1271,  7 },	/* L */
+	{ 0x004D,  1302, 10 },	/* M */
+	{ 0x004E,  1347,  9 },	/* N */
+	{ 0x004F,  1383,  9 },	/* O */
+	{ 0x0050,  1428,  7 },	/* P */
+	{ 0x0051,  1459,  9 },	/* Q */
+	{ 0x0052,  1513,  8 },	/* R */
+	{ 0x0053,  1549,  8 },	/* S */
+	{ 0x0054,  1585,  7 },	/* T */
+	{ 0x0055,  1625,  9 },	/* U */
+	{ 0x0056,  1661,  8 },	/* V */
+	{ 0x0057,  1701, 12 },	/* W */
+	{ 0x0058,  1759,  8 },	/* X */
+	{ 0x0059,  1799,  7 },	/* Y */
+	{ 0x005A,  1839,  8 },	/* Z */
+	{ 0x005B,  1879,  5 },	/* [ */
+	{ 0x005C,  1900,  4 },
+	{ 0x005D,  1924,  5 },	/* ] */
+	{ 0x005E,  1945, 10 },	/* ^ */
+	{ 0x005F,  1961,  6 },	/* _ */
+	{ 0x0060,  1969,  6 },	/* ` */
+	{ 0x0061,  1976,  7 },	/* a */
+	{ 0x0062,  2005,  8 },	/* b */
+	{ 0x0063,  2039,  7 },	/* c */
+	{ 0x0064,  2064,  8 },	/* d */
+	{ 0x0065,  2103,  7 },	/* e */
+	{ 0x0066,  2132,  4 },	/* f */
+	{ 0x0067,  2161,  8 },	/* g */
+	{ 0x0068,  2200,  8 },	/* h */
+	{ 0x0069,  2234,  3 },	/* i */
+	{ 0x006A,  2247,  3 },	/* j */
+	{ 0x006B,  2275,  7 },	/* k */
+	{ 0x006C,  2309,  3 },	/* l */
+	{ 0x006D,  2323, 12 },	/* m */
+	{ 0x006E,  2362,  8 },	/* n */
+	{ 0x006F,  2387,  7 },	/* o */
+	{ 0x0070,  2416,  8 },	/* p */
+	{ 0x0071,  2450,  8 },	/* q */
+	{ 0x0072,  2489,  5 },	/* r */
+	{ 0x0073,  2507,  6 },	/* s */
+	{ 0x0074,  2532,  5 },	/* t */
+	{ 0x0075,  2559,  8 },	/* u */
+	{ 0x0076,  2584,  7 },	/* v */
+	{ 0x0077,  2613, 10 },	/* w */
+	{ 0x0078,  2652,  7 },	/* x */
+	{ 0x0079,  2681,  7 },	/* y */
+	{ 0x007A,  2720,  6 },	/* z */
+	{ 0x007B,  2745,  8 },	/* { */
+	{ 0x007C,  2782,  4 },	/* | */
+	{ 0x007D,  2798,  8 },	/* } */
+	{ 0x007E,  2835, 10 },	/* ~ */
+	{ 0x00B0,  2847,  6 },	/* ° */
+	{ 0x00C0,  2859,  8 },	/* À */
+	{ 0x00C1,  2907,  8 },	/* Á */
+	{ 0x00C2,  2955,  8 },	/* Â */
+	{ 0x00C3,  3003,  8 },	/* Ã */
+	{ 0x00C8,  3051,  8 },	/* È */
+	{ 0x00C9,  3088,  8 },	/* É */
+	{ 0x00CA,  3125,  8 },	/* Ê */
+	{ 0x00CC,  3162,  4 },	/* Ì */
+	{ 0x00CD,  3183,  4 },	/* Í */
+	{ 0x00D2,  3198,  9 },	/* Ò */
+	{ 0x00D3,  3252,  9 },	/* Ó */
+	{ 0x00D4,  3306,  9 },	/* Ô */
+	{ 0x00D5,  3360,  9 },	/* Õ */
+	{ 0x00D9,  3414,  9 },	/* Ù */
+	{ 0x00DA,  3457,  9 },	/* Ú */
+	{ 0x00DD,  3500,  7 },	/* Ý */
+	{ 0x00E0,  3548,  7 },	/* à */
+	{ 0x00E1,  3587,  7 },	/* á */
+	{ 0x00E2,  3626,  7 },	/* â */
+	{ 0x00E3,  3665,  7 },	/* ã */
+	{ 0x00E8,  3701,  7 },	/* è */
+	{ 0x00E9,  3740,  7 },	/* é */
+	{ 0x00EA,  3779,  7 },	/* ê */
+	{ 0x00EC,  3818,  3 },	/* ì */
+	{ 0x00ED,  3842,  3 },	/* í */
+	{ 0x00F2,  3861,  7 },	/* ò */
+	{ 0x00F3,  3900,  7 },	/* ó */
+	{ 0x00F4,  3939,  7 },	/* ô */
+	{ 0x00F5,  3978,  7 },	/* õ */
+	{ 0x00F9,  4014,  8 },	/* ù */
+	{ 0x00FA,  4048,  8 },	/* ú */
+	{ 0x00FD,  4082,  7 },	/* ý */
+	{ 0x0102,  4132,  8 },	/* Ă */
+	{ 0x0103,  4184,  7 },	/* ă */
+	{ 0x0110,  4223,  9 },	/* Đ */
+	{ 0x0111,  4268,  8 },	/* đ */
+	{ 0x0128,  4312,  4 },	/* Ĩ */
+	{ 0x0129,  4344,  3 },	/* ĩ */
+	{ 0x0168,  4371,  9 },	/* Ũ */
+	{ 0x0169,  4414,  8 },	/* ũ */
+	{ 0x01A0,  4445, 11 },	/* Ơ */
+	{ 0x01A1,  4494,  7 },	/* ơ */
+	{ 0x01AF,  4526, 10 },	/* Ư */
+	{ 0x01B0,  4571,  8 },	/* ư */
+	{ 0x1EA0,  4603,  8 },	/* Ạ */
+	{ 0x1EA1,  4655,  7 },	/* ạ */
+	{ 0x1EA2,  4694,  8 },	/* Ả */
+	{ 0x1EA3,  4746,  7 },	/* ả */
+	{ 0x1EA4,  4785,  8 },	/* Ấ */
+	{ 0x1EA5,  4837,  7 },	/* ấ */
+	{ 0x1EA6,  4876,  8 },	/* Ầ */
+	{ 0x1EA7,  4928,  7 },	/* ầ */
+	{ 0x1EA8,  4967,  8 },	/* Ẩ */
+	{ 0x1EA9,  5019,  7 },	/* ẩ */
+	{ 0x1EAA,  5062,  8 },	/* Ẫ */
+	{ 0x1EAB,  5114,  7 },	/* ẫ */
+	{ 0x1EAC,  5157,  8 },	/* Ậ */
+	{ 0x1EAD,  5217,  7 },	/* ậ */
+	{ 0x1EAE,  5267,  8 },	/* Ắ */
+	{ 0x1EAF,  5319,  7 },	/* ắ */
+	{ 0x1EB0,  5362,  8 },	/* Ằ */
+	{ 0x1EB1,  5414,  7 },	/* ằ */
+	{ 0x1EB2,  5457,  8 },	/* Ẳ */
+	{ 0x1EB3,  5509,  7 },	/* ẳ */
+	{ 0x1EB4,  5552,  8 },	/* Ẵ */
+	{ 0x1EB5,  5604,  7 },	/* ẵ */
+	{ 0x1EB6,  5647,  8 },	/* Ặ */
+	{ 0x1EB7,  5711,  7 },	/* ặ */
+	{ 0x1EB8,  5761,  8 },	/* Ẹ */
+	{ 0x1EB9,  5801,  7 },	/* ẹ */
+	{ 0x1EBA,  5840,  8 },	/* Ẻ */
+	{ 0x1EBB,  5880,  7 },	/* ẻ */
+	{ 0x1EBC,  5919,  8 },	/* Ẽ */
+	{ 0x1EBD,  5956,  7 },	/* ẽ */
+	{ 0x1EBE,  5992,  8 },	/* Ế */
+	{ 0x1EBF,  6038,  7 },	/* ế */
+	{ 0x1EC0,  6082,  8 },	/* Ề */
+	{ 0x1EC1,  6122,  7 },	/* ề */
+	{ 0x1EC2,  6161,  8 },	/* Ể */
+	{ 0x1EC3,  6207,  7 },	/* ể */
+	{ 0x1EC4,  6255,  8 },	/* Ễ */
+	{ 0x1EC5,  6295,  7 },	/* ễ */
+	{ 0x1EC6,  6338,  8 },	/* Ệ */
+	{ 0x1EC7,  6384,  7 },	/* ệ */
+	{ 0x1EC8,  6434,  4 },	/* Ỉ */
+	{ 0x1EC9,  6462,  3 },	/* ỉ */
+	{ 0x1ECA,  6481,  4 },	/* Ị */
+	{ 0x1ECB,  6497,  3 },	/* ị */
+	{ 0x1ECC,  6513,  9 },	/* Ọ */
+	{ 0x1ECD,  6571,  7 },	/* ọ */
+	{ 0x1ECE,  6610,  9 },	/* Ỏ */
+	{ 0x1ECF,  6668,  7 },	/* ỏ */
+	{ 0x1ED0,  6707,  9 },	/* Ố */
+	{ 0x1ED1,  6765,  7 },	/* ố */
+	{ 0x1ED2,  6804,  9 },	/* Ồ */
+	{ 0x1ED3,  6862,  7 },	/* ồ */
+	{ 0x1ED4,  6901,  9 },	/* Ổ */
+	{ 0x1ED5,  6959,  7 },	/* ổ */
+	{ 0x1ED6,  7007,  9 },	/* Ỗ */
+	{ 0x1ED7,  7065,  7 },	/* ỗ */
+	{ 0x1ED8,  7108,  9 },	/* Ộ */
+	{ 0x1ED9,  7175,  7 },	/* ộ */
+	{ 0x1EDA,  7225, 11 },	/* Ớ */
+	{ 0x1EDB,  7284,  7 },	/* ớ */
+	{ 0x1EDC,  7328, 11 },	/* Ờ */
+	{ 0x1EDD,  7387,  7 },	/* ờ */
+	{ 0x1EDE,  7431, 11 },	/* Ở */
+	{ 0x1EDF,  7495,  7 },	/* ở */
+	{ 0x1EE0,  7539, 11 },	/* Ỡ */
+	{ 0x1EE1,  7598,  7 },	/* ỡ */
+	{ 0x1EE2,  7638, 11 },	/* Ợ */
+	{ 0x1EE3,  7702,  7 },	/* ợ */
+	{ 0x1EE4,  7746,  9 },	/* Ụ */
+	{ 0x1EE5,  7792,  8 },	/* ụ */
+	{ 0x1EE6,  7826,  9 },	/* Ủ */
+	{ 0x1EE7,  7872,  8 },	/* ủ */
+	{ 0x1EE8,  7906, 10 },	/* Ứ */
+	{ 0x1EE9,  7960,  8 },	/* ứ */
+	{ 0x1EEA,  8004, 10 },	/* Ừ */
+	{ 0x1EEB,  8058,  8 },	/* ừ */
+	{ 0x1EEC,  8102, 10 },	/* Ử */
+	{ 0x1EED,  8160,  8 },	/* ử */
+	{ 0x1EEE,  8204, 10 },	/* Ữ */
+	{ 0x1EEF,  8258,  8 },	/* ữ */
+	{ 0x1EF0,  8298, 10 },	/* Ự */
+	{ 0x1EF1,  8356,  8 },	/* ự */
+	{ 0x1EF2,  8400,  7 },	/* Ỳ */
+	{ 0x1EF3,  8448,  7 },	/* ỳ */
+	{ 0x1EF4,  8498,  7 },	/* Ỵ */
+	{ 0x1EF5,  8550,  7 },	/* ỵ */
+	{ 0x1EF6,  8589,  7 },	/* Ỷ */
+	{ 0x1EF7,  8641,  7 },	/* ỷ */
+	{ 0x1EF8,  8691,  7 },	/* Ỹ */
+	{ 0x1EF9,  8739,  7 },	/* ỹ */
+	{ 0xFFFD,  8785, 12 },
+};
+
+static const uint8_t lcd_fontsans15_bits[8861] = {
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x09, 0x3F, 0x3F, 0x3F, 0x3F, 0x2F, 0x1E, 0x00, 0x3F,
+	0x3F, 0x01, 0x03, 0x04, 0x03, 0xD2, 0x95, 0xD2, 0x95, 0xD2, 0x95, 0x00, 0x04, 0x0A, 0x08, 0x00,
+	0x00, 0xD1, 0x3B, 0x00, 0x00, 0x02, 0xC0, 0x77, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x0A,
+	0x50, 0xE0, 0x00, 0x00, 0x0D, 0x13, 0xB0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x68, 0x0B,
+	0x30, 0x00, 0x00, 0xA4, 0x1D, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0B, 0x00, 0x81, 0x00, 0x3C, 0xFD,
+	0x60, 0xD7, 0x83, 0x92, 0xE2, 0x81, 0x00, 0x7C, 0xB4, 0x00, 0x02, 0xAA, 0xD2, 0x00, 0x81, 0x89,
+	0xA3, 0x83, 0xB7, 0x4C, 0xFE, 0x90, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x0B, 0x09,
+	0x08, 0xEB, 0x10, 0x05, 0x90, 0x02, 0xD1, 0x88, 0x01, 0xC1, 0x00, 0x59, 0x04, 0xA0, 0x86, 0x00,
+	0x03, 0xD1, 0x88, 0x3B, 0x00, 0x00, 0x08, 0xEC, 0x1B, 0x37, 0xEC, 0x10, 0x00, 0x06, 0x82, 0xD1,
+	0x88, 0x00, 0x01, 0xC1, 0x4A, 0x04, 0xB0, 0x00, 0x95, 0x02, 0xD1, 0x88, 0x00, 0x3B, 0x00, 0x07,
+	0xEC, 0x20, 0x00, 0x03, 0x09, 0x09, 0x00, 0x6E, 0xE7, 0x00, 0x00, 0x2F, 0x31, 0x91, 0x00, 0x02,
+	0xE1, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x0A, 0x79, 0xB0, 0x09, 0x72, 0xF0, 0x09, 0xB1,
+	0xD3, 0x3F, 0x10, 0x0A, 0xDA, 0x00, 0xDA, 0x21, 0x7F, 0xB0, 0x02, 0xAE, 0xEA, 0x3C, 0x80, 0x01,
+	0x03, 0x02, 0x03, 0xD2, 0xD2, 0xD2, 0x01, 0x02, 0x03, 0x0B, 0x07, 0x71, 0xE1, 0x6A, 0x0B, 0x60,
+	0xD4, 0x0E, 0x30, 0xD4, 0x0B, 0x60, 0x6A, 0x01, 0xD1, 0x07, 0x70, 0x01, 0x02, 0x03, 0x0B, 0xC3,
+	0x05, 0xA0, 0x0E, 0x20, 0xB6, 0x08, 0x90, 0x8A, 0x08, 0x90, 0xB6, 0x0E, 0x25, 0xA0, 0xC3, 0x00,
+	0x00, 0x03, 0x06, 0x06, 0x00, 0x55, 0x00, 0x67, 0x55, 0x76, 0x06, 0xCC, 0x60, 0x06, 0xCC, 0x60,
+	0x67, 0x55, 0x76, 0x00, 0x55, 0x00, 0x01, 0x05, 0x08, 0x07, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+	0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+	0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0x0A, 0x02, 0x03, 0x9A, 0xB6, 0xD0, 0x00, 0x08, 0x04,
+	0x01, 0x6F, 0xFB, 0x01, 0x0A, 0x02, 0x02, 0xB8, 0xB8, 0x00, 0x03, 0x04, 0x0A, 0x00, 0x2D, 0x00,
+	0x69, 0x00, 0xB4, 0x01, 0xE0, 0x05, 0xA0, 0x0A, 0x60, 0x0E, 0x10, 0x4B, 0x00, 0x87, 0x00, 0xD2,
+	0x00, 0x00, 0x03, 0x07, 0x09, 0x01, 0xAE, 0xD6, 0x00, 0x9B, 0x14, 0xE4, 0x0E, 0x40, 0x09, 0x92,
+	0xF1, 0x00, 0x6C, 0x3F, 0x00, 0x05, 0xC2, 0xF1, 0x00, 0x6C, 0x0E, 0x40, 0x09, 0x90, 0x9B, 0x14,
+	0xE4, 0x01, 0xAE, 0xE6, 0x00, 0x01, 0x03, 0x06, 0x09, 0xAF, 0xF9, 0x00, 0x00, 0x99, 0x00, 0x00,
+	0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99,
+	0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x03, 0x07, 0x09, 0x05, 0xCE, 0xC5, 0x01, 0xA3, 0x16, 0xF2, 0x00,
+	0x00, 0x0D, 0x50, 0x00, 0x01, 0xF3, 0x00, 0x00, 0xB9, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xAB, 0x00,
+	0x00, 0xAB, 0x10, 0x00, 0x2F, 0xFF, 0xFF, 0x70, 0x00, 0x03, 0x07, 0x09, 0x03, 0xBE, 0xD6, 0x00,
+	0x94, 0x14, 0xE4, 0x00, 0x00, 0x0B, 0x60, 0x00, 0x04, 0xE3, 0x00, 0x9F, 0xF7, 0x00, 0x00, 0x03,
+	0xD6, 0x00, 0x00, 0x08, 0x91, 0x92, 0x03, 0xD6, 0x05, 0xCE, 0xD7, 0x00, 0x00, 0x03, 0x07, 0x09,
+	0x00, 0x02, 0xEB, 0x00, 0x00, 0xBB, 0xB0, 0x00, 0x5A, 0x7B, 0x00, 0x1D, 0x27, 0xB0, 0x09, 0x70,
+	0x7B, 0x03, 0xC0, 0x07, 0xB0, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xB0, 0x00, 0x00, 0x7B, 0x00,
+	0x00, 0x03, 0x07, 0x09, 0x0B, 0xFF, 0xFE, 0x00, 0xB6, 0x00, 0x00, 0x0B, 0x60, 0x00, 0x00, 0xBE,
+	0xEC, 0x50, 0x00, 0x01, 0x6F, 0x30, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x0A, 0x81, 0x92, 0x16, 0xF3,
+	0x06, 0xDE, 0xC5, 0x00, 0x00, 0x03, 0x07, 0x09, 0x00, 0x6D, 0xE9, 0x10, 0x4D, 0x41, 0x64, 0x0C,
+	0x60, 0x00, 0x00, 0xF7, 0xEE, 0x90, 0x2F, 0xB2, 0x2C, 0x81, 0xF5, 0x00, 0x6C, 0x0E, 0x50, 0x06,
+	0xC0, 0x8C, 0x22, 0xC7, 0x00, 0x9E, 0xE8, 0x00, 0x01, 0x03, 0x06, 0x09, 0xFF, 0xFF, 0xF8, 0x00,
+	0x01, 0xE4, 0x00, 0x06, 0xD0, 0x00, 0x0B, 0x70, 0x00, 0x2F, 0x20, 0x00, 0x7B, 0x00, 0x00, 0xD6,
+	0x00, 0x04, 0xE1, 0x00, 0x09, 0x90, 0x00, 0x00, 0x03, 0x07, 0x09, 0x02, 0xBE, 0xE8, 0x00, 0xC9,
+	0x12, 0xD6, 0x0E, 0x40, 0x09, 0x80, 0xA9, 0x12, 0xD4, 0x02, 0xDF, 0xF9, 0x00, 0xD7, 0x12, 0xC7,
+	0x2F, 0x10, 0x06, 0xC0, 0xE7, 0x12, 0xC9, 0x04, 0xCE, 0xE9, 0x10, 0x00, 0x03, 0x07, 0x09, 0x02,
+	0xBE, 0xD5, 0x00, 0xD8, 0x14, 0xE3, 0x3F, 0x10, 0x0A, 0x83, 0xF1, 0x00, 0xAB, 0x0D, 0x81, 0x4E,
+	0xC0, 0x3C, 0xEC, 0x9A, 0x00, 0x00, 0x0B, 0x70, 0x73, 0x17, 0xE1, 0x03, 0xCE, 0xB2, 0x00, 0x01,
+	0x06, 0x02, 0x06, 0x9A, 0x9A, 0x00, 0x00, 0x9A, 0x9A, 0x01, 0x06, 0x02, 0x07, 0x9A, 0x9A, 0x00,
+	0x00, 0x9A, 0xB6, 0xD0, 0x01, 0x05, 0x08, 0x06, 0x00, 0x00, 0x03, 0x8A, 0x00, 0x38, 0xDB, 0x62,
+	0x6D, 0xB6, 0x10, 0x00, 0x6D, 0xB6, 0x10, 0x00, 0x00, 0x38, 0xDB, 0x61, 0x00, 0x00, 0x03, 0x9A,
+	0x01, 0x07, 0x08, 0x03, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
+	0x01, 0x05, 0x08, 0x06, 0xA9, 0x40, 0x00, 0x00, 0x16, 0xBD, 0x83, 0x00, 0x00, 0x01, 0x6B, 0xD7,
+	0x00, 0x01, 0x6B, 0xD7, 0x16, 0xBD, 0x93, 0x00, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x03, 0x06, 0x09,
+	0x06, 0xDE, 0xA0, 0x29, 0x12, 0xD6, 0x00, 0x00, 0xC6, 0x00, 0x09, 0xB0, 0x00, 0x7B, 0x00, 0x00,
+	0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x04, 0x0C, 0x0B, 0x00,
+	0x04, 0xBE, 0xEC, 0x60, 0x00, 0x00, 0x8C, 0x52, 0x13, 0xAB, 0x10, 0x05, 0xB1, 0x00, 0x00, 0x08,
+	0x80, 0x0C, 0x20, 0x8E, 0xD8, 0x80, 0xD0, 0x1B, 0x04, 0xC2, 0x2C, 0x80, 0xB2, 0x3A, 0x06, 0x80,
+	0x07, 0x80, 0xC0, 0x2B, 0x04, 0xC2, 0x1C, 0x87, 0x90, 0x0C, 0x20, 0x8E, 0xC8, 0xD8, 0x00, 0x06,
+	0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x41, 0x14, 0xB3, 0x00, 0x00, 0x05, 0xBE, 0xEC, 0x71,
+	0x00, 0x00, 0x03, 0x08, 0x09, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B,
+	0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF,
+	0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x01, 0x03, 0x07, 0x09, 0xCF, 0xFE, 0xB3,
+	0x0C, 0x50, 0x19, 0xC0, 0xC5, 0x00, 0x3F, 0x0C, 0x50, 0x19, 0xB0, 0xCF, 0xFF, 0xE3, 0x0C, 0x50,
+	0x05, 0xE2, 0xC5, 0x00, 0x0E, 0x5C, 0x50, 0x05, 0xF3, 0xCF, 0xFF, 0xD6, 0x00, 0x00, 0x03, 0x08,
+	0x09, 0x00, 0x5C, 0xEE, 0xA2, 0x06, 0xE6, 0x11, 0x59, 0x1E, 0x60, 0x00, 0x00, 0x4F, 0x10, 0x00,
+	0x00, 0x5E, 0x00, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x00, 0x1E, 0x60, 0x00, 0x00, 0x06, 0xE6, 0x11,
+	0x59, 0x00, 0x5C, 0xEE, 0xA2, 0x01, 0x03, 0x08, 0x09, 0xCF, 0xFE, 0xC6, 0x00, 0xC5, 0x01, 0x5D,
+	0xA0, 0xC5, 0x00, 0x03, 0xF3, 0xC5, 0x00, 0x00, 0xD7, 0xC5, 0x00, 0x00, 0xB8, 0xC5, 0x00, 0x00,
+	0xD7, 0xC5, 0x00, 0x03, 0xF3, 0xC5, 0x01, 0x5D, 0xA0, 0xCF, 0xFE, 0xC6, 0x00, 0x01, 0x03, 0x06,
+	0x09, 0xCF, 0xFF, 0xFB, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8,
+	0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x01, 0x03, 0x06, 0x09,
+	0xCF, 0xFF, 0xF3, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xC0, 0xC5,
+	0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x03, 0x09, 0x09, 0x00,
+	0x5C, 0xEE, 0xB5, 0x00, 0x6E, 0x62, 0x14, 0xA1, 0x1E, 0x60, 0x00, 0x00, 0x04, 0xF1, 0x00, 0x00,
+	0x00, 0x5E, 0x00, 0x0C, 0xFF, 0x54, 0xF1, 0x00, 0x00, 0xD5, 0x1E, 0x60, 0x00, 0x0D, 0x50, 0x6E,
+	0x61, 0x13, 0xE5, 0x00, 0x5C, 0xEE, 0xC6, 0x00, 0x01, 0x03, 0x07, 0x09, 0xC5, 0x00, 0x05, 0xDC,
+	0x50, 0x00, 0x5D, 0xC5, 0x00, 0x05, 0xDC, 0x50, 0x00, 0x5D, 0xCF, 0xFF, 0xFF, 0xDC, 0x50, 0x00,
+	0x5D, 0xC5, 0x00, 0x05, 0xDC, 0x50, 0x00, 0x5D, 0xC5, 0x00, 0x05, 0xD0, 0x01, 0x03, 0x02, 0x09,
+	0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xFF, 0x03, 0x04, 0x0B, 0x00, 0xC5, 0x00,
+	0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xD5, 0x04,
+	0xF2, 0x9D, 0x70, 0x01, 0x03, 0x07, 0x09, 0xC5, 0x00, 0x4E, 0x5C, 0x50, 0x4E, 0x40, 0xC5, 0x5E,
+	0x40, 0x0C, 0xAE, 0x40, 0x00, 0xCE, 0xC0, 0x00, 0x0C, 0x6C, 0xB0, 0x00, 0xC5, 0x1C, 0xA0, 0x0C,
+	0x50, 0x1C, 0xA0, 0xC5, 0x00, 0x1D, 0x90, 0x01, 0x03, 0x06, 0x09, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+	0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00,
+	0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF9, 0x01, 0x03, 0x09, 0x09, 0xCF, 0x20, 0x00, 0xCF, 0x3C, 0xD8,
+	0x00, 0x2D, 0xF3, 0xC7, 0xD0, 0x08, 0x7F, 0x3C, 0x5B, 0x40, 0xD2, 0xF3, 0xC5, 0x6A, 0x4B, 0x0F,
+	0x3C, 0x51, 0xEB, 0x50, 0xF3, 0xC5, 0x09, 0xE0, 0x0F, 0x3C, 0x50, 0x00, 0x00, 0xF3, 0xC5, 0x00,
+	0x00, 0x0F, 0x30, 0x01, 0x03, 0x07, 0x09, 0xCE, 0x10, 0x05, 0xCC, 0xE8, 0x00, 0x5C, 0xC7, 0xE1,
+	0x05, 0xCC, 0x59, 0x90, 0x5C, 0xC5, 0x2E, 0x25, 0xCC, 0x50, 0x99, 0x5C, 0xC5, 0x02, 0xE7, 0xCC,
+	0x50, 0x09, 0xEC, 0xC5, 0x00, 0x1E, 0xC0, 0x00, 0x03, 0x09, 0x09, 0x00, 0x5C, 0xFE, 0x91, 0x00,
+	0x6E, 0x51, 0x2B, 0xC0, 0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1, 0x00, 0x00, 0x9A, 0x5E, 0x00, 0x00,
+	0x08, 0xB4, 0xF1, 0x00, 0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E, 0x60, 0x6E, 0x51, 0x2B, 0xC0, 0x00,
+	0x6C, 0xFE, 0x91, 0x00, 0x01, 0x03, 0x06, 0x09, 0xCF, 0xFE, 0xA1, 0xC5, 0x02, 0xC9, 0xC5, 0x00,
+	0x7C, 0xC5, 0x02, 0xC9, 0xCF, 0xFE, 0xA1, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00,
+	0xC5, 0x00, 0x00, 0x00, 0x03, 0x09, 0x0B, 0x00, 0x5C, 0xFE, 0x91, 0x00, 0x6E, 0x51, 0x2B, 0xC0,
+	0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1, 0x00, 0x00, 0x9A, 0x5E, 0x00, 0x00, 0x08, 0xB4, 0xF1, 0x00,
+	0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E, 0x60, 0x6E, 0x51, 0x2B, 0xC0, 0x00, 0x5C, 0xFF, 0xB1, 0x00,
+	0x00, 0x00, 0x7D, 0x10, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x01, 0x03, 0x07, 0x09, 0xCF, 0xFE, 0xA1,
+	0x0C, 0x50, 0x2C, 0x90, 0xC5, 0x00, 0x7C, 0x0C, 0x50, 0x2C, 0x90, 0xCF, 0xFF, 0xB1, 0x0C, 0x50,
+	0x3E, 0x40, 0xC5, 0x00, 0x7C, 0x0C, 0x50, 0x01, 0xE5, 0xC5, 0x00, 0x08, 0xC0, 0x00, 0x03, 0x07,
+	0x09, 0x03, 0xBE, 0xD8, 0x10, 0xE7, 0x12, 0x76, 0x2F, 0x00, 0x00, 0x01, 0xE8, 0x20, 0x00, 0x02,
+	0xAE, 0xE9, 0x10, 0x00, 0x02, 0xBA, 0x00, 0x00, 0x05, 0xE2, 0xA3, 0x12, 0xBB, 0x05, 0xCE, 0xEA,
+	0x10, 0x00, 0x03, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40,
+	0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40,
+	0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x01, 0x03, 0x07, 0x09, 0xE4, 0x00, 0x07,
+	0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40,
+	0x00, 0x7B, 0xC6, 0x00, 0x09, 0x97, 0xD3, 0x14, 0xE4, 0x07, 0xDE, 0xC5, 0x00, 0x00, 0x03, 0x08,
+	0x09, 0xB8, 0x00, 0x00, 0x5E, 0x5D, 0x00, 0x00, 0xA8, 0x1E, 0x40, 0x01, 0xF3, 0x09, 0x90, 0x06,
+	0xC0, 0x04, 0xE1, 0x0C, 0x70, 0x00, 0xD5, 0x2F, 0x10, 0x00, 0x7B, 0x7B, 0x00, 0x00, 0x2F, 0xD5,
+	0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0x0C, 0x09, 0x7B, 0x00, 0x0D, 0xB0, 0x00, 0xD5, 0x3E,
+	0x00, 0x1D, 0xE0, 0x01, 0xF2, 0x0E, 0x30, 0x59, 0xB3, 0x05, 0xD0, 0x0B, 0x70, 0x96, 0x87, 0x09,
+	0x90, 0x08, 0xA0, 0xC2, 0x4A, 0x0C, 0x60, 0x04, 0xE1, 0xE0, 0x1E, 0x1F, 0x20, 0x01, 0xF7, 0xA0,
+	0x0C, 0x7D, 0x00, 0x00, 0xCE, 0x60, 0x09, 0xEA, 0x00, 0x00, 0x8F, 0x30, 0x05, 0xF6, 0x00, 0x00,
+	0x03, 0x08, 0x09, 0x1D, 0x50, 0x01, 0xD5, 0x04, 0xE1, 0x09, 0xA0, 0x00, 0xAA, 0x4E, 0x10, 0x00,
+	0x1E, 0xE5, 0x00, 0x00, 0x0A, 0xE1, 0x00, 0x00, 0x5E, 0xB9, 0x00, 0x01, 0xE5, 0x1E, 0x40, 0x0A,
+	0xA0, 0x06, 0xD0, 0x5E, 0x10, 0x00, 0xB8, 0x00, 0x03, 0x08, 0x09, 0xB9, 0x00, 0x04, 0xE1, 0x2E,
+	0x40, 0x1D, 0x60, 0x06, 0xD0, 0x8B, 0x00, 0x00, 0xBA, 0xE2, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00,
+	0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00,
+	0x03, 0x08, 0x09, 0x5F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0xE2, 0x00, 0x00, 0x2E, 0x50, 0x00,
+	0x01, 0xD8, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x7D, 0x10, 0x00, 0x04, 0xE3, 0x00, 0x00, 0x2E,
+	0x60, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFA, 0x01, 0x03, 0x03, 0x0B, 0xFF, 0x8F, 0x20, 0xF2, 0x0F,
+	0x20, 0xF2, 0x0F, 0x20, 0xF2, 0x0F, 0x20, 0xF2, 0x0F, 0x20, 0xFF, 0x80, 0x00, 0x03, 0x04, 0x0A,
+	0xD2, 0x00, 0x87, 0x00, 0x4B, 0x00, 0x0E, 0x10, 0x0A, 0x60, 0x05, 0xA0, 0x01, 0xE0, 0x00, 0xB4,
+	0x00, 0x69, 0x00, 0x2D, 0x01, 0x03, 0x03, 0x0B, 0xCF, 0xA0, 0x7A, 0x07, 0xA0, 0x7A, 0x07, 0xA0,
+	0x7A, 0x07, 0xA0, 0x7A, 0x07, 0xA0, 0x7A, 0xCF, 0xA0, 0x01, 0x03, 0x08, 0x03, 0x00, 0x3D, 0xE3,
+	0x00, 0x03, 0xD5, 0x4D, 0x40, 0x4C, 0x30, 0x02, 0xC4, 0xFF, 0x0E, 0x08, 0x01, 0x2F, 0xFF, 0xFF,
+	0xF2, 0x01, 0x02, 0x03, 0x02, 0x88, 0x00, 0x96, 0x00, 0x05, 0x07, 0x07, 0x0C, 0xFF, 0xC3, 0x00,
+	0x00, 0x16, 0xD0, 0x00, 0x00, 0x0D, 0x20, 0x6D, 0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17,
+	0xF4, 0x08, 0xEE, 0x9C, 0x40, 0x01, 0x02, 0x06, 0x0A, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE3,
+	0x00, 0x00, 0xE7, 0xDE, 0x90, 0xEC, 0x22, 0xC7, 0xE5, 0x00, 0x5D, 0xE3, 0x00, 0x3E, 0xE5, 0x00,
+	0x5D, 0xEC, 0x22, 0xC7, 0xE7, 0xDE, 0x90, 0x00, 0x05, 0x06, 0x07, 0x02, 0xAE, 0xD4, 0x0C, 0x91,
+	0x28, 0x3E, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0C, 0x91, 0x28, 0x02, 0xAE, 0xD4,
+	0x00, 0x02, 0x07, 0x0A, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x88, 0x00, 0x00, 0x08, 0x80, 0x2C,
+	0xEB, 0xA8, 0x0D, 0x81, 0x5F, 0x83, 0xE0, 0x00, 0xB8, 0x5C, 0x00, 0x09, 0x83, 0xE0, 0x00, 0xB8,
+	0x0D, 0x81, 0x5F, 0x80, 0x3C, 0xEB, 0xA8, 0x00, 0x05, 0x07, 0x07, 0x01, 0xAE, 0xD7, 0x00, 0xC9,
+	0x12, 0xD4, 0x3E, 0x00, 0x06, 0x95, 0xFF, 0xFF, 0xFB, 0x3D, 0x00, 0x00, 0x00, 0xC8, 0x11, 0x66,
+	0x01, 0xAE, 0xE9, 0x10, 0x00, 0x02, 0x05, 0x0A, 0x02, 0xCF, 0x70, 0x89, 0x00, 0x0A, 0x60, 0x0B,
+	0xFF, 0xF3, 0x0A, 0x60, 0x00, 0xA6, 0x00, 0x0A, 0x60, 0x00, 0xA6, 0x00, 0x0A, 0x60, 0x00, 0xA6,
+	0x00, 0x00, 0x05, 0x07, 0x0A, 0x03, 0xCE, 0xBA, 0x80, 0xD7, 0x15, 0xF8, 0x3E, 0x00, 0x0A, 0x85,
+	0xC0, 0x00, 0x98, 0x3E, 0x00, 0x0A, 0x80, 0xD7, 0x15, 0xF8, 0x03, 0xCE, 0xBA, 0x80, 0x00, 0x00,
+	0xB6, 0x06, 0x41, 0x6E, 0x20, 0x2B, 0xEC, 0x40, 0x01, 0x02, 0x06, 0x0A, 0xE3, 0x00, 0x00, 0xE3,
+	0x00, 0x00, 0xE3, 0x00, 0x00, 0xE7, 0xDE, 0xA0, 0xEB, 0x22, 0xD6, 0xE4, 0x00, 0x88, 0xE3, 0x00,
+	0x79, 0xE3, 0x00, 0x79, 0xE3, 0x00, 0x79, 0xE3, 0x00, 0x79, 0x01, 0x03, 0x02, 0x09, 0xD3, 0x00,
+	0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xFF, 0x03, 0x04, 0x0C, 0x00, 0xD3, 0x00, 0x00, 0x00,
+	0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x02,
+	0xE1, 0x3E, 0x80, 0x01, 0x02, 0x06, 0x0A, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00,
+	0xE3, 0x03, 0xD4, 0xE3, 0x4D, 0x30, 0xE7, 0xD3, 0x00, 0xEE, 0x90, 0x00, 0xE4, 0xD7, 0x00, 0xE3,
+	0x1D, 0x70, 0xE3, 0x02, 0xD7, 0x01, 0x02, 0x02, 0x0A, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+	0xD3, 0xD3, 0xD3, 0x01, 0x05, 0x0A, 0x07, 0xE8, 0xDE, 0x93, 0xCE, 0xB1, 0xEB, 0x12, 0xED, 0x31,
+	0xB7, 0xE4, 0x00, 0xA7, 0x00, 0x7A, 0xE3, 0x00, 0xA6, 0x00, 0x6A, 0xE3, 0x00, 0xA6, 0x00, 0x6A,
+	0xE3, 0x00, 0xA6, 0x00, 0x6A, 0xE3, 0x00, 0xA6, 0x00, 0x6A, 0x01, 0x05, 0x06, 0x07, 0xE7, 0xDE,
+	0xA0, 0xEB, 0x22, 0xD6, 0xE4, 0x00, 0x88, 0xE3, 0x00, 0x79, 0xE3, 0x00, 0x79, 0xE3, 0x00, 0x79,
+	0xE3, 0x00, 0x79, 0x00, 0x05, 0x07, 0x07, 0x02, 0xBE, 0xD5, 0x00, 0xD8, 0x14, 0xE3, 0x3E, 0x00,
+	0x09, 0x85, 0xC0, 0x00, 0x7A, 0x3E, 0x00, 0x09, 0x80, 0xD8, 0x14, 0xE3, 0x02, 0xBE, 0xD5, 0x00,
+	0x01, 0x05, 0x06, 0x0A, 0xE7, 0xDE, 0x90, 0xEC, 0x22, 0xC7, 0xE5, 0x00, 0x5D, 0xE3, 0x00, 0x3E,
+	0xE5, 0x00, 0x5D, 0xEC, 0x22, 0xC7, 0xE7, 0xDE, 0x90, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE3,
+	0x00, 0x00, 0x00, 0x05, 0x07, 0x0A, 0x02, 0xCE, 0xBA, 0x80, 0xD8, 0x15, 0xF8, 0x3E, 0x00, 0x0B,
+	0x85, 0xC0, 0x00, 0x98, 0x3E, 0x00, 0x0B, 0x80, 0xD8, 0x15, 0xF8, 0x03, 0xCE, 0xBA, 0x80, 0x00,
+	0x00, 0x88, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x88, 0x01, 0x05, 0x04, 0x07, 0xE7, 0xCE, 0xEC,
+	0x20, 0xE4, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0x00, 0x05, 0x06, 0x07, 0x08,
+	0xEE, 0x91, 0x3E, 0x21, 0x64, 0x3D, 0x10, 0x00, 0x06, 0xBC, 0x71, 0x00, 0x01, 0xA8, 0x57, 0x21,
+	0xA9, 0x18, 0xDE, 0xA1, 0x00, 0x03, 0x05, 0x09, 0x0D, 0x30, 0x00, 0xD3, 0x00, 0xAF, 0xFF, 0x60,
+	0xD3, 0x00, 0x0D, 0x30, 0x00, 0xD3, 0x00, 0x0D, 0x30, 0x00, 0xC6, 0x00, 0x05, 0xDF, 0x60, 0x01,
+	0x05, 0x06, 0x07, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xE2,
+	0x00, 0xA8, 0xC8, 0x14, 0xE8, 0x3C, 0xEA, 0xA8, 0x00, 0x05, 0x07, 0x07, 0x7A, 0x00, 0x09, 0x92,
+	0xE1, 0x00, 0xE3, 0x0C, 0x60, 0x4D, 0x00, 0x6B, 0x09, 0x80, 0x01, 0xF2, 0xE2, 0x00, 0x0B, 0xBC,
+	0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x05, 0x0A, 0x07, 0x6B, 0x00, 0xDA, 0x00, 0xD3, 0x2E, 0x01,
+	0xDD, 0x02, 0xE0, 0x0D, 0x35, 0x9C, 0x26, 0xA0, 0x0A, 0x79, 0x58, 0x69, 0x70, 0x06, 0xAC, 0x24,
+	0xAD, 0x30, 0x02, 0xED, 0x01, 0xEE, 0x00, 0x00, 0xE9, 0x00, 0xCB, 0x00, 0x00, 0x05, 0x07, 0x07,
+	0x2E, 0x30, 0x1E, 0x40, 0x6D, 0x1B, 0x80, 0x00, 0xAC, 0xC0, 0x00, 0x05, 0xF6, 0x00, 0x01, 0xD9,
+	0xD1, 0x00, 0x9A, 0x09, 0xA0, 0x5D, 0x10, 0x1D, 0x50, 0x00, 0x05, 0x07, 0x0A, 0x7A, 0x00, 0x09,
+	0x81, 0xE1, 0x00, 0xE3, 0x0A, 0x70, 0x5D, 0x00, 0x5C, 0x0B, 0x70, 0x00, 0xE4, 0xF2, 0x00, 0x08,
+	0xEB, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x03, 0xE1, 0x00, 0x00, 0x99, 0x00, 0x01, 0xFD, 0x20, 0x00,
+	0x00, 0x05, 0x06, 0x07, 0x5F, 0xFF, 0xFC, 0x00, 0x00, 0xC6, 0x00, 0x0A, 0x90, 0x00, 0x7B, 0x00,
+	0x04, 0xD1, 0x00, 0x2E, 0x30, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0x03, 0x06, 0x0B, 0x00, 0x3C, 0xF2,
+	0x00, 0x99, 0x00, 0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00, 0x02, 0xD4, 0x00, 0x8F, 0xB0, 0x00, 0x02,
+	0xD4, 0x00, 0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x99, 0x00, 0x00, 0x3D, 0xF2, 0x01, 0x03,
+	0x02, 0x0C, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x01, 0x03,
+	0x06, 0x0B, 0x7E, 0xA0, 0x00, 0x01, 0xD3, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xA9,
+	0x00, 0x00, 0x3E, 0xF2, 0x00, 0xA9, 0x10, 0x00, 0xB5, 0x00, 0x00, 0xC5, 0x00, 0x01, 0xD3, 0x00,
+	0x7E, 0xA0, 0x00, 0x01, 0x07, 0x08, 0x02, 0x3B, 0xEB, 0x51, 0x39, 0x73, 0x15, 0xBE, 0xC3, 0x01,
+	0x03, 0x04, 0x04, 0x3D, 0xD3, 0xB3, 0x3B, 0xB2, 0x3B, 0x4D, 0xD3, 0x00, 0x01, 0x08, 0x0B, 0x00,
+	0x1D, 0x10, 0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00,
+	0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E,
+	0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x08, 0x0B, 0x00,
+	0x00, 0xC3, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00,
+	0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E,
+	0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x08, 0x0B, 0x00,
+	0x0B, 0xC1, 0x00, 0x00, 0x58, 0x49, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00,
+	0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E,
+	0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x08, 0x0B, 0x00,
+	0x6E, 0x4C, 0x00, 0x00, 0xB3, 0xC9, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00,
+	0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E,
+	0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x01, 0x01, 0x06, 0x0B, 0x03,
+	0xC0, 0x00, 0x00, 0x87, 0x00, 0xCF, 0xFF, 0xFB, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+	0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xFC,
+	0x01, 0x01, 0x06, 0x0B, 0x00, 0x1D, 0x10, 0x00, 0x95, 0x00, 0xCF, 0xFF, 0xFB, 0xC5, 0x00, 0x00,
+	0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5,
+	0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x01, 0x01, 0x06, 0x0B, 0x01, 0xCB, 0x00, 0x08, 0x57, 0x60, 0xCF,
+	0xFF, 0xFB, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00,
+	0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x01, 0x03, 0x0B, 0x5B, 0x00,
+	0xA5, 0x0C, 0x50, 0xC5, 0x0C, 0x50, 0xC5, 0x0C, 0x50, 0xC5, 0x0C, 0x50, 0xC5, 0x0C, 0x50, 0x01,
+	0x01, 0x02, 0x0B, 0x3C, 0xB3, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x00, 0x01,
+	0x09, 0x0B, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x5C, 0xFE, 0x91, 0x00,
+	0x6E, 0x51, 0x2B, 0xC0, 0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1, 0x00, 0x00, 0x9A, 0x5E, 0x00, 0x00,
+	0x08, 0xB4, 0xF1, 0x00, 0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E, 0x60, 0x6E, 0x51, 0x2B, 0xC0, 0x00,
+	0x6C, 0xFE, 0x91, 0x00, 0x00, 0x01, 0x09, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0C, 0x20,
+	0x00, 0x00, 0x5C, 0xFE, 0x91, 0x00, 0x6E, 0x51, 0x2B, 0xC0, 0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1,
+	0x00, 0x00, 0x9A, 0x5E, 0x00, 0x00, 0x08, 0xB4, 0xF1, 0x00, 0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E,
+	0x60, 0x6E, 0x51, 0x2B, 0xC0, 0x00, 0x6C, 0xFE, 0x91, 0x00, 0x00, 0x01, 0x09, 0x0B, 0x00, 0x02,
+	0xD9, 0x00, 0x00, 0x00, 0xB2, 0xA3, 0x00, 0x00, 0x5C, 0xFE, 0x91, 0x00, 0x6E, 0x51, 0x2B, 0xC0,
+	0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1, 0x00, 0x00, 0x9A, 0x5E, 0x00, 0x00, 0x08, 0xB4, 0xF1, 0x00,
+	0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E, 0x60, 0x6E, 0x51, 0x2B, 0xC0, 0x00, 0x6C, 0xFE, 0x91, 0x00,
+	0x00, 0x01, 0x09, 0x0B, 0x00, 0x0C, 0xB4, 0x90, 0x00, 0x02, 0xA6, 0xE4, 0x00, 0x00, 0x5C, 0xFE,
+	0x91, 0x00, 0x6E, 0x51, 0x2B, 0xC0, 0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1, 0x00, 0x00, 0x9A, 0x5E,
+	0x00, 0x00, 0x08, 0xB4, 0xF1, 0x00, 0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E, 0x60, 0x6E, 0x51, 0x2B,
+	0xC0, 0x00, 0x6C, 0xFE, 0x91, 0x00, 0x01, 0x01, 0x07, 0x0B, 0x00, 0xB5, 0x00, 0x00, 0x02, 0xC1,
+	0x00, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4,
+	0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xC6, 0x00, 0x09, 0x97, 0xD3, 0x14, 0xE4, 0x07, 0xDE, 0xC5,
+	0x00, 0x01, 0x01, 0x07, 0x0B, 0x00, 0x09, 0x70, 0x00, 0x02, 0xB0, 0x00, 0xE4, 0x00, 0x07, 0xBE,
+	0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00,
+	0x7B, 0xC6, 0x00, 0x09, 0x97, 0xD3, 0x14, 0xE4, 0x07, 0xDE, 0xC5, 0x00, 0x00, 0x01, 0x08, 0x0B,
+	0x00, 0x04, 0xB0, 0x00, 0x00, 0x0C, 0x20, 0x00, 0xB9, 0x00, 0x04, 0xE1, 0x2E, 0x40, 0x1D, 0x60,
+	0x06, 0xD0, 0x8B, 0x00, 0x00, 0xBA, 0xE2, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x0E, 0x40, 0x00,
+	0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x02, 0x07, 0x0A,
+	0x02, 0xC2, 0x00, 0x00, 0x03, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFC, 0x30, 0x00, 0x01,
+	0x6D, 0x00, 0x00, 0x00, 0xD2, 0x06, 0xDF, 0xFF, 0x42, 0xE3, 0x00, 0xD4, 0x3E, 0x21, 0x7F, 0x40,
+	0x8E, 0xE9, 0xC4, 0x00, 0x02, 0x07, 0x0A, 0x00, 0x02, 0xC2, 0x00, 0x01, 0xB2, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xCF, 0xFC, 0x30, 0x00, 0x01, 0x6D, 0x00, 0x00, 0x00, 0xD2, 0x06, 0xDF, 0xFF, 0x42,
+	0xE3, 0x00, 0xD4, 0x3E, 0x21, 0x7F, 0x40, 0x8E, 0xE9, 0xC4, 0x00, 0x02, 0x07, 0x0A, 0x00, 0x5E,
+	0x40, 0x00, 0x2B, 0x1B, 0x10, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFC, 0x30, 0x00, 0x01, 0x6D, 0x00,
+	0x00, 0x00, 0xD2, 0x06, 0xDF, 0xFF, 0x42, 0xE3, 0x00, 0xD4, 0x3E, 0x21, 0x7F, 0x40, 0x8E, 0xE9,
+	0xC4, 0x00, 0x03, 0x07, 0x09, 0x02, 0xE7, 0x65, 0x00, 0x66, 0x8D, 0x10, 0x0C, 0xFF, 0xC3, 0x00,
+	0x00, 0x16, 0xD0, 0x00, 0x00, 0x0D, 0x20, 0x6D, 0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17,
+	0xF4, 0x08, 0xEE, 0x9C, 0x40, 0x00, 0x02, 0x07, 0x0A, 0x00, 0xA6, 0x00, 0x00, 0x00, 0xB3, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1A, 0xED, 0x70, 0x0C, 0x91, 0x2D, 0x43, 0xE0, 0x00, 0x69, 0x5F, 0xFF,
+	0xFF, 0xB3, 0xD0, 0x00, 0x00, 0x0C, 0x81, 0x16, 0x60, 0x1A, 0xEE, 0x91, 0x00, 0x02, 0x07, 0x0A,
+	0x00, 0x00, 0xB5, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xED, 0x70, 0x0C, 0x91,
+	0x2D, 0x43, 0xE0, 0x00, 0x69, 0x5F, 0xFF, 0xFF, 0xB3, 0xD0, 0x00, 0x00, 0x0C, 0x81, 0x16, 0x60,
+	0x1A, 0xEE, 0x91, 0x00, 0x02, 0x07, 0x0A, 0x00, 0x1D, 0x90, 0x00, 0x0A, 0x38, 0x50, 0x00, 0x00,
+	0x00, 0x00, 0x1A, 0xED, 0x70, 0x0C, 0x91, 0x2D, 0x43, 0xE0, 0x00, 0x69, 0x5F, 0xFF, 0xFF, 0xB3,
+	0xD0, 0x00, 0x00, 0x0C, 0x81, 0x16, 0x60, 0x1A, 0xEE, 0x91, 0xFF, 0x02, 0x04, 0x0A, 0x1C, 0x40,
+	0x01, 0xB2, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3,
+	0x00, 0xD3, 0x01, 0x02, 0x03, 0x0A, 0x1C, 0x3A, 0x40, 0x00, 0x0D, 0x30, 0xD3, 0x0D, 0x30, 0xD3,
+	0x0D, 0x30, 0xD3, 0x0D, 0x30, 0x00, 0x02, 0x07, 0x0A, 0x01, 0xC4, 0x00, 0x00, 0x01, 0xB2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2B, 0xED, 0x50, 0x0D, 0x81, 0x4E, 0x33, 0xE0, 0x00, 0x98, 0x5C, 0x00,
+	0x07, 0xA3, 0xE0, 0x00, 0x98, 0x0D, 0x81, 0x4E, 0x30, 0x2B, 0xED, 0x50, 0x00, 0x02, 0x07, 0x0A,
+	0x00, 0x01, 0xC3, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xED, 0x50, 0x0D, 0x81,
+	0x4E, 0x33, 0xE0, 0x00, 0x98, 0x5C, 0x00, 0x07, 0xA3, 0xE0, 0x00, 0x98, 0x0D, 0x81, 0x4E, 0x30,
+	0x2B, 0xED, 0x50, 0x00, 0x02, 0x07, 0x0A, 0x00, 0x2D, 0x70, 0x00, 0x0B, 0x2A, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x2B, 0xED, 0x50, 0x0D, 0x81, 0x4E, 0x33, 0xE0, 0x00, 0x98, 0x5C, 0x00, 0x07, 0xA3,
+	0xE0, 0x00, 0x98, 0x0D, 0x81, 0x4E, 0x30, 0x2B, 0xED, 0x50, 0x00, 0x03, 0x07, 0x09, 0x00, 0xCA,
+	0x48, 0x00, 0x38, 0x5E, 0x30, 0x02, 0xBE, 0xD5, 0x00, 0xD8, 0x14, 0xE3, 0x3E, 0x00, 0x09, 0x85,
+	0xC0, 0x00, 0x7A, 0x3E, 0x00, 0x09, 0x80, 0xD8, 0x14, 0xE3, 0x02, 0xBE, 0xD5, 0x00, 0x01, 0x02,
+	0x06, 0x0A, 0x1B, 0x40, 0x00, 0x01, 0xB2, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x88, 0xF1, 0x00,
+	0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xE2, 0x00, 0xA8, 0xC8, 0x14, 0xE8, 0x3C, 0xEA, 0xA8,
+	0x01, 0x02, 0x06, 0x0A, 0x00, 0x1C, 0x40, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x88,
+	0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xE2, 0x00, 0xA8, 0xC8, 0x14, 0xE8, 0x3C,
+	0xEA, 0xA8, 0x00, 0x02, 0x07, 0x0D, 0x00, 0x02, 0xC2, 0x00, 0x01, 0xB3, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xA0, 0x00, 0x98, 0x1E, 0x10, 0x0E, 0x30, 0xA7, 0x05, 0xD0, 0x05, 0xC0, 0xB7, 0x00, 0x0E,
+	0x4F, 0x20, 0x00, 0x8E, 0xB0, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x3E, 0x10, 0x00, 0x09, 0x90, 0x00,
+	0x1F, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x86, 0x2C, 0x00, 0x00, 0x2D, 0xE6, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00,
+	0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3,
+	0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x02, 0x07, 0x0A, 0x04, 0x91, 0xA3, 0x00,
+	0x0A, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFC, 0x30, 0x00, 0x01, 0x6D, 0x00, 0x00, 0x00,
+	0xD2, 0x06, 0xDF, 0xFF, 0x42, 0xE3, 0x00, 0xD4, 0x3E, 0x21, 0x7F, 0x40, 0x8E, 0xE9, 0xC4, 0x00,
+	0x03, 0x09, 0x09, 0x0C, 0xFF, 0xEC, 0x70, 0x00, 0xC6, 0x01, 0x4D, 0xB0, 0x0C, 0x60, 0x00, 0x2F,
+	0x40, 0xC6, 0x00, 0x00, 0xC8, 0xEF, 0xFF, 0x60, 0x0A, 0x90, 0xC6, 0x00, 0x00, 0xC8, 0x0C, 0x60,
+	0x00, 0x2F, 0x40, 0xC6, 0x01, 0x4D, 0xB0, 0x0C, 0xFF, 0xEC, 0x70, 0x00, 0x00, 0x02, 0x08, 0x0A,
+	0x00, 0x00, 0x08, 0x80, 0x00, 0x07, 0xFF, 0xF7, 0x00, 0x00, 0x08, 0x80, 0x02, 0xCE, 0xBA, 0x80,
+	0x0D, 0x81, 0x5F, 0x80, 0x3E, 0x00, 0x0B, 0x80, 0x5C, 0x00, 0x09, 0x80, 0x3E, 0x00, 0x0B, 0x80,
+	0x0D, 0x81, 0x5F, 0x80, 0x03, 0xCE, 0xBA, 0x80, 0xFF, 0x01, 0x05, 0x0B, 0x0B, 0xB3, 0xA2, 0xA5,
+	0xE4, 0x00, 0xC5, 0x00, 0x0C, 0x50, 0x00, 0xC5, 0x00, 0x0C, 0x50, 0x00, 0xC5, 0x00, 0x0C, 0x50,
+	0x00, 0xC5, 0x00, 0x0C, 0x50, 0x00, 0xC5, 0x00, 0xFF, 0x03, 0x05, 0x09, 0x0C, 0xA4, 0x83, 0x85,
+	0xE3, 0x00, 0xD3, 0x00, 0x0D, 0x30, 0x00, 0xD3, 0x00, 0x0D, 0x30, 0x00, 0xD3, 0x00, 0x0D, 0x30,
+	0x00, 0xD3, 0x00, 0x01, 0x01, 0x07, 0x0B, 0x03, 0xE7, 0x84, 0x00, 0x75, 0xAD, 0x10, 0xE4, 0x00,
+	0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE,
+	0x40, 0x00, 0x7B, 0xC6, 0x00, 0x09, 0x97, 0xD3, 0x14, 0xE4, 0x07, 0xDE, 0xC5, 0x00, 0x01, 0x03,
+	0x06, 0x09, 0x0B, 0xB2, 0xA0, 0x2A, 0x4E, 0x50, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00,
+	0x88, 0xF1, 0x00, 0x88, 0xE2, 0x00, 0xA8, 0xC8, 0x14, 0xE8, 0x3C, 0xEA, 0xA8, 0x00, 0x03, 0x0A,
+	0x09, 0x00, 0x6D, 0xFD, 0x93, 0xA2, 0x07, 0xE5, 0x13, 0xCF, 0xE1, 0x1F, 0x50, 0x00, 0x1E, 0x50,
+	0x5F, 0x00, 0x00, 0x0A, 0x90, 0x6D, 0x00, 0x00, 0x09, 0xA0, 0x5F, 0x00, 0x00, 0x0A, 0x90, 0x1F,
+	0x50, 0x00, 0x1E, 0x50, 0x08, 0xE5, 0x13, 0xCB, 0x00, 0x00, 0x6D, 0xFE, 0x91, 0x00, 0x00, 0x05,
+	0x08, 0x07, 0x02, 0xBE, 0xD8, 0x93, 0x0C, 0x91, 0x4F, 0xF1, 0x3E, 0x00, 0x09, 0x90, 0x4D, 0x00,
+	0x07, 0xA0, 0x3E, 0x00, 0x09, 0x90, 0x0C, 0x81, 0x4E, 0x30, 0x02, 0xBE, 0xD6, 0x00, 0x01, 0x03,
+	0x09, 0x09, 0xF3, 0x00, 0x07, 0xE4, 0x8F, 0x30, 0x00, 0x7F, 0xE5, 0xF3, 0x00, 0x07, 0xB0, 0x0F,
+	0x30, 0x00, 0x7B, 0x00, 0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30, 0x00, 0x8A, 0x00, 0xD5, 0x00, 0x0A,
+	0x80, 0x07, 0xC3, 0x14, 0xE3, 0x00, 0x08, 0xDE, 0xC5, 0x00, 0x00, 0x01, 0x05, 0x08, 0x07, 0xF2,
+	0x00, 0xAA, 0xB1, 0xF2, 0x00, 0x9F, 0xD0, 0xF2, 0x00, 0x88, 0x00, 0xF2, 0x00, 0x88, 0x00, 0xE2,
+	0x00, 0x98, 0x00, 0xB8, 0x14, 0xE8, 0x00, 0x3C, 0xEA, 0x98, 0x00, 0x00, 0x03, 0x08, 0x0C, 0x00,
+	0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04,
+	0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8,
+	0x00, 0x00, 0x5E, 0x00, 0x01, 0x20, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00,
+	0x05, 0x07, 0x0A, 0x0C, 0xFF, 0xC3, 0x00, 0x00, 0x16, 0xD0, 0x00, 0x00, 0x0D, 0x20, 0x6D, 0xFF,
+	0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17, 0xF4, 0x08, 0xEE, 0x9C, 0x40, 0x01, 0x20, 0x00, 0x00,
+	0x5B, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x02,
+	0x56, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A,
+	0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF,
+	0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x02, 0x07, 0x0A, 0x00, 0x6E,
+	0x90, 0x00, 0x02, 0x1B, 0x00, 0x00, 0x09, 0x20, 0x00, 0xCF, 0xFC, 0x30, 0x00, 0x01, 0x6D, 0x00,
+	0x00, 0x00, 0xD2, 0x06, 0xDF, 0xFF, 0x42, 0xE3, 0x00, 0xD4, 0x3E, 0x21, 0x7F, 0x40, 0x8E, 0xE9,
+	0xC4, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x0B, 0xC5, 0x90, 0x00, 0x58, 0x49,
+	0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F,
+	0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00,
+	0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x02, 0x07, 0x0A, 0x00, 0x00, 0x05, 0xA0, 0x05, 0xE6, 0xC1,
+	0x01, 0xB1, 0xB1, 0x00, 0xCF, 0xFC, 0x30, 0x00, 0x01, 0x6D, 0x00, 0x00, 0x00, 0xD2, 0x06, 0xDF,
+	0xFF, 0x42, 0xE3, 0x00, 0xD4, 0x3E, 0x21, 0x7F, 0x40, 0x8E, 0xE9, 0xC4, 0x00, 0x00, 0x08, 0x0C,
+	0x00, 0x00, 0x4B, 0x00, 0x00, 0x0B, 0xCA, 0x50, 0x00, 0x58, 0x49, 0x00, 0x00, 0x0B, 0xE0, 0x00,
+	0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70,
+	0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E,
+	0x00, 0x02, 0x07, 0x0A, 0x00, 0x01, 0xD2, 0x00, 0x06, 0xE9, 0xB0, 0x01, 0xB1, 0xB1, 0x00, 0xCF,
+	0xFC, 0x30, 0x00, 0x01, 0x6D, 0x00, 0x00, 0x00, 0xD2, 0x06, 0xDF, 0xFF, 0x42, 0xE3, 0x00, 0xD4,
+	0x3E, 0x21, 0x7F, 0x40, 0x8E, 0xE9, 0xC4, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x02, 0x66, 0x00,
+	0x0B, 0xC2, 0xA0, 0x00, 0x58, 0x49, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00,
+	0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E,
+	0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x07, 0x0B, 0x00,
+	0x00, 0x7E, 0x90, 0x00, 0x02, 0x1B, 0x00, 0x6E, 0x59, 0x20, 0x1B, 0x1B, 0x10, 0x0C, 0xFF, 0xC3,
+	0x00, 0x00, 0x16, 0xD0, 0x00, 0x00, 0x0D, 0x20, 0x6D, 0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2,
+	0x17, 0xF4, 0x08, 0xEE, 0x9C, 0x40, 0x00, 0x00, 0x08, 0x0C, 0x00, 0xB3, 0xC9, 0x00, 0x00, 0x0B,
+	0xC1, 0x00, 0x00, 0x58, 0x49, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A,
+	0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF,
+	0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x07, 0x0B, 0x02, 0xE8,
+	0x66, 0x00, 0x66, 0x9D, 0x10, 0x00, 0x6E, 0x50, 0x00, 0x1B, 0x1B, 0x10, 0x0C, 0xFF, 0xC3, 0x00,
+	0x00, 0x16, 0xD0, 0x00, 0x00, 0x0D, 0x20, 0x6D, 0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17,
+	0xF4, 0x08, 0xEE, 0x9C, 0x40, 0x00, 0x01, 0x08, 0x0E, 0x00, 0x0B, 0xC1, 0x00, 0x00, 0x58, 0x49,
+	0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F,
+	0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00,
+	0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x10, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x02, 0x20,
+	0x00, 0x00, 0x02, 0x07, 0x0D, 0x00, 0x5E, 0x40, 0x00, 0x2B, 0x1B, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0xCF, 0xFC, 0x30, 0x00, 0x01, 0x6D, 0x00, 0x00, 0x00, 0xD2, 0x06, 0xDF, 0xFF, 0x42, 0xE3, 0x00,
+	0xD4, 0x3E, 0x21, 0x7F, 0x40, 0x8E, 0xE9, 0xC4, 0x00, 0x12, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x94, 0x2C, 0x00, 0x00,
+	0x3D, 0xE5, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00,
+	0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E,
+	0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x07, 0x0B, 0x00, 0x03, 0xC0, 0x00, 0x00,
+	0xB3, 0x00, 0x04, 0x91, 0xA3, 0x00, 0x0B, 0xE9, 0x00, 0x0C, 0xFF, 0xC3, 0x00, 0x00, 0x16, 0xD0,
+	0x00, 0x00, 0x0D, 0x20, 0x6D, 0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17, 0xF4, 0x08, 0xEE,
+	0x9C, 0x40, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x09, 0x50, 0x00, 0x00, 0x94, 0x2C, 0x00, 0x00, 0x3D,
+	0xE5, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5,
+	0x2F, 0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00,
+	0x00, 0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x07, 0x0B, 0x01, 0xD2, 0x00, 0x00, 0x04, 0xB0,
+	0x00, 0x04, 0x91, 0xA3, 0x00, 0x0A, 0xEA, 0x00, 0x0C, 0xFF, 0xC3, 0x00, 0x00, 0x16, 0xD0, 0x00,
+	0x00, 0x0D, 0x20, 0x6D, 0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17, 0xF4, 0x08, 0xEE, 0x9C,
+	0x40, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x11, 0x75, 0x00, 0x00, 0x97, 0xBC, 0x00, 0x00, 0x3D, 0xE5,
+	0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F,
+	0x10, 0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00,
+	0xB8, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x07, 0x0B, 0x00, 0x8E, 0x70, 0x00, 0x02, 0x2A, 0x00,
+	0x04, 0x9B, 0xB3, 0x00, 0x0A, 0xEA, 0x00, 0x0C, 0xFF, 0xC3, 0x00, 0x00, 0x16, 0xD0, 0x00, 0x00,
+	0x0D, 0x20, 0x6D, 0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17, 0xF4, 0x08, 0xEE, 0x9C, 0x40,
+	0x00, 0x00, 0x08, 0x0C, 0x00, 0xB3, 0xC9, 0x00, 0x00, 0x94, 0x2C, 0x00, 0x00, 0x3D, 0xE5, 0x00,
+	0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10,
+	0x04, 0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8,
+	0xB8, 0x00, 0x00, 0x5E, 0x00, 0x01, 0x07, 0x0B, 0x02, 0xE8, 0x75, 0x00, 0x66, 0x9D, 0x10, 0x04,
+	0x91, 0xA3, 0x00, 0x0A, 0xEA, 0x00, 0x0C, 0xFF, 0xC3, 0x00, 0x00, 0x16, 0xD0, 0x00, 0x00, 0x0D,
+	0x20, 0x6D, 0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17, 0xF4, 0x08, 0xEE, 0x9C, 0x40, 0x00,
+	0x00, 0x08, 0x0F, 0x00, 0x86, 0x2C, 0x00, 0x00, 0x2D, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04,
+	0xE1, 0x0C, 0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8,
+	0x00, 0x00, 0x5E, 0x00, 0x01, 0x20, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00,
+	0x02, 0x07, 0x0D, 0x04, 0x91, 0xA3, 0x00, 0x0A, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFC,
+	0x30, 0x00, 0x01, 0x6D, 0x00, 0x00, 0x00, 0xD2, 0x06, 0xDF, 0xFF, 0x42, 0xE3, 0x00, 0xD4, 0x3E,
+	0x21, 0x7F, 0x40, 0x8E, 0xE9, 0xC4, 0x00, 0x12, 0x00, 0x00, 0x04, 0xC0, 0x00, 0x00, 0x13, 0x00,
+	0x00, 0x01, 0x03, 0x06, 0x0C, 0xCF, 0xFF, 0xFB, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+	0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xFC,
+	0x00, 0x21, 0x00, 0x00, 0x97, 0x00, 0x00, 0x21, 0x00, 0x00, 0x05, 0x07, 0x0A, 0x01, 0xAE, 0xD7,
+	0x00, 0xC9, 0x12, 0xD4, 0x3E, 0x00, 0x06, 0x95, 0xFF, 0xFF, 0xFB, 0x3D, 0x00, 0x00, 0x00, 0xC8,
+	0x11, 0x66, 0x01, 0xAE, 0xE9, 0x10, 0x00, 0x21, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x21, 0x00,
+	0x01, 0x00, 0x06, 0x0C, 0x02, 0xDD, 0x20, 0x01, 0x18, 0x40, 0x00, 0x38, 0x00, 0xCF, 0xFF, 0xFB,
+	0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00, 0x00, 0xC5,
+	0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x02, 0x07, 0x0A, 0x00, 0x3D, 0xD1, 0x00,
+	0x01, 0x19, 0x20, 0x00, 0x04, 0x70, 0x00, 0x1A, 0xED, 0x70, 0x0C, 0x91, 0x2D, 0x43, 0xE0, 0x00,
+	0x69, 0x5F, 0xFF, 0xFF, 0xB3, 0xD0, 0x00, 0x00, 0x0C, 0x81, 0x16, 0x60, 0x1A, 0xEE, 0x91, 0x01,
+	0x01, 0x06, 0x0B, 0x09, 0xD3, 0xB0, 0x0C, 0x4D, 0x60, 0xCF, 0xFF, 0xFB, 0xC5, 0x00, 0x00, 0xC5,
+	0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+	0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x03, 0x07, 0x09, 0x00, 0x9C, 0x2B, 0x00, 0x0B, 0x3D, 0x60, 0x01,
+	0xAE, 0xD7, 0x00, 0xC9, 0x12, 0xD4, 0x3E, 0x00, 0x06, 0x95, 0xFF, 0xFF, 0xFB, 0x3D, 0x00, 0x00,
+	0x00, 0xC8, 0x11, 0x66, 0x01, 0xAE, 0xE9, 0x10, 0x01, 0x00, 0x07, 0x0C, 0x00, 0x00, 0x0B, 0x50,
+	0x0B, 0xC5, 0x90, 0x05, 0x84, 0x90, 0x0C, 0xFF, 0xFF, 0xB0, 0xC5, 0x00, 0x00, 0x0C, 0x50, 0x00,
+	0x00, 0xC5, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x80, 0xC5, 0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0xC5,
+	0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0x08, 0x0A, 0x00, 0x00, 0x01, 0xD1, 0x00, 0x1D,
+	0xA9, 0x50, 0x00, 0xA3, 0x84, 0x00, 0x01, 0xAE, 0xD7, 0x00, 0x0C, 0x91, 0x2D, 0x40, 0x3E, 0x00,
+	0x06, 0x90, 0x5F, 0xFF, 0xFF, 0xB0, 0x3D, 0x00, 0x00, 0x00, 0x0C, 0x81, 0x16, 0x60, 0x01, 0xAE,
+	0xE9, 0x10, 0x01, 0x00, 0x06, 0x0C, 0x00, 0x06, 0xA0, 0x00, 0xCC, 0xB4, 0x07, 0x66, 0x70, 0xCF,
+	0xFF, 0xFB, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00,
+	0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x02, 0x07, 0x0A, 0x00, 0x00,
+	0x87, 0x00, 0x01, 0xDB, 0xC2, 0x00, 0xA3, 0x84, 0x00, 0x1A, 0xED, 0x70, 0x0C, 0x91, 0x2D, 0x43,
+	0xE0, 0x00, 0x69, 0x5F, 0xFF, 0xFF, 0xB3, 0xD0, 0x00, 0x00, 0x0C, 0x81, 0x16, 0x60, 0x1A, 0xEE,
+	0x91, 0x01, 0x00, 0x07, 0x0C, 0x00, 0x01, 0x17, 0x50, 0x0C, 0xC3, 0x90, 0x07, 0x66, 0x70, 0x0C,
+	0xFF, 0xFF, 0xB0, 0xC5, 0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x0C, 0xFF, 0xFF,
+	0x80, 0xC5, 0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xC0, 0x00,
+	0x01, 0x08, 0x0B, 0x00, 0x00, 0x3D, 0xD1, 0x00, 0x00, 0x11, 0xA2, 0x00, 0x1D, 0xA5, 0x70, 0x00,
+	0xA3, 0x84, 0x00, 0x01, 0xAE, 0xD7, 0x00, 0x0C, 0x91, 0x2D, 0x40, 0x3E, 0x00, 0x06, 0x90, 0x5F,
+	0xFF, 0xFF, 0xB0, 0x3D, 0x00, 0x00, 0x00, 0x0C, 0x81, 0x16, 0x60, 0x01, 0xAE, 0xE9, 0x10, 0x01,
+	0x00, 0x06, 0x0C, 0x0C, 0x3D, 0x80, 0x00, 0xCC, 0x00, 0x07, 0x66, 0x70, 0xCF, 0xFF, 0xFB, 0xC5,
+	0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+	0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x01, 0x07, 0x0B, 0x00, 0xAC, 0x3B, 0x00, 0x1B,
+	0x5E, 0x50, 0x00, 0x1D, 0xA0, 0x00, 0x0A, 0x38, 0x40, 0x01, 0xAE, 0xD7, 0x00, 0xC9, 0x12, 0xD4,
+	0x3E, 0x00, 0x06, 0x95, 0xFF, 0xFF, 0xFB, 0x3D, 0x00, 0x00, 0x00, 0xC8, 0x11, 0x66, 0x01, 0xAE,
+	0xE9, 0x10, 0x01, 0x01, 0x06, 0x0E, 0x01, 0xCB, 0x00, 0x08, 0x57, 0x60, 0xCF, 0xFF, 0xFB, 0xC5,
+	0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+	0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x21, 0x00, 0x00, 0x97, 0x00, 0x00, 0x21, 0x00,
+	0x00, 0x02, 0x07, 0x0D, 0x00, 0x1D, 0x90, 0x00, 0x0A, 0x38, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1A,
+	0xED, 0x70, 0x0C, 0x91, 0x2D, 0x43, 0xE0, 0x00, 0x69, 0x5F, 0xFF, 0xFF, 0xB3, 0xD0, 0x00, 0x00,
+	0x0C, 0x81, 0x16, 0x60, 0x1A, 0xEE, 0x91, 0x00, 0x04, 0x20, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x04,
+	0x20, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x4E, 0xC0, 0x11, 0xB1, 0x06, 0x50, 0x0C, 0x50, 0x0C, 0x50,
+	0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x00, 0x02,
+	0x03, 0x0A, 0x5E, 0xA2, 0x1B, 0x08, 0x30, 0xD3, 0x0D, 0x30, 0xD3, 0x0D, 0x30, 0xD3, 0x0D, 0x30,
+	0xD3, 0x01, 0x03, 0x02, 0x0C, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x21, 0xC4,
+	0x21, 0x01, 0x03, 0x02, 0x0C, 0xD3, 0x00, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x20, 0xD3,
+	0x31, 0x00, 0x03, 0x09, 0x0C, 0x00, 0x5C, 0xFE, 0x91, 0x00, 0x6E, 0x51, 0x2B, 0xC0, 0x1E, 0x60,
+	0x00, 0x1E, 0x64, 0xF1, 0x00, 0x00, 0x9A, 0x5E, 0x00, 0x00, 0x08, 0xB4, 0xF1, 0x00, 0x00, 0x9A,
+	0x1E, 0x60, 0x00, 0x1E, 0x60, 0x6E, 0x51, 0x2B, 0xC0, 0x00, 0x6C, 0xFE, 0x91, 0x00, 0x00, 0x02,
+	0x10, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x05, 0x07, 0x0A, 0x02,
+	0xBE, 0xD5, 0x00, 0xD8, 0x14, 0xE3, 0x3E, 0x00, 0x09, 0x85, 0xC0, 0x00, 0x7A, 0x3E, 0x00, 0x09,
+	0x80, 0xD8, 0x14, 0xE3, 0x02, 0xBE, 0xD5, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x00,
+	0x31, 0x00, 0x00, 0x00, 0x09, 0x0C, 0x00, 0x04, 0xEC, 0x10, 0x00, 0x00, 0x11, 0xA1, 0x00, 0x00,
+	0x00, 0x65, 0x00, 0x00, 0x05, 0xCF, 0xE9, 0x10, 0x06, 0xE5, 0x12, 0xBC, 0x01, 0xE6, 0x00, 0x01,
+	0xE6, 0x4F, 0x10, 0x00, 0x09, 0xA5, 0xE0, 0x00, 0x00, 0x8B, 0x4F, 0x10, 0x00, 0x09, 0xA1, 0xE6,
+	0x00, 0x01, 0xE6, 0x06, 0xE5, 0x12, 0xBC, 0x00, 0x06, 0xCF, 0xE9, 0x10, 0x00, 0x02, 0x07, 0x0A,
+	0x00, 0x4E, 0xC1, 0x00, 0x01, 0x1A, 0x10, 0x00, 0x06, 0x50, 0x00, 0x2B, 0xED, 0x50, 0x0D, 0x81,
+	0x4E, 0x33, 0xE0, 0x00, 0x98, 0x5C, 0x00, 0x07, 0xA3, 0xE0, 0x00, 0x98, 0x0D, 0x81, 0x4E, 0x30,
+	0x2B, 0xED, 0x50, 0x00, 0x00, 0x09, 0x0C, 0x00, 0x00, 0x00, 0x2D, 0x10, 0x00, 0x2D, 0x9A, 0x40,
+	0x00, 0x0A, 0x3A, 0x30, 0x00, 0x05, 0xCF, 0xE9, 0x10, 0x06, 0xE5, 0x12, 0xBC, 0x01, 0xE6, 0x00,
+	0x01, 0xE6, 0x4F, 0x10, 0x00, 0x09, 0xA5, 0xE0, 0x00, 0x00, 0x8B, 0x4F, 0x10, 0x00, 0x09, 0xA1,
+	0xE6, 0x00, 0x01, 0xE6, 0x06, 0xE5, 0x12, 0xBC, 0x00, 0x06, 0xCF, 0xE9, 0x10, 0x00, 0x02, 0x07,
+	0x0A, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xE8, 0xB3, 0x00, 0xB2, 0xA2, 0x00, 0x2B, 0xED, 0x50, 0x0D,
+	0x81, 0x4E, 0x33, 0xE0, 0x00, 0x98, 0x5C, 0x00, 0x07, 0xA3, 0xE0, 0x00, 0x98, 0x0D, 0x81, 0x4E,
+	0x30, 0x2B, 0xED, 0x50, 0x00, 0x00, 0x09, 0x0C, 0x00, 0x00, 0x0A, 0x60, 0x00, 0x00, 0x2D, 0xAC,
+	0x10, 0x00, 0x0B, 0x2A, 0x30, 0x00, 0x05, 0xCF, 0xE9, 0x10, 0x06, 0xE5, 0x12, 0xBC, 0x01, 0xE6,
+	0x00, 0x01, 0xE6, 0x4F, 0x10, 0x00, 0x09, 0xA5, 0xE0, 0x00, 0x00, 0x8B, 0x4F, 0x10, 0x00, 0x09,
+	0xA1, 0xE6, 0x00, 0x01, 0xE6, 0x06, 0xE5, 0x12, 0xBC, 0x00, 0x06, 0xCF, 0xE9, 0x10, 0x00, 0x02,
+	0x07, 0x0A, 0x00, 0x00, 0xB5, 0x00, 0x03, 0xE9, 0xC1, 0x00, 0xB2, 0xA2, 0x00, 0x2B, 0xED, 0x50,
+	0x0D, 0x81, 0x4E, 0x33, 0xE0, 0x00, 0x98, 0x5C, 0x00, 0x07, 0xA3, 0xE0, 0x00, 0x98, 0x0D, 0x81,
+	0x4E, 0x30, 0x2B, 0xED, 0x50, 0x00, 0x00, 0x09, 0x0C, 0x00, 0x00, 0x01, 0x1A, 0x10, 0x00, 0x2D,
+	0x96, 0x50, 0x00, 0x0B, 0x2A, 0x30, 0x00, 0x05, 0xCF, 0xE9, 0x10, 0x06, 0xE5, 0x12, 0xBC, 0x01,
+	0xE6, 0x00, 0x01, 0xE6, 0x4F, 0x10, 0x00, 0x09, 0xA5, 0xE0, 0x00, 0x00, 0x8B, 0x4F, 0x10, 0x00,
+	0x09, 0xA1, 0xE6, 0x00, 0x01, 0xE6, 0x06, 0xE5, 0x12, 0xBC, 0x00, 0x06, 0xCF, 0xE9, 0x10, 0x00,
+	0x01, 0x08, 0x0B, 0x00, 0x00, 0x5E, 0xB0, 0x00, 0x00, 0x21, 0xB1, 0x00, 0x3E, 0x87, 0x40, 0x00,
+	0xB2, 0xA2, 0x00, 0x02, 0xBE, 0xD5, 0x00, 0x0D, 0x81, 0x4E, 0x30, 0x3E, 0x00, 0x09, 0x80, 0x5C,
+	0x00, 0x07, 0xA0, 0x3E, 0x00, 0x09, 0x80, 0x0D, 0x81, 0x4E, 0x30, 0x02, 0xBE, 0xD5, 0x00, 0x00,
+	0x00, 0x09, 0x0C, 0x00, 0x39, 0x6E, 0x40, 0x00, 0x00, 0x3D, 0x80, 0x00, 0x00, 0x0B, 0x2A, 0x30,
+	0x00, 0x05, 0xCF, 0xE9, 0x10, 0x06, 0xE5, 0x12, 0xBC, 0x01, 0xE6, 0x00, 0x01, 0xE6, 0x4F, 0x10,
+	0x00, 0x09, 0xA5, 0xE0, 0x00, 0x00, 0x8B, 0x4F, 0x10, 0x00, 0x09, 0xA1, 0xE6, 0x00, 0x01, 0xE6,
+	0x06, 0xE5, 0x12, 0xBC, 0x00, 0x06, 0xCF, 0xE9, 0x10, 0x00, 0x01, 0x07, 0x0B, 0x00, 0xCA, 0x48,
+	0x00, 0x39, 0x6E, 0x30, 0x00, 0x3E, 0x80, 0x00, 0x0B, 0x2A, 0x20, 0x02, 0xBE, 0xD5, 0x00, 0xD8,
+	0x14, 0xE3, 0x3E, 0x00, 0x09, 0x85, 0xC0, 0x00, 0x7A, 0x3E, 0x00, 0x09, 0x80, 0xD8, 0x14, 0xE3,
+	0x02, 0xBE, 0xD5, 0x00, 0x00, 0x01, 0x09, 0x0E, 0x00, 0x02, 0xD9, 0x00, 0x00, 0x00, 0xB2, 0xA3,
+	0x00, 0x00, 0x5C, 0xFE, 0x91, 0x00, 0x6E, 0x51, 0x2B, 0xC0, 0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1,
+	0x00, 0x00, 0x9A, 0x5E, 0x00, 0x00, 0x08, 0xB4, 0xF1, 0x00, 0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E,
+	0x60, 0x6E, 0x51, 0x2B, 0xC0, 0x00, 0x6C, 0xFE, 0x91, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00,
+	0xC4, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x02, 0x07, 0x0D, 0x00, 0x2D, 0x70, 0x00, 0x0B,
+	0x2A, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xED, 0x50, 0x0D, 0x81, 0x4E, 0x33, 0xE0, 0x00, 0x98,
+	0x5C, 0x00, 0x07, 0xA3, 0xE0, 0x00, 0x98, 0x0D, 0x81, 0x4E, 0x30, 0x2B, 0xED, 0x50, 0x00, 0x05,
+	0x10, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x01, 0x0A, 0x0B, 0x00, 0x00, 0x3C,
+	0x00, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x6D, 0xFD, 0x93, 0xA2, 0x07, 0xE5, 0x13, 0xCF,
+	0xE1, 0x1F, 0x50, 0x00, 0x1E, 0x50, 0x5F, 0x00, 0x00, 0x0A, 0x90, 0x6D, 0x00, 0x00, 0x09, 0xA0,
+	0x5F, 0x00, 0x00, 0x0A, 0x90, 0x1F, 0x50, 0x00, 0x1E, 0x50, 0x08, 0xE5, 0x13, 0xCB, 0x00, 0x00,
+	0x6D, 0xFE, 0x91, 0x00, 0x00, 0x02, 0x08, 0x0A, 0x00, 0x01, 0xC3, 0x00, 0x00, 0x0A, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0xBE, 0xD8, 0x93, 0x0C, 0x91, 0x4F, 0xF1, 0x3E, 0x00, 0x09, 0x90,
+	0x4D, 0x00, 0x07, 0xA0, 0x3E, 0x00, 0x09, 0x90, 0x0C, 0x81, 0x4E, 0x30, 0x02, 0xBE, 0xD6, 0x00,
+	0x00, 0x01, 0x0A, 0x0B, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x6D,
+	0xFD, 0x93, 0xA2, 0x07, 0xE5, 0x13, 0xCF, 0xE1, 0x1F, 0x50, 0x00, 0x1E, 0x50, 0x5F, 0x00, 0x00,
+	0x0A, 0x90, 0x6D, 0x00, 0x00, 0x09, 0xA0, 0x5F, 0x00, 0x00, 0x0A, 0x90, 0x1F, 0x50, 0x00, 0x1E,
+	0x50, 0x08, 0xE5, 0x13, 0xCB, 0x00, 0x00, 0x6D, 0xFE, 0x91, 0x00, 0x00, 0x02, 0x08, 0x0A, 0x01,
+	0xC4, 0x00, 0x00, 0x00, 0x1B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBE, 0xD8, 0x93, 0x0C,
+	0x91, 0x4F, 0xF1, 0x3E, 0x00, 0x09, 0x90, 0x4D, 0x00, 0x07, 0xA0, 0x3E, 0x00, 0x09, 0x90, 0x0C,
+	0x81, 0x4E, 0x30, 0x02, 0xBE, 0xD6, 0x00, 0x00, 0x00, 0x0A, 0x0C, 0x00, 0x04, 0xEC, 0x10, 0x00,
+	0x00, 0x01, 0x1A, 0x10, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x6D, 0xFD, 0x93, 0xA2, 0x07,
+	0xE5, 0x13, 0xCF, 0xE1, 0x1F, 0x50, 0x00, 0x1E, 0x50, 0x5F, 0x00, 0x00, 0x0A, 0x90, 0x6D, 0x00,
+	0x00, 0x09, 0xA0, 0x5F, 0x00, 0x00, 0x0A, 0x90, 0x1F, 0x50, 0x00, 0x1E, 0x50, 0x08, 0xE5, 0x13,
+	0xCB, 0x00, 0x00, 0x6D, 0xFE, 0x91, 0x00, 0x00, 0x02, 0x08, 0x0A, 0x00, 0x4E, 0xC1, 0x00, 0x00,
+	0x11, 0xA1, 0x00, 0x00, 0x06, 0x50, 0x00, 0x02, 0xBE, 0xD8, 0x93, 0x0C, 0x91, 0x4F, 0xF1, 0x3E,
+	0x00, 0x09, 0x90, 0x4D, 0x00, 0x07, 0xA0, 0x3E, 0x00, 0x09, 0x90, 0x0C, 0x81, 0x4E, 0x30, 0x02,
+	0xBE, 0xD6, 0x00, 0x00, 0x01, 0x0A, 0x0B, 0x00, 0x0C, 0xB4, 0x90, 0x00, 0x00, 0x2A, 0x6E, 0x40,
+	0x00, 0x00, 0x6D, 0xFD, 0x93, 0xA2, 0x07, 0xE5, 0x13, 0xCF, 0xE1, 0x1F, 0x50, 0x00, 0x1E, 0x50,
+	0x5F, 0x00, 0x00, 0x0A, 0x90, 0x6D, 0x00, 0x00, 0x09, 0xA0, 0x5F, 0x00, 0x00, 0x0A, 0x90, 0x1F,
+	0x50, 0x00, 0x1E, 0x50, 0x08, 0xE5, 0x13, 0xCB, 0x00, 0x00, 0x6D, 0xFE, 0x91, 0x00, 0x00, 0x03,
+	0x08, 0x09, 0x00, 0xCA, 0x48, 0x00, 0x03, 0x85, 0xE3, 0x00, 0x02, 0xBE, 0xD8, 0x93, 0x0C, 0x91,
+	0x4F, 0xF1, 0x3E, 0x00, 0x09, 0x90, 0x4D, 0x00, 0x07, 0xA0, 0x3E, 0x00, 0x09, 0x90, 0x0C, 0x81,
+	0x4E, 0x30, 0x02, 0xBE, 0xD6, 0x00, 0x00, 0x03, 0x0A, 0x0C, 0x00, 0x6D, 0xFD, 0x93, 0xA2, 0x07,
+	0xE5, 0x13, 0xCF, 0xE1, 0x1F, 0x50, 0x00, 0x1E, 0x50, 0x5F, 0x00, 0x00, 0x0A, 0x90, 0x6D, 0x00,
+	0x00, 0x09, 0xA0, 0x5F, 0x00, 0x00, 0x0A, 0x90, 0x1F, 0x50, 0x00, 0x1E, 0x50, 0x08, 0xE5, 0x13,
+	0xCB, 0x00, 0x00, 0x6D, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x00,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0x08, 0x0A, 0x02, 0xBE, 0xD8, 0x93, 0x0C, 0x91,
+	0x4F, 0xF1, 0x3E, 0x00, 0x09, 0x90, 0x4D, 0x00, 0x07, 0xA0, 0x3E, 0x00, 0x09, 0x90, 0x0C, 0x81,
+	0x4E, 0x30, 0x02, 0xBE, 0xD6, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x00, 0x03,
+	0x10, 0x00, 0x01, 0x03, 0x07, 0x0C, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07,
+	0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xC6, 0x00, 0x09, 0x97, 0xD3,
+	0x14, 0xE4, 0x07, 0xDE, 0xC5, 0x00, 0x00, 0x20, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x30, 0x00,
+	0x01, 0x05, 0x06, 0x0A, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88,
+	0xE2, 0x00, 0xA8, 0xC8, 0x14, 0xE8, 0x3C, 0xEA, 0xA8, 0x00, 0x21, 0x00, 0x00, 0xC4, 0x00, 0x00,
+	0x31, 0x00, 0x01, 0x00, 0x07, 0x0C, 0x00, 0x8E, 0x80, 0x00, 0x02, 0x2A, 0x00, 0x00, 0x0A, 0x10,
+	0x0E, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40,
+	0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBC, 0x60, 0x00, 0x99, 0x7D, 0x31, 0x4E, 0x40, 0x7D, 0xEC, 0x50,
+	0x01, 0x02, 0x06, 0x0A, 0x04, 0xEC, 0x10, 0x01, 0x1A, 0x10, 0x00, 0x65, 0x00, 0xF1, 0x00, 0x88,
+	0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xE2, 0x00, 0xA8, 0xC8, 0x14, 0xE8, 0x3C,
+	0xEA, 0xA8, 0x01, 0x01, 0x09, 0x0B, 0x00, 0x09, 0x70, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0xF3,
+	0x00, 0x07, 0xE4, 0x8F, 0x30, 0x00, 0x7F, 0xE5, 0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30, 0x00, 0x7B,
+	0x00, 0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30, 0x00, 0x8A, 0x00, 0xD5, 0x00, 0x0A, 0x80, 0x07, 0xC3,
+	0x14, 0xE3, 0x00, 0x08, 0xDE, 0xC5, 0x00, 0x00, 0x01, 0x02, 0x08, 0x0A, 0x00, 0x1C, 0x40, 0x00,
+	0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x00, 0xAA, 0xB1, 0xF2, 0x00, 0x9F, 0xD0,
+	0xF2, 0x00, 0x88, 0x00, 0xF2, 0x00, 0x88, 0x00, 0xE2, 0x00, 0x98, 0x00, 0xB8, 0x14, 0xE8, 0x00,
+	0x3C, 0xEA, 0x98, 0x00, 0x01, 0x01, 0x09, 0x0B, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x02, 0xC1, 0x00,
+	0x00, 0xF3, 0x00, 0x07, 0xE4, 0x8F, 0x30, 0x00, 0x7F, 0xE5, 0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30,
+	0x00, 0x7B, 0x00, 0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30, 0x00, 0x8A, 0x00, 0xD5, 0x00, 0x0A, 0x80,
+	0x07, 0xC3, 0x14, 0xE3, 0x00, 0x08, 0xDE, 0xC5, 0x00, 0x00, 0x01, 0x02, 0x08, 0x0A, 0x1B, 0x40,
+	0x00, 0x00, 0x01, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x00, 0xAA, 0xB1, 0xF2, 0x00,
+	0x9F, 0xD0, 0xF2, 0x00, 0x88, 0x00, 0xF2, 0x00, 0x88, 0x00, 0xE2, 0x00, 0x98, 0x00, 0xB8, 0x14,
+	0xE8, 0x00, 0x3C, 0xEA, 0x98, 0x00, 0x01, 0x00, 0x09, 0x0C, 0x00, 0x8E, 0x80, 0x00, 0x00, 0x02,
+	0x2A, 0x00, 0x00, 0x00, 0x0A, 0x10, 0x00, 0x0F, 0x30, 0x00, 0x7E, 0x48, 0xF3, 0x00, 0x07, 0xFE,
+	0x5F, 0x30, 0x00, 0x7B, 0x00, 0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30, 0x00, 0x7B, 0x00, 0xF3, 0x00,
+	0x08, 0xA0, 0x0D, 0x50, 0x00, 0xA8, 0x00, 0x7C, 0x31, 0x4E, 0x30, 0x00, 0x8D, 0xEC, 0x50, 0x00,
+	0x01, 0x02, 0x08, 0x0A, 0x04, 0xEC, 0x10, 0x00, 0x01, 0x1A, 0x10, 0x00, 0x00, 0x65, 0x00, 0x00,
+	0xF2, 0x00, 0xAA, 0xB1, 0xF2, 0x00, 0x9F, 0xD0, 0xF2, 0x00, 0x88, 0x00, 0xF2, 0x00, 0x88, 0x00,
+	0xE2, 0x00, 0x98, 0x00, 0xB8, 0x14, 0xE8, 0x00, 0x3C, 0xEA, 0x98, 0x00, 0x01, 0x01, 0x09, 0x0B,
+	0x03, 0xE7, 0x84, 0x00, 0x00, 0x75, 0xAD, 0x10, 0x00, 0xF3, 0x00, 0x07, 0xE4, 0x8F, 0x30, 0x00,
+	0x7F, 0xE5, 0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30, 0x00, 0x7B, 0x00, 0xF3, 0x00, 0x07, 0xB0, 0x0F,
+	0x30, 0x00, 0x8A, 0x00, 0xD5, 0x00, 0x0A, 0x80, 0x07, 0xC3, 0x14, 0xE3, 0x00, 0x08, 0xDE, 0xC5,
+	0x00, 0x00, 0x01, 0x03, 0x08, 0x09, 0x0B, 0xB3, 0x90, 0x00, 0x2A, 0x4E, 0x40, 0x00, 0xF2, 0x00,
+	0xAA, 0xB1, 0xF2, 0x00, 0x9F, 0xD0, 0xF2, 0x00, 0x88, 0x00, 0xF2, 0x00, 0x88, 0x00, 0xE2, 0x00,
+	0x98, 0x00, 0xB8, 0x14, 0xE8, 0x00, 0x3C, 0xEA, 0x98, 0x00, 0x01, 0x03, 0x09, 0x0C, 0xF3, 0x00,
+	0x07, 0xE4, 0x8F, 0x30, 0x00, 0x7F, 0xE5, 0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30, 0x00, 0x7B, 0x00,
+	0xF3, 0x00, 0x07, 0xB0, 0x0F, 0x30, 0x00, 0x8A, 0x00, 0xD5, 0x00, 0x0A, 0x80, 0x07, 0xC3, 0x14,
+	0xE3, 0x00, 0x08, 0xDE, 0xC5, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x01, 0x05, 0x08, 0x0A, 0xF2, 0x00, 0xAA, 0xB1, 0xF2, 0x00, 0x9F, 0xD0,
+	0xF2, 0x00, 0x88, 0x00, 0xF2, 0x00, 0x88, 0x00, 0xE2, 0x00, 0x98, 0x00, 0xB8, 0x14, 0xE8, 0x00,
+	0x3C, 0xEA, 0x98, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00,
+	0x00, 0x01, 0x08, 0x0B, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0B, 0x30, 0x00, 0xB9, 0x00, 0x04, 0xE1,
+	0x2E, 0x40, 0x1D, 0x60, 0x06, 0xD0, 0x8B, 0x00, 0x00, 0xBA, 0xE2, 0x00, 0x00, 0x2F, 0x70, 0x00,
+	0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00,
+	0x00, 0x02, 0x07, 0x0D, 0x05, 0xB0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA0,
+	0x00, 0x98, 0x1E, 0x10, 0x0E, 0x30, 0xA7, 0x05, 0xD0, 0x05, 0xC0, 0xB7, 0x00, 0x0E, 0x4F, 0x20,
+	0x00, 0x8E, 0xB0, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x3E, 0x10, 0x00, 0x09, 0x90, 0x00, 0x1F, 0xD2,
+	0x00, 0x00, 0x00, 0x03, 0x08, 0x0C, 0xB9, 0x00, 0x04, 0xE1, 0x2E, 0x40, 0x1D, 0x60, 0x06, 0xD0,
+	0x8B, 0x00, 0x00, 0xBA, 0xE2, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E,
+	0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0D,
+	0x30, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x05, 0x07, 0x0A, 0x7A, 0x00, 0x09, 0x81, 0xE1, 0x00,
+	0xE3, 0x0A, 0x70, 0x5D, 0x00, 0x5C, 0x0B, 0x70, 0x00, 0xE4, 0xF2, 0x00, 0x08, 0xEB, 0x00, 0x00,
+	0x2F, 0x60, 0x00, 0x03, 0xE2, 0x20, 0x00, 0x99, 0x5B, 0x01, 0xFD, 0x21, 0x20, 0x00, 0x00, 0x08,
+	0x0C, 0x00, 0x4E, 0xC0, 0x00, 0x00, 0x11, 0xB1, 0x00, 0x00, 0x07, 0x40, 0x00, 0xB9, 0x00, 0x04,
+	0xE1, 0x2E, 0x40, 0x1D, 0x60, 0x06, 0xD0, 0x8B, 0x00, 0x00, 0xBA, 0xE2, 0x00, 0x00, 0x2F, 0x70,
+	0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40,
+	0x00, 0x00, 0x02, 0x07, 0x0D, 0x00, 0x6E, 0xA0, 0x00, 0x02, 0x1B, 0x00, 0x00, 0x08, 0x30, 0x07,
+	0xA0, 0x00, 0x98, 0x1E, 0x10, 0x0E, 0x30, 0xA7, 0x05, 0xD0, 0x05, 0xC0, 0xB7, 0x00, 0x0E, 0x4F,
+	0x20, 0x00, 0x8E, 0xB0, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x3E, 0x10, 0x00, 0x09, 0x90, 0x00, 0x1F,
+	0xD2, 0x00, 0x00, 0x00, 0x01, 0x08, 0x0B, 0x00, 0xCA, 0x48, 0x00, 0x03, 0x96, 0xE3, 0x00, 0xB9,
+	0x00, 0x04, 0xE1, 0x2E, 0x40, 0x1D, 0x60, 0x06, 0xD0, 0x8B, 0x00, 0x00, 0xBA, 0xE2, 0x00, 0x00,
+	0x2F, 0x70, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00,
+	0x0E, 0x40, 0x00, 0x00, 0x03, 0x07, 0x0C, 0x00, 0xCA, 0x39, 0x00, 0x39, 0x5E, 0x40, 0x7A, 0x00,
+	0x09, 0x81, 0xE1, 0x00, 0xE3, 0x0A, 0x70, 0x5D, 0x00, 0x5C, 0x0B, 0x70, 0x00, 0xE4, 0xF2, 0x00,
+	0x08, 0xEB, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x03, 0xE1, 0x00, 0x00, 0x99, 0x00, 0x01, 0xFD, 0x20,
+	0x00, 0x00, 0x01, 0x0C, 0x0C, 0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF9, 0x00,
+	0x00, 0x00, 0x05, 0x94, 0x25, 0x80, 0x00, 0x00, 0x5F, 0x7C, 0xD4, 0x59, 0x00, 0x05, 0xFF, 0xFF,
+	0xF8, 0x4F, 0x90, 0x5F, 0xFF, 0xFF, 0xC1, 0xBF, 0xF9, 0x6F, 0xFF, 0xFD, 0x1B, 0xFF, 0xFA, 0x06,
+	0xFF, 0xFA, 0x4F, 0xFF, 0xA0, 0x00, 0x6F, 0xFB, 0x8F, 0xFA, 0x00, 0x00, 0x06, 0xFC, 0xAF, 0xA0,
+	0x00, 0x00, 0x00, 0x68, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00,
+};
+
+static const lcd_kern_t lcd_fontsans15_kerns[344] = {
+	{ 0x000D002A,  1 },	/* U+002D U+004A */
+	{ 0x000D0034, -1 },	/* U+002D U+0054 */
+	{ 0x000D0036, -1 },	/* U+002D U+0056 */
+	{ 0x000D0038, -1 },	/* U+002D U+0058 */
+	{ 0x000D0039, -1 },	/* U+002D U+0059 */
+	{ 0x000D006F, -1 },	/* U+002D U+00DD */
+	{ 0x00210034, -1 },	/* U+0041 U+0054 */
+	{ 0x00210036, -1 },	/* U+0041 U+0056 */
+	{ 0x00210037, -1 },	/* U+0041 U+0057 */
+	{ 0x00210039, -1 },	/* U+0041 U+0059 */
+	{ 0x00210056, -1 },	/* U+0041 U+0076 */
+	{ 0x00210059, -1 },	/* U+0041 U+0079 */
+	{ 0x0021006F, -1 },	/* U+0041 U+00DD */
+	{ 0x0021007F, -1 },	/* U+0041 U+00FD */
+	{ 0x002100DE, -1 },	/* U+0041 U+1EF2 */
+	{ 0x002100DF, -1 },	/* U+0041 U+1EF3 */
+	{ 0x00220039, -1 },	/* U+0042 U+0059 */
+	{ 0x0022006F, -1 },	/* U+0042 U+00DD */
+	{ 0x002200DE, -1 },	/* U+0042 U+1EF2 */
+	{ 0x00240039, -1 },	/* U+0044 U+0059 */
+	{ 0x0024006F, -1 },	/* U+0044 U+00DD */
+	{ 0x002400DE, -1 },	/* U+0044 U+1EF2 */
+	{ 0x0026000E, -2 },	/* U+0046 U+002E */
+	{ 0x0026001A, -1 },	/* U+0046 U+003A */
+	{ 0x00260021, -1 },	/* U+0046 U+0041 */
+	{ 0x00260041, -1 },	/* U+0046 U+0061 */
+	{ 0x00260045, -1 },	/* U+0046 U+0065 */
+	{ 0x00260049, -1 },	/* U+0046 U+0069 */
+	{ 0x00260052, -1 },	/* U+0046 U+0072 */
+	{ 0x00260055, -1 },	/* U+0046 U+0075 */
+	{ 0x00260059, -1 },	/* U+0046 U+0079 */
+	{ 0x00260060, -1 },	/* U+0046 U+00C0 */
+	{ 0x00260061, -1 },	/* U+0046 U+00C1 */
+	{ 0x00260062, -1 },	/* U+0046 U+00C2 */
+	{ 0x00260063, -1 },	/* U+0046 U+00C3 */
+	{ 0x00260070, -1 },	/* U+0046 U+00E0 */
+	{ 0x00260071, -1 },	/* U+0046 U+00E1 */
+	{ 0x00260072, -1 },	/* U+0046 U+00E2 */
+	{ 0x00260073, -1 },	/* U+0046 U+00E3 */
+	{ 0x00260074, -1 },	/* U+0046 U+00E8 */
+	{ 0x00260075, -1 },	/* U+0046 U+00E9 */
+	{ 0x00260076, -1 },	/* U+0046 U+00EA */
+	{ 0x0026007D, -1 },	/* U+0046 U+00F9 */
+	{ 0x0026007E, -1 },	/* U+0046 U+00FA */
+	{ 0x0026007F, -1 },	/* U+0046 U+00FD */
+	{ 0x00260080, -1 },	/* U+0046 U+0102 */
+	{ 0x00260081, -1 },	/* U+0046 U+0103 */
+	{ 0x00260087, -1 },	/* U+0046 U+0169 */
+	{ 0x002600DF, -1 },	/* U+0046 U+1EF3 */
+	{ 0x00270039, -1 },	/* U+0047 U+0059 */
+	{ 0x0027006F, -1 },	/* U+0047 U+00DD */
+	{ 0x002B000D, -1 },	/* U+004B U+002D */
+	{ 0x002B0023, -1 },	/* U+004B U+0043 */
+	{ 0x002B002F, -1 },	/* U+004B U+004F */
+	{ 0x002B0034, -1 },	/* U+004B U+0054 */
+	{ 0x002B0045, -1 },	/* U+004B U+0065 */
+	{ 0x002B004F, -1 },	/* U+004B U+006F */
+	{ 0x002B0055, -1 },	/* U+004B U+0075 */
+	{ 0x002B0059, -1 },	/* U+004B U+0079 */
+	{ 0x002B0069, -1 },	/* U+004B U+00D2 */
+	{ 0x002B006A, -1 },	/* U+004B U+00D3 */
+	{ 0x002B006B, -1 },	/* U+004B U+00D4 */
+	{ 0x002B006C, -1 },	/* U+004B U+00D5 */
+	{ 0x002B0074, -1 },	/* U+004B U+00E8 */
+	{ 0x002B0075, -1 },	/* U+004B U+00E9 */
+	{ 0x002B0076, -1 },	/* U+004B U+00EA */
+	{ 0x002B0079, -1 },	/* U+004B U+00F2 */
+	{ 0x002B007A, -1 },	/* U+004B U+00F3 */
+	{ 0x002B007B, -1 },	/* U+004B U+00F4 */
+	{ 0x002B007C, -1 },	/* U+004B U+00F5 */
+	{ 0x002B007D, -1 },	/* U+004B U+00F9 */
+	{ 0x002B007E, -1 },	/* U+004B U+00FA */
+	{ 0x002B007F, -1 },	/* U+004B U+00FD */
+	{ 0x002C0034, -2 },	/* U+004C U+0054 */
+	{ 0x002C0035, -1 },	/* U+004C U+0055 */
+	{ 0x002C0036, -1 },	/* U+004C U+0056 */
+	{ 0x002C0037, -1 },	/* U+004C U+0057 */
+	{ 0x002C0039, -2 },	/* U+004C U+0059 */
+	{ 0x002C0059, -1 },	/* U+004C U+0079 */
+	{ 0x002C006D, -1 },	/* U+004C U+00D9 */
+	{ 0x002C006E, -1 },	/* U+004C U+00DA */
+	{ 0x002C006F, -2 },	/* U+004C U+00DD */
+	{ 0x002C007F, -1 },	/* U+004C U+00FD */
+	{ 0x002F0038, -1 },	/* U+004F U+0058 */
+	{ 0x002F0039, -1 },	/* U+004F U+0059 */
+	{ 0x002F006F, -1 },	/* U+004F U+00DD */
+	{ 0x0030000E, -2 },	/* U+0050 U+002E */
+	{ 0x00300021, -1 },	/* U+0050 U+0041 */
+	{ 0x00300041, -1 },	/* U+0050 U+0061 */
+	{ 0x00300060, -1 },	/* U+0050 U+00C0 */
+	{ 0x00300061, -1 },	/* U+0050 U+00C1 */
+	{ 0x00300062, -1 },	/* U+0050 U+00C2 */
+	{ 0x00300063, -1 },	/* U+0050 U+00C3 */
+	{ 0x00300070, -1 },	/* U+0050 U+00E0 */
+	{ 0x00300071, -1 },	/* U+0050 U+00E1 */
+	{ 0x00300072, -1 },	/* U+0050 U+00E2 */
+	{ 0x00300073, -1 },	/* U+0050 U+00E3 */
+	{ 0x00320023, -1 },	/* U+0052 U+0043 */
+	{ 0x00320034, -1 },	/* U+0052 U+0054 */
+	{ 0x00320036, -1 },	/* U+0052 U+0056 */
+	{ 0x00320039, -1 },	/* U+0052 U+0059 */
+	{ 0x00320045, -1 },	/* U+0052 U+0065 */
+	{ 0x0032004F, -1 },	/* U+0052 U+006F */
+	{ 0x00320055, -1 },	/* U+0052 U+0075 */
+	{ 0x00320059, -1 },	/* U+0052 U+0079 */
+	{ 0x0032006F, -1 },	/* U+0052 U+00DD */
+	{ 0x00320074, -1 },	/* U+0052 U+00E8 */
+	{ 0x00320075, -1 },	/* U+0052 U+00E9 */
+	{ 0x00320076, -1 },	/* U+0052 U+00EA */
+	{ 0x00320079, -1 },	/* U+0052 U+00F2 */
+	{ 0x0032007A, -1 },	/* U+0052 U+00F3 */
+	{ 0x0032007B, -1 },	/* U+0052 U+00F4 */
+	{ 0x0032007C, -1 },	/* U+0052 U+00F5 */
+	{ 0x0032007D, -1 },	/* U+0052 U+00F9 */
+	{ 0x0032007E, -1 },	/* U+0052 U+00FA */
+	{ 0x0032007F, -1 },	/* U+0052 U+00FD */
+	{ 0x0034000D, -1 },	/* U+0054 U+002D */
+	{ 0x0034000E, -1 },	/* U+0054 U+002E */
+	{ 0x0034001A, -1 },	/* U+0054 U+003A */
+	{ 0x00340021, -1 },	/* U+0054 U+0041 */
+	{ 0x00340023, -1 },	/* U+0054 U+0043 */
+	{ 0x00340041, -2 },	/* U+0054 U+0061 */
+	{ 0x00340043, -2 },	/* U+0054 U+0063 */
+	{ 0x00340045, -2 },	/* U+0054 U+0065 */
+	{ 0x0034004F, -2 },	/* U+0054 U+006F */
+	{ 0x00340052, -2 },	/* U+0054 U+0072 */
+	{ 0x00340053, -2 },	/* U+0054 U+0073 */
+	{ 0x00340055, -2 },	/* U+0054 U+0075 */
+	{ 0x00340057, -2 },	/* U+0054 U+0077 */
+	{ 0x00340059, -2 },	/* U+0054 U+0079 */
+	{ 0x00340060, -1 },	/* U+0054 U+00C0 */
+	{ 0x00340061, -1 },	/* U+0054 U+00C1 */
+	{ 0x00340062, -1 },	/* U+0054 U+00C2 */
+	{ 0x00340063, -1 },	/* U+0054 U+00C3 */
+	{ 0x00340070, -1 },	/* U+0054 U+00E0 */
+	{ 0x00340071, -2 },	/* U+0054 U+00E1 */
+	{ 0x00340072, -1 },	/* U+0054 U+00E2 */
+	{ 0x00340073, -1 },	/* U+0054 U+00E3 */
+	{ 0x00340074, -2 },	/* U+0054 U+00E8 */
+	{ 0x00340075, -2 },	/* U+0054 U+00E9 */
+	{ 0x00340076, -2 },	/* U+0054 U+00EA */
+	{ 0x00340079, -2 },	/* U+0054 U+00F2 */
+	{ 0x0034007A, -2 },	/* U+0054 U+00F3 */
+	{ 0x0034007B, -2 },	/* U+0054 U+00F4 */
+	{ 0x0034007C, -2 },	/* U+0054 U+00F5 */
+	{ 0x0034007D, -2 },	/* U+0054 U+00F9 */
+	{ 0x0034007E, -2 },	/* U+0054 U+00FA */
+	{ 0x0034007F, -2 },	/* U+0054 U+00FD */
+	{ 0x0036000D, -1 },	/* U+0056 U+002D */
+	{ 0x0036000E, -2 },	/* U+0056 U+002E */
+	{ 0x0036001A, -1 },	/* U+0056 U+003A */
+	{ 0x00360021, -1 },	/* U+0056 U+0041 */
+	{ 0x00360041, -1 },	/* U+0056 U+0061 */
+	{ 0x00360045, -1 },	/* U+0056 U+0065 */
+	{ 0x0036004F, -1 },	/* U+0056 U+006F */
+	{ 0x00360055, -1 },	/* U+0056 U+0075 */
+	{ 0x00360060, -1 },	/* U+0056 U+00C0 */
+	{ 0x00360061, -1 },	/* U+0056 U+00C1 */
+	{ 0x00360062, -1 },	/* U+0056 U+00C2 */
+	{ 0x00360063, -1 },	/* U+0056 U+00C3 */
+	{ 0x00360070, -1 },	/* U+0056 U+00E0 */
+	{ 0x00360071, -1 },	/* U+0056 U+00E1 */
+	{ 0x00360072, -1 },	/* U+0056 U+00E2 */
+	{ 0x00360073, -1 },	/* U+0056 U+00E3 */
+	{ 0x00360074, -1 },	/* U+0056 U+00E8 */
+	{ 0x00360075, -1 },	/* U+0056 U+00E9 */
+	{ 0x00360076, -1 },	/* U+0056 U+00EA */
+	{ 0x00360079, -1 },	/* U+0056 U+00F2 */
+	{ 0x0036007A, -1 },	/* U+0056 U+00F3 */
+	{ 0x0036007B, -1 },	/* U+0056 U+00F4 */
+	{ 0x0036007C, -1 },	/* U+0056 U+00F5 */
+	{ 0x0036007D, -1 },	/* U+0056 U+00F9 */
+	{ 0x0036007E, -1 },	/* U+0056 U+00FA */
+	{ 0x0037000E, -1 },	/* U+0057 U+002E */
+	{ 0x0037001A, -1 },	/* U+0057 U+003A */
+	{ 0x00370021, -1 },	/* U+0057 U+0041 */
+	{ 0x00370041, -1 },	/* U+0057 U+0061 */
+	{ 0x00370045, -1 },	/* U+0057 U+0065 */
+	{ 0x0037004F, -1 },	/* U+0057 U+006F */
+	{ 0x00370052, -1 },	/* U+0057 U+0072 */
+	{ 0x00370060, -1 },	/* U+0057 U+00C0 */
+	{ 0x00370061, -1 },	/* U+0057 U+00C1 */
+	{ 0x00370062, -1 },	/* U+0057 U+00C2 */
+	{ 0x00370063, -1 },	/* U+0057 U+00C3 */
+	{ 0x00370070, -1 },	/* U+0057 U+00E0 */
+	{ 0x00370071, -1 },	/* U+0057 U+00E1 */
+	{ 0x00370072, -1 },	/* U+0057 U+00E2 */
+	{ 0x00370073, -1 },	/* U+0057 U+00E3 */
+	{ 0x00370074, -1 },	/* U+0057 U+00E8 */
+	{ 0x00370075, -1 },	/* U+0057 U+00E9 */
+	{ 0x00370076, -1 },	/* U+0057 U+00EA */
+	{ 0x00370079, -1 },	/* U+0057 U+00F2 */
+	{ 0x0037007A, -1 },	/* U+0057 U+00F3 */
+	{ 0x0037007B, -1 },	/* U+0057 U+00F4 */
+	{ 0x0037007C, -1 },	/* U+0057 U+00F5 */
+	{ 0x0038000D, -1 },	/* U+0058 U+002D */
+	{ 0x00380023, -1 },	/* U+0058 U+0043 */
+	{ 0x0038002F, -1 },	/* U+0058 U+004F */
+	{ 0x00380045, -1 },	/* U+0058 U+0065 */
+	{ 0x00380069, -1 },	/* U+0058 U+00D2 */
+	{ 0x0038006A, -1 },	/* U+0058 U+00D3 */
+	{ 0x0038006B, -1 },	/* U+0058 U+00D4 */
+	{ 0x0038006C, -1 },	/* U+0058 U+00D5 */
+	{ 0x00380074, -1 },	/* U+0058 U+00E8 */
+	{ 0x00380075, -1 },	/* U+0058 U+00E9 */
+	{ 0x00380076, -1 },	/* U+0058 U+00EA */
+	{ 0x0039000D, -1 },	/* U+0059 U+002D */
+	{ 0x0039000E, -2 },	/* U+0059 U+002E */
+	{ 0x0039001A, -2 },	/* U+0059 U+003A */
+	{ 0x00390021, -1 },	/* U+0059 U+0041 */
+	{ 0x00390023, -1 },	/* U+0059 U+0043 */
+	{ 0x0039002F, -1 },	/* U+0059 U+004F */
+	{ 0x00390041, -2 },	/* U+0059 U+0061 */
+	{ 0x00390045, -2 },	/* U+0059 U+0065 */
+	{ 0x0039004F, -2 },	/* U+0059 U+006F */
+	{ 0x00390055, -1 },	/* U+0059 U+0075 */
+	{ 0x00390060, -1 },	/* U+0059 U+00C0 */
+	{ 0x00390061, -1 },	/* U+0059 U+00C1 */
+	{ 0x00390062, -1 },	/* U+0059 U+00C2 */
+	{ 0x00390063, -1 },	/* U+0059 U+00C3 */
+	{ 0x00390069, -1 },	/* U+0059 U+00D2 */
+	{ 0x0039006A, -1 },	/* U+0059 U+00D3 */
+	{ 0x0039006B, -1 },	/* U+0059 U+00D4 */
+	{ 0x0039006C, -1 },	/* U+0059 U+00D5 */
+	{ 0x00390070, -2 },	/* U+0059 U+00E0 */
+	{ 0x00390071, -2 },	/* U+0059 U+00E1 */
+	{ 0x00390072, -2 },	/* U+0059 U+00E2 */
+	{ 0x00390073, -2 },	/* U+0059 U+00E3 */
+	{ 0x00390074, -2 },	/* U+0059 U+00E8 */
+	{ 0x00390075, -2 },	/* U+0059 U+00E9 */
+	{ 0x00390076, -2 },	/* U+0059 U+00EA */
+	{ 0x00390079, -2 },	/* U+0059 U+00F2 */
+	{ 0x0039007A, -2 },	/* U+0059 U+00F3 */
+	{ 0x0039007B, -2 },	/* U+0059 U+00F4 */
+	{ 0x0039007C, -2 },	/* U+0059 U+00F5 */
+	{ 0x0039007D, -1 },	/* U+0059 U+00F9 */
+	{ 0x0039007E, -1 },	/* U+0059 U+00FA */
+	{ 0x0046000D, -1 },	/* U+0066 U+002D */
+	{ 0x0046000E, -1 },	/* U+0066 U+002E */
+	{ 0x0052000D, -1 },	/* U+0072 U+002D */
+	{ 0x0052000E, -1 },	/* U+0072 U+002E */
+	{ 0x0056000E, -1 },	/* U+0076 U+002E */
+	{ 0x0056001A, -1 },	/* U+0076 U+003A */
+	{ 0x0057000E, -1 },	/* U+0077 U+002E */
+	{ 0x0057001A, -1 },	/* U+0077 U+003A */
+	{ 0x0059000E, -2 },	/* U+0079 U+002E */
+	{ 0x0059001A, -1 },	/* U+0079 U+003A */
+	{ 0x00600034, -1 },	/* U+00C0 U+0054 */
+	{ 0x00600036, -1 },	/* U+00C0 U+0056 */
+	{ 0x00600037, -1 },	/* U+00C0 U+0057 */
+	{ 0x00600039, -1 },	/* U+00C0 U+0059 */
+	{ 0x00600056, -1 },	/* U+00C0 U+0076 */
+	{ 0x00600059, -1 },	/* U+00C0 U+0079 */
+	{ 0x0060006F, -1 },	/* U+00C0 U+00DD */
+	{ 0x0060007F, -1 },	/* U+00C0 U+00FD */
+	{ 0x006000DE, -1 },	/* U+00C0 U+1EF2 */
+	{ 0x006000DF, -1 },	/* U+00C0 U+1EF3 */
+	{ 0x00610034, -1 },	/* U+00C1 U+0054 */
+	{ 0x00610036, -1 },	/* U+00C1 U+0056 */
+	{ 0x00610037, -1 },	/* U+00C1 U+0057 */
+	{ 0x00610039, -1 },	/* U+00C1 U+0059 */
+	{ 0x00610056, -1 },	/* U+00C1 U+0076 */
+	{ 0x00610059, -1 },	/* U+00C1 U+0079 */
+	{ 0x0061006F, -1 },	/* U+00C1 U+00DD */
+	{ 0x0061007F, -1 },	/* U+00C1 U+00FD */
+	{ 0x006100DE, -1 },	/* U+00C1 U+1EF2 */
+	{ 0x006100DF, -1 },	/* U+00C1 U+1EF3 */
+	{ 0x00620034, -1 },	/* U+00C2 U+0054 */
+	{ 0x00620036, -1 },	/* U+00C2 U+0056 */
+	{ 0x00620037, -1 },	/* U+00C2 U+0057 */
+	{ 0x00620039, -1 },	/* U+00C2 U+0059 */
+	{ 0x00620056, -1 },	/* U+00C2 U+0076 */
+	{ 0x00620059, -1 },	/* U+00C2 U+0079 */
+	{ 0x0062006F, -1 },	/* U+00C2 U+00DD */
+	{ 0x0062007F, -1 },	/* U+00C2 U+00FD */
+	{ 0x006200DE, -1 },	/* U+00C2 U+1EF2 */
+	{ 0x006200DF, -1 },	/* U+00C2 U+1EF3 */
+	{ 0x00630034, -1 },	/* U+00C3 U+0054 */
+	{ 0x00630036, -1 },	/* U+00C3 U+0056 */
+	{ 0x00630037, -1 },	/* U+00C3 U+0057 */
+	{ 0x00630039, -1 },	/* U+00C3 U+0059 */
+	{ 0x00630056, -1 },	/* U+00C3 U+0076 */
+	{ 0x00630059, -1 },	/* U+00C3 U+0079 */
+	{ 0x0063006F, -1 },	/* U+00C3 U+00DD */
+	{ 0x0063007F, -1 },	/* U+00C3 U+00FD */
+	{ 0x006300DE, -1 },	/* U+00C3 U+1EF2 */
+	{ 0x006300DF, -1 },	/* U+00C3 U+1EF3 */
+	{ 0x00690038, -1 },	/* U+00D2 U+0058 */
+	{ 0x00690039, -1 },	/* U+00D2 U+0059 */
+	{ 0x0069006F, -1 },	/* U+00D2 U+00DD */
+	{ 0x006A0038, -1 },	/* U+00D3 U+0058 */
+	{ 0x006A0039, -1 },	/* U+00D3 U+0059 */
+	{ 0x006A006F, -1 },	/* U+00D3 U+00DD */
+	{ 0x006B0038, -1 },	/* U+00D4 U+0058 */
+	{ 0x006B0039, -1 },	/* U+00D4 U+0059 */
+	{ 0x006B006F, -1 },	/* U+00D4 U+00DD */
+	{ 0x006C0038, -1 },	/* U+00D5 U+0058 */
+	{ 0x006C0039, -1 },	/* U+00D5 U+0059 */
+	{ 0x006C006F, -1 },	/* U+00D5 U+00DD */
+	{ 0x006F000D, -1 },	/* U+00DD U+002D */
+	{ 0x006F000E, -2 },	/* U+00DD U+002E */
+	{ 0x006F001A, -2 },	/* U+00DD U+003A */
+	{ 0x006F0021, -1 },	/* U+00DD U+0041 */
+	{ 0x006F0023, -1 },	/* U+00DD U+0043 */
+	{ 0x006F002F, -1 },	/* U+00DD U+004F */
+	{ 0x006F0041, -2 },	/* U+00DD U+0061 */
+	{ 0x006F0045, -2 },	/* U+00DD U+0065 */
+	{ 0x006F004F, -2 },	/* U+00DD U+006F */
+	{ 0x006F0055, -1 },	/* U+00DD U+0075 */
+	{ 0x006F0060, -1 },	/* U+00DD U+00C0 */
+	{ 0x006F0061, -1 },	/* U+00DD U+00C1 */
+	{ 0x006F0062, -1 },	/* U+00DD U+00C2 */
+	{ 0x006F0063, -1 },	/* U+00DD U+00C3 */
+	{ 0x006F0069, -1 },	/* U+00DD U+00D2 */
+	{ 0x006F006A, -1 },	/* U+00DD U+00D3 */
+	{ 0x006F006B, -1 },	/* U+00DD U+00D4 */
+	{ 0x006F006C, -1 },	/* U+00DD U+00D5 */
+	{ 0x006F0070, -2 },	/* U+00DD U+00E0 */
+	{ 0x006F0071, -2 },	/* U+00DD U+00E1 */
+	{ 0x006F0072, -2 },	/* U+00DD U+00E2 */
+	{ 0x006F0073, -2 },	/* U+00DD U+00E3 */
+	{ 0x006F0074, -2 },	/* U+00DD U+00E8 */
+	{ 0x006F0075, -2 },	/* U+00DD U+00E9 */
+	{ 0x006F0076, -2 },	/* U+00DD U+00EA */
+	{ 0x006F0079, -2 },	/* U+00DD U+00F2 */
+	{ 0x006F007A, -2 },	/* U+00DD U+00F3 */
+	{ 0x006F007B, -2 },	/* U+00DD U+00F4 */
+	{ 0x006F007C, -2 },	/* U+00DD U+00F5 */
+	{ 0x006F007D, -1 },	/* U+00DD U+00F9 */
+	{ 0x006F007E, -1 },	/* U+00DD U+00FA */
+	{ 0x007F000E, -2 },	/* U+00FD U+002E */
+	{ 0x007F001A, -1 },	/* U+00FD U+003A */
+	{ 0x00800034, -1 },	/* U+0102 U+0054 */
+	{ 0x00800036, -1 },	/* U+0102 U+0056 */
+	{ 0x00800037, -1 },	/* U+0102 U+0057 */
+	{ 0x00800039, -1 },	/* U+0102 U+0059 */
+	{ 0x00800056, -1 },	/* U+0102 U+0076 */
+	{ 0x00800059, -1 },	/* U+0102 U+0079 */
+	{ 0x0080006F, -1 },	/* U+0102 U+00DD */
+	{ 0x0080007F, -1 },	/* U+0102 U+00FD */
+	{ 0x008000DE, -1 },	/* U+0102 U+1EF2 */
+	{ 0x008000DF, -1 },	/* U+0102 U+1EF3 */
+	{ 0x00820039, -1 },	/* U+0110 U+0059 */
+	{ 0x0082006F, -1 },	/* U+0110 U+00DD */
+};
+
+const lcd_font_t LCD_FontSans15 = {
+	.height = 15,
+	.bpp = 4,
+	.ascii = 95,
+	.count = 231,
+	.fallback = 230,
+	.glyphs = lcd_fontsans15_glyphs,
+	.bits = lcd_fontsans15_bits,
+	.kerns = lcd_fontsans15_kerns,
+	.kern_count = 344,
+};
@@ -0,0 +1,408 @@
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lcd_pixel.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define PX_TEST_PIXELS			1024	/* Self-test buffer, in pixels */
+#define PX_TEST_SLACK			16		/* Room for the misaligned starts */
+#define PX_TEST_REPEAT			100		/* Timed calls per kernel */
+
+/* Channel layout spread over 32 bits so a multiply cannot carry between them */
+#define PX_SPREAD_MASK			0x07E0F81Fu
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static const char *TAG = "LCD_PX";
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static inline uint32_t PX_Swap32(uint32_t x);
+static inline uint32_t PX_Avg32(uint32_t a, uint32_t b);
+static inline uint16_t PX_Blend1(uint16_t fg, uint16_t bg, uint32_t a5);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	PX_Swap32
+ * @brief	Byte swap both pixels of a word
+*/
+static inline
+uint32_t PX_Swap32(uint32_t x)
+{
+	return (x << 8 & 0xFF00FF00u) | (x >> 8 & 0x00FF00FFu);
+}
+
+/**
+ * @func	PX_Avg32
+ * @brief	Per-channel average of both pixels of a word
+ * @note	The low bit of each channel is dropped before the halving, so no
+ *			bit crosses into the neighbouring channel or pixel.
+*/
+static inline
+uint32_t PX_Avg32(uint32_t a, uint32_t b)
+{
+	return (a & b) + (((a ^ b) & 0xF7DEF7DEu) >> 1);
+}
+
+/**
+ * @func	PX_Blend1
+ * @brief	Blend one pixel, a5 in 0..32
+*/
+static inline
+uint16_t PX_Blend1(uint16_t fg, uint16_t bg, uint32_t a5)
+{
+	uint32_t f = (fg | (uint32_t)fg << 16) & PX_SPREAD_MASK;
+	uint32_t b = (bg | (uint32_t)bg << 16) & PX_SPREAD_MASK;
+	uint32_t r = ((((f - b) * a5) >> 5) + b) & PX_SPREAD_MASK;
+
+	return (uint16_t)(r | r >> 16);
+}
+
+/**
+ * @func	LCD_PX_Fill
+ * @brief	Write one value into n pixels
+ * @param	dst:	destination (2-byte aligned)
+ *			value:	stored as is, pass LCD_PX_SWAP(color) for the panel
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_PX_Fill(uint16_t *dst, uint16_t value, uint32_t n)
+{
+	uint32_t w = (uint32_t)value << 16 | value;
+	uint32_t *d32;
+
+	if (n > 0 && ((uintptr_t)dst & 2)) {
+		*dst++ = value;
+		n--;
+	}
+	for (d32 = (uint32_t *)dst; n >= 2; n -= 2) {
+		*d32++ = w;
+	}
+	if (n > 0) {
+		*(uint16_t *)d32 = value;
+	}
+}
+
+/**
+ * @func	LCD_PX_Swap
+ * @brief	Copy n pixels exchanging the two bytes of each
+ * @param	dst:	destination (2-byte aligned), may equal src
+ *			src:	source, any alignment (image arrays are byte arrays)
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_PX_Swap(uint16_t *dst, const void *src, uint32_t n)
+{
+	const uint16_t *s16 = src;
+
+	if ((uintptr_t)src & 1) {
+		/* Byte arrays are little-endian pixels: low byte first */
+		for (const uint8_t *s = src; n > 0; n--, s += 2) {
+			*dst++ = (uint16_t)(s[0] << 8 | s[1]);
+		}
+		return;
+	}
+	if (n > 0 && ((uintptr_t)dst & 2)) {
+		*dst++ = LCD_PX_SWAP(*s16);
+		s16++;
+		n--;
+	}
+	if (((uintptr_t)s16 & 2) == 0) {
+		uint32_t *d32 = (uint32_t *)dst;
+		const uint32_t *s32 = (const uint32_t *)s16;
+
+		for (; n >= 2; n -= 2) {
+			*d32++ = PX_Swap32(*s32++);
+		}
+		dst = (uint16_t *)d32;
+		s16 = (const uint16_t *)s32;
+	}
+	for (; n > 0; n--) {
+		*dst++ = LCD_PX_SWAP(*s16);
+		s16++;
+	}
+}
+
+/**
+ * @func	LCD_PX_Blit
+ * @brief	Copy a w x h rectangle between buffers with their own strides
+ * @param	dst, dst_stride:	destination and its line length in pixels
+ *			src, src_stride:	source and its line length in pixels
+ *			w, h:				rectangle size
+ *			swap:				1 to byte-swap while copying
+ * @retval	None
+*/
+void LCD_PX_Blit(uint16_t *dst, uint32_t dst_stride,
+		const void *src, uint32_t src_stride,
+		uint16_t w, uint16_t h, int swap)
+{
+	const uint8_t *s = src;
+
+	for (; h > 0; h--) {
+		if (swap) {
+			LCD_PX_Swap(dst, s, w);
+		} else {
+			memcpy(dst, s, w * sizeof(uint16_t));
+		}
+		dst += dst_stride;
+		s += src_stride * sizeof(uint16_t);
+	}
+}
+
+/**
+ * @func	LCD_PX_Blend50
+ * @brief	dst = (a + b) / 2 per channel, rounding down
+ * @param	dst:	destination, may equal a or b
+ *			a, b:	native-order RGB565 pixels
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_PX_Blend50(uint16_t *dst, const uint16_t *a, const uint16_t *b, uint32_t n)
+{
+	if (n > 0 && ((uintptr_t)dst & 2)) {
+		*dst++ = PX_Avg32(*a++, *b++);
+		n--;
+	}
+	if ((((uintptr_t)a | (uintptr_t)b) & 2) == 0) {
+		uint32_t *d32 = (uint32_t *)dst;
+		const uint32_t *a32 = (const uint32_t *)a;
+		const uint32_t *b32 = (const uint32_t *)b;
+
+		for (; n >= 2; n -= 2) {
+			*d32++ = PX_Avg32(*a32++, *b32++);
+		}
+		dst = (uint16_t *)d32;
+		a = (const uint16_t *)a32;
+		b = (const uint16_t *)b32;
+	}
+	for (; n > 0; n--) {
+		*dst++ = PX_Avg32(*a++, *b++);
+	}
+}
+
+/**
+ * @func	LCD_PX_Blend
+ * @brief	dst = fg * alpha + bg * (1 - alpha) per channel
+ * @param	dst:	destination, may equal fg or bg
+ *			fg, bg:	native-order RGB565 pixels
+ *			alpha:	0 (bg) .. 255 (fg), quantized to 32 steps
+ *			n:		pixel count
+ * @retval	None
+*/
+void LCD_PX_Blend(uint16_t *dst, const uint16_t *fg, const uint16_t *bg, uint8_t alpha, uint32_t n)
+{
+	uint32_t a5 = ((uint32_t)alpha + 4) >> 3;
+
+	if (a5 == 0) {
+		memmove(dst, bg, n * sizeof(uint16_t));
+		return;
+	}
+	if (a5 == 32) {
+		memmove(dst, fg, n * sizeof(uint16_t));
+		return;
+	}
+	for (; n > 0; n--) {
+		*dst++ = PX_Blend1(*fg++, *bg++, a5);
+	}
+}
+
+#if CONFIG_LCD_PIXEL_SELFTEST
+/******************************************************************************/
+/*                         REFERENCE IMPLEMENTATIONS                          */
+/******************************************************************************/
+
+/* One pixel and one channel at a time: what the kernels must reproduce */
+static
+void PX_RefFill(uint16_t *dst, uint16_t value, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		dst[i] = value;
+	}
+}
+
+static
+void PX_RefSwap(uint16_t *dst, const void *src, uint32_t n)
+{
+	const uint8_t *s = src;
+
+	for (uint32_t i = 0; i < n; i++) {
+		dst[i] = (uint16_t)(s[2 * i] << 8 | s[2 * i + 1]);
+	}
+}
+
+static
+void PX_RefBlend50(uint16_t *dst, const uint16_t *a, const uint16_t *b, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		uint16_t r = ((a[i] >> 11) + (b[i] >> 11)) >> 1;
+		uint16_t g = (((a[i] >> 5) & 0x3F) + ((b[i] >> 5) & 0x3F)) >> 1;
+		uint16_t bl = ((a[i] & 0x1F) + (b[i] & 0x1F)) >> 1;
+		dst[i] = r << 11 | g << 5 | bl;
+	}
+}
+
+static
+void PX_RefBlend(uint16_t *dst, const uint16_t *fg, const uint16_t *bg, uint8_t alpha, uint32_t n)
+{
+	int32_t a5 = ((int32_t)alpha + 4) >> 3;
+
+	for (uint32_t i = 0; i < n; i++) {
+		int32_t fr = fg[i] >> 11, fgc = (fg[i] >> 5) & 0x3F, fb = fg[i] & 0x1F;
+		int32_t br = bg[i] >> 11, bgc = (bg[i] >> 5) & 0x3F, bb = bg[i] & 0x1F;
+		/* Floor division, as the spread-word multiply rounds */
+		int32_t r = br + (((fr - br) * a5) >> 5);
+		int32_t g = bgc + (((fgc - bgc) * a5) >> 5);
+		int32_t b = bb + (((fb - bb) * a5) >> 5);
+		dst[i] = (uint16_t)(r << 11 | g << 5 | b);
+	}
+}
+
+static
+void PX_RefBlit(uint16_t *dst, uint32_t dst_stride, const uint16_t *src, uint32_t src_stride,
+		uint16_t w, uint16_t h)
+{
+	for (uint16_t y = 0; y < h; y++) {
+		PX_RefSwap(dst + y * dst_stride, src + y * src_stride, w);
+	}
+}
+
+/* Microseconds for PX_TEST_REPEAT calls */
+#define PX_TIME(call) ({								\
+	int64_t t0 = esp_timer_get_time();					\
+	for (int rep = 0; rep < PX_TEST_REPEAT; rep++) {	\
+		call;											\
+	}													\
+	(uint32_t)(esp_timer_get_time() - t0);				\
+})
+
+/* Run kernel and reference on cleared buffers, compare everything */
+#define PX_CASE(name, kernel, reference) do {			\
+	memset(out, 0, bytes);								\
+	memset(ref, 0, bytes);								\
+	kernel;												\
+	reference;											\
+	ok &= PX_Check(name, out, ref, bytes, off, n);		\
+} while (0)
+
+/**
+ * @func	PX_Check
+ * @brief	Compare kernel and reference output, log the first mismatch
+*/
+static
+int PX_Check(const char *name, const uint16_t *out, const uint16_t *ref, size_t bytes,
+		uint32_t off, uint32_t n)
+{
+	if (memcmp(out, ref, bytes) == 0) {
+		return 1;
+	}
+	ESP_LOGE(TAG, "%s differs from the reference (offset %lu, %lu px)", name,
+			(unsigned long)off, (unsigned long)n);
+	return 0;
+}
+
+/**
+ * @func	PX_Report
+ * @brief	Log reference and kernel time of one kernel
+*/
+static
+void PX_Report(const char *name, uint32_t ref_us, uint32_t fast_us)
+{
+	if (fast_us == 0) {
+		fast_us = 1;
+	}
+	ESP_LOGI(TAG, "%-8s %u px x%u: ref %lu us, kernel %lu us (%lu.%lux)", name,
+			PX_TEST_PIXELS, PX_TEST_REPEAT, (unsigned long)ref_us, (unsigned long)fast_us,
+			(unsigned long)(ref_us / fast_us), (unsigned long)(ref_us * 10 / fast_us % 10));
+}
+
+/**
+ * @func	LCD_PX_SelfTest
+ * @brief	Compare every kernel against a per-pixel reference and time both
+ * @param	None
+ * @retval	1 if all kernels are bit-exact, 0 otherwise
+*/
+int LCD_PX_SelfTest(void)
+{
+	static const uint32_t lens[] = { 0, 1, 2, 7, 8, 15, 16, 17, 31, 100, PX_TEST_PIXELS - 8 };
+	const size_t bytes = (PX_TEST_PIXELS + PX_TEST_SLACK) * sizeof(uint16_t);
+	uint16_t *a = heap_caps_aligned_alloc(16, bytes, MALLOC_CAP_8BIT);
+	uint16_t *b = heap_caps_aligned_alloc(16, bytes, MALLOC_CAP_8BIT);
+	uint16_t *out = heap_caps_aligned_alloc(16, bytes, MALLOC_CAP_8BIT);
+	uint16_t *ref = heap_caps_aligned_alloc(16, bytes, MALLOC_CAP_8BIT);
+	uint32_t x = 0x2545F491u;
+	int ok = 1;
+
+	if (a == NULL || b == NULL || out == NULL || ref == NULL) {
+		ESP_LOGW(TAG, "self-test skipped, no memory");
+		ok = -1;
+		goto done;
+	}
+	for (size_t i = 0; i < bytes / sizeof(uint16_t); i++) {
+		x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+		a[i] = x;
+		b[i] = x >> 16;
+	}
+
+	/* Every start within 16 bytes, lengths around the word size; sources
+	 * both in step with the destination (word path) and out of step */
+	for (uint32_t off = 0; off < 8; off++) {
+		uint32_t so = (off * 3 + 1) % 8;
+
+		for (uint32_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+			uint32_t n = lens[l];
+			uint8_t alpha = off * 37 + l * 11;
+
+			PX_CASE("fill", LCD_PX_Fill(out + off, a[l], n), PX_RefFill(ref + off, a[l], n));
+			PX_CASE("swap", LCD_PX_Swap(out + off, a + off, n), PX_RefSwap(ref + off, a + off, n));
+			PX_CASE("swap", LCD_PX_Swap(out + off, a + so, n), PX_RefSwap(ref + off, a + so, n));
+			PX_CASE("swap", LCD_PX_Swap(out + off, (uint8_t *)a + 1, n),
+					PX_RefSwap(ref + off, (uint8_t *)a + 1, n));
+			PX_CASE("blit", LCD_PX_Blit(out + off, 40, a + so, 33, n % 40, n / 40, 1),
+					PX_RefBlit(ref + off, 40, a + so, 33, n % 40, n / 40));
+			PX_CASE("blend50", LCD_PX_Blend50(out + off, a + off, b + off, n),
+					PX_RefBlend50(ref + off, a + off, b + off, n));
+			PX_CASE("blend50", LCD_PX_Blend50(out + off, a + off, b + so, n),
+					PX_RefBlend50(ref + off, a + off, b + so, n));
+			PX_CASE("blend", LCD_PX_Blend(out + off, a + off, b + so, alpha, n),
+					PX_RefBlend(ref + off, a + off, b + so, alpha, n));
+		}
+	}
+
+	if (ok) {
+		/* Aligned, band-sized buffers: the case the DMA paths hit */
+		PX_Report("fill", PX_TIME(PX_RefFill(out, 0x1234, PX_TEST_PIXELS)),
+				PX_TIME(LCD_PX_Fill(out, 0x1234, PX_TEST_PIXELS)));
+		PX_Report("swap", PX_TIME(PX_RefSwap(out, a, PX_TEST_PIXELS)),
+				PX_TIME(LCD_PX_Swap(out, a, PX_TEST_PIXELS)));
+		PX_Report("blit", PX_TIME(PX_RefBlit(out, 64, a, 64, 32, PX_TEST_PIXELS / 64)),
+				PX_TIME(LCD_PX_Blit(out, 64, a, 64, 32, PX_TEST_PIXELS / 64, 1)));
+		PX_Report("blend50", PX_TIME(PX_RefBlend50(out, a, b, PX_TEST_PIXELS)),
+				PX_TIME(LCD_PX_Blend50(out, a, b, PX_TEST_PIXELS)));
+		PX_Report("blend", PX_TIME(PX_RefBlend(out, a, b, 100, PX_TEST_PIXELS)),
+				PX_TIME(LCD_PX_Blend(out, a, b, 100, PX_TEST_PIXELS)));
+	}
+
+done:
+	heap_caps_free(a);
+	heap_caps_free(b);
+	heap_caps_free(out);
+	heap_caps_free(ref);
+	return ok != 0;
+}
+#else
+int LCD_PX_SelfTest(void)
+{
+	return 1;
+}
+#endif
+
+
+/* END FILE */
@@ -0,0 +1,289 @@
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "lcd.h"
+#include "lcd_pixel.h"
+#include "lcd_shadow.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define LCD_SHADOW_PIXELS		(LCD_W * LCD_H)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+#if CONFIG_LCD_SHADOW
+static const char *TAG = "LCD_SHADOW";
+#endif
+
+/* Rows of lcddev.width pixels, native order; NULL when disabled */
+static uint16_t *shadow;
+
+/* Window and cursor, as held by the controller */
+static uint16_t win_x0, win_y0, win_x1, win_y1;
+static uint16_t cur_x, cur_y;
+
+static uint16_t scroll_first, scroll_lines, scroll_offset;
+
+/* Written span of each row, [x0, x1); clean when x0 >= x1 */
+static uint16_t dirty_x0[LCD_SHADOW_MAX_ROWS], dirty_x1[LCD_SHADOW_MAX_ROWS];
+static portMUX_TYPE dirty_lock = portMUX_INITIALIZER_UNLOCKED;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void LCD_SHADOW_Mark(uint16_t y, uint16_t x0, uint16_t x1);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	LCD_SHADOW_Init
+ * @brief	Reserve the copy (called once by LCD_Init)
+ * @param	None
+ * @retval	None
+*/
+void LCD_SHADOW_Init(void)
+{
+#if CONFIG_LCD_SHADOW
+	const uint32_t bytes = LCD_SHADOW_PIXELS * sizeof(uint16_t);
+
+	if (shadow != NULL) {
+		return;
+	}
+	shadow = heap_caps_calloc(1, bytes, MALLOC_CAP_SPIRAM);
+	if (shadow == NULL) {
+		shadow = heap_caps_calloc(1, bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	}
+	if (shadow == NULL) {
+		ESP_LOGW(TAG, "no memory for a %lu-byte copy, screenshots disabled", (unsigned long)bytes);
+		return;
+	}
+	ESP_LOGI(TAG, "%ux%u copy of the screen (%lu bytes)", LCD_W, LCD_H, (unsigned long)bytes);
+#endif
+}
+
+/**
+ * @func	LCD_SHADOW_Mark
+ * @brief	Add a span to the damage of a row
+ * @param	y:		row as drawn
+ *			x0, x1:	span [x0, x1)
+ * @retval	None
+ * @note	Called after the pixels are copied, so a reader that took the
+ *			damage first sees the row again on its next look.
+*/
+static
+void LCD_SHADOW_Mark(uint16_t y, uint16_t x0, uint16_t x1)
+{
+	portENTER_CRITICAL(&dirty_lock);
+	if (dirty_x0[y] >= dirty_x1[y]) {
+		dirty_x0[y] = x0;
+		dirty_x1[y] = x1;
+	} else {
+		if (x0 < dirty_x0[y]) {
+			dirty_x0[y] = x0;
+		}
+		if (x1 > dirty_x1[y]) {
+			dirty_x1[y] = x1;
+		}
+	}
+	portEXIT_CRITICAL(&dirty_lock);
+}
+
+/**
+ * @func	LCD_SHADOW_Window
+ * @brief	Follow a new GRAM window
+ * @param	x0, y0, x1, y1:	inclusive window, logical coordinates
+ * @retval	None
+*/
+void LCD_SHADOW_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	win_x0 = cur_x = x0;
+	win_y0 = cur_y = y0;
+	win_x1 = x1;
+	win_y1 = y1;
+}
+
+/**
+ * @func	LCD_SHADOW_Write
+ * @brief	Store pixels written at the window cursor
+ * @param	px:	pixels in panel byte order
+ *			n:	count
+ * @retval	None
+ * @note	One swap-copy per window row; parts of the window outside the
+ *			screen are skipped but still move the cursor.
+*/
+void LCD_SHADOW_Write(const uint16_t *px, uint32_t n)
+{
+	uint32_t run;
+
+	if (shadow == NULL) {
+		return;
+	}
+	while (n > 0) {
+		run = win_x1 - cur_x + 1;
+		if (run > n) {
+			run = n;
+		}
+		if (cur_y < lcddev.height && cur_x < lcddev.width) {
+			uint32_t part = cur_x + run > lcddev.width ? lcddev.width - cur_x : run;
+
+			LCD_PX_Swap(shadow + (uint32_t)cur_y * lcddev.width + cur_x, px, part);
+			LCD_SHADOW_Mark(cur_y, cur_x, cur_x + part);
+		}
+		px += run;
+		n -= run;
+		cur_x += run;
+		if (cur_x > win_x1) {
+			cur_x = win_x0;
+			cur_y = cur_y < win_y1 ? cur_y + 1 : win_y0;
+		}
+	}
+}
+
+/**
+ * @func	LCD_SHADOW_Scroll
+ * @brief	Follow the hardware scroll
+ * @param	first:	first logical pixel of the scroll area
+ *			lines:	size of the scroll area
+ *			offset:	content drawn at first + offset is shown at first
+ * @retval	None
+*/
+void LCD_SHADOW_Scroll(uint16_t first, uint16_t lines, uint16_t offset)
+{
+	offset = lines ? offset % lines : 0;
+	if (first == scroll_first && lines == scroll_lines && offset == scroll_offset) {
+		return;
+	}
+	scroll_first = first;
+	scroll_lines = lines;
+	scroll_offset = offset;
+
+	// Everything moved on screen
+	portENTER_CRITICAL(&dirty_lock);
+	for (uint16_t y = 0; y < LCD_SHADOW_MAX_ROWS; y++) {
+		dirty_x0[y] = 0;
+		dirty_x1[y] = LCD_SHADOW_ROW_PIXELS;
+	}
+	portEXIT_CRITICAL(&dirty_lock);
+}
+
+/**
+ * @func	LCD_SHADOW_Size
+ * @brief	Size of the screen as read by LCD_SHADOW_Row
+ * @param	width, height:	receive the size
+ * @retval	0, or -1 without a shadow
+*/
+int LCD_SHADOW_Size(uint16_t *width, uint16_t *height)
+{
+	*width = lcddev.width;
+	*height = lcddev.height;
+	return shadow != NULL ? 0 : -1;
+}
+
+/**
+ * @func	LCD_SHADOW_Row
+ * @brief	Read one row of the screen as shown
+ * @param	y:		row
+ *			dst:	receives lcddev.width native pixels
+ * @retval	0, or -1
+*/
+int LCD_SHADOW_Row(uint16_t y, uint16_t *dst)
+{
+	const uint16_t width = lcddev.width;
+	const uint16_t axis = lcddev.scroll_axis ? width : lcddev.height;
+	const uint16_t first = scroll_first, lines = scroll_lines, offset = scroll_offset;
+	const uint16_t *row;
+
+	if (shadow == NULL || y >= lcddev.height) {
+		return -1;
+	}
+	// No scroll in effect, or an area that does not fit this rotation
+	if (offset == 0 || first + lines > axis) {
+		memcpy(dst, shadow + (uint32_t)y * width, width * sizeof(uint16_t));
+		return 0;
+	}
+
+	if (!lcddev.scroll_axis) {
+		if (y >= first && y < first + lines) {
+			y = first + (y - first + offset) % lines;
+		}
+		memcpy(dst, shadow + (uint32_t)y * width, width * sizeof(uint16_t));
+		return 0;
+	}
+
+	// Scroll along x: the area is rotated left by offset within the row
+	row = shadow + (uint32_t)y * width;
+	memcpy(dst, row, width * sizeof(uint16_t));
+	memcpy(dst + first, row + first + offset, (lines - offset) * sizeof(uint16_t));
+	memcpy(dst + first + lines - offset, row + first, offset * sizeof(uint16_t));
+	return 0;
+}
+
+/**
+ * @func	LCD_SHADOW_Damage
+ * @brief	Take the areas written since the last call
+ * @param	rects:	receives the areas
+ *			max:	size of rects
+ * @retval	Number of areas
+*/
+int LCD_SHADOW_Damage(lcd_shadow_rect_t *rects, int max)
+{
+	const uint16_t width = lcddev.width, height = lcddev.height;
+	const uint16_t first = scroll_first, lines = scroll_lines, offset = scroll_offset;
+	uint16_t x0[LCD_SHADOW_MAX_ROWS], x1[LCD_SHADOW_MAX_ROWS];
+	lcd_shadow_rect_t *r = NULL;
+	uint16_t a, b, d;
+	int n = 0;
+
+	if (shadow == NULL) {
+		return 0;
+	}
+	portENTER_CRITICAL(&dirty_lock);
+	memcpy(x0, dirty_x0, sizeof(x0));
+	memcpy(x1, dirty_x1, sizeof(x1));
+	memset(dirty_x0, 0, sizeof(dirty_x0));
+	memset(dirty_x1, 0, sizeof(dirty_x1));
+	portEXIT_CRITICAL(&dirty_lock);
+
+	for (uint16_t y = 0; y < height; y++) {
+		// Row as drawn behind row y as shown (see LCD_SHADOW_Row)
+		d = y;
+		if (offset != 0 && !lcddev.scroll_axis && first + lines <= height &&
+				y >= first && y < first + lines) {
+			d = first + (y - first + offset) % lines;
+		}
+		a = x0[d];
+		b = x1[d] < width ? x1[d] : width;
+		if (a >= b) {
+			// A clean row ends the area, unless no room is left for another
+			if (n < max) {
+				r = NULL;
+			}
+			continue;
+		}
+		// Along x the scroll can split a span in two: send the row whole
+		if (offset != 0 && lcddev.scroll_axis) {
+			a = 0;
+			b = width;
+		}
+		if (r == NULL) {
+			r = &rects[n++];
+			*r = (lcd_shadow_rect_t){ a, y, b - a, 1 };
+			continue;
+		}
+		if (a < r->x) {
+			r->w += r->x - a;
+			r->x = a;
+		}
+		if (b > r->x + r->w) {
+			r->w = b - r->x;
+		}
+		r->h = y - r->y + 1;
+	}
+	return n;
+}
+
+/* END FILE */
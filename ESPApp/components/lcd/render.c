@@ -0,0 +1,130 @@
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "render.h"
+#include "metrics.h"
+#include "trace.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define RENDER_TASK_STACK		4096
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static TaskHandle_t render_task_handle = NULL;
+static render_fn_t render_fn = NULL;
+static volatile TickType_t frame_ticks = 1;
+
+static metric_t render_frame_metric = METRIC_LATENCY_INIT("smartlight_render_frame_seconds", NULL,
+		"Time spent drawing one frame (SPI included)");
+static metric_t render_request_metric = METRIC_COUNTER_INIT("smartlight_render_requests_total", NULL,
+		"Redraw requests, including coalesced ones");
+static metric_t render_frames_metric = METRIC_COUNTER_INIT("smartlight_render_frames_total", NULL,
+		"Frames drawn");
+static metric_t render_pixels_metric = METRIC_COUNTER_INIT("smartlight_render_damage_pixels_total", NULL,
+		"Pixels inside the area each frame sent to the panel");
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void RENDER_Task(void *arg);
+static void RENDER_SetFps(uint8_t fps);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	RENDER_Task
+ * @brief	Wait for a request, respect the frame interval, draw one frame
+ * @param	arg: unused
+ * @retval	None
+*/
+static
+void RENDER_Task(void *arg)
+{
+	TickType_t last = xTaskGetTickCount() - frame_ticks;
+	TickType_t elapsed;
+	int64_t start;
+	uint32_t took;
+	uint32_t pixels;
+
+	while (1) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		elapsed = xTaskGetTickCount() - last;
+		if (elapsed < frame_ticks) {
+			vTaskDelay(frame_ticks - elapsed);
+		}
+		/* Requests that arrived while waiting are served by this frame */
+		ulTaskNotifyTake(pdTRUE, 0);
+
+		last = xTaskGetTickCount();
+		start = esp_timer_get_time();
+		trace_record(TRACE_LCD_BEGIN, 0);
+		pixels = render_fn();
+		trace_record(TRACE_LCD_END, pixels > UINT16_MAX ? UINT16_MAX : pixels);
+		took = (uint32_t)(esp_timer_get_time() - start);
+
+		metric_observe(&render_frame_metric, took);
+		metric_inc(&render_frames_metric);
+		metric_add(&render_pixels_metric, pixels);
+	}
+}
+
+/**
+ * @func	RENDER_Init
+ * @brief	Start the render task
+ * @param	fn:		frame function, the only code allowed to draw afterwards
+ *			fps:	maximum frame rate (0 uses CONFIG_LCD_RENDER_FPS)
+ * @retval	None
+*/
+void RENDER_Init(render_fn_t fn, uint8_t fps)
+{
+	render_fn = fn;
+	RENDER_SetFps(fps ? fps : CONFIG_LCD_RENDER_FPS);
+	metrics_register(&render_frame_metric);
+	metrics_register(&render_request_metric);
+	metrics_register(&render_frames_metric);
+	metrics_register(&render_pixels_metric);
+	xTaskCreate(RENDER_Task, "render_task", RENDER_TASK_STACK, NULL,
+			CONFIG_LCD_RENDER_TASK_PRIORITY, &render_task_handle);
+}
+
+/**
+ * @func	RENDER_SetFps
+ * @brief	Set the maximum frame rate
+ * @param	fps: frames per second (>= 1)
+ * @retval	None
+*/
+static
+void RENDER_SetFps(uint8_t fps)
+{
+	TickType_t ticks;
+
+	if (fps == 0) {
+		fps = 1;
+	}
+	ticks = pdMS_TO_TICKS(1000 / fps);
+	frame_ticks = ticks ? ticks : 1;
+}
+
+/**
+ * @func	RENDER_Request
+ * @brief	Mark the UI dirty; safe to call from any task at any rate
+ * @param	None
+ * @retval	None
+*/
+void RENDER_Request(void)
+{
+	metric_inc(&render_request_metric);
+	trace_record(TRACE_RENDER_REQUEST, 0);
+	if (render_task_handle != NULL) {
+		xTaskNotifyGive(render_task_handle);
+	}
+}
+
+
+/* END FILE */
@@ -0,0 +1,230 @@
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lcd.h"
+#include "lcd_dma.h"
+#include "lcd_pixel.h"
+#include "sprite.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define SPRITE_BENCH_REPEAT		200
+
+/*! @brief Where composited pixels go: the panel stream, or memory */
+typedef struct
+{
+	lcd_dma_stream_t *s;	/* Panel (byte-swapped by the stream), or NULL */
+	uint16_t *dst;			/* Memory, native order, when s is NULL */
+} sprite_sink_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static const char *TAG = "SPRITE";
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void SPRITE_Lut(uint16_t background, uint16_t *lut);
+static void SPRITE_Walk(const sprite_t *sp, uint16_t background, int full, sprite_sink_t *k);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	SPRITE_Lut
+ * @brief	Background share for every alpha: background * (32 - a) / 32
+ * @param	background:	RGB565 color
+ *			lut:		33 entries
+ * @retval	None
+ * @note	The converter pre-multiplies with the same floor, so pixel + lut
+ *			never carries from one channel into the next.
+*/
+static
+void SPRITE_Lut(uint16_t background, uint16_t *lut)
+{
+	uint32_t r = background >> 11, g = (background >> 5) & 0x3F, b = background & 0x1F;
+
+	for (uint32_t a = 0; a <= 32; a++) {
+		uint32_t k = 32 - a;
+		lut[a] = (uint16_t)(((r * k) >> 5) << 11 | ((g * k) >> 5) << 5 | ((b * k) >> 5));
+	}
+}
+
+/**
+ * @func	SPRITE_Fill / SPRITE_Copy / SPRITE_Put
+ * @brief	Emit background, an opaque run or one blended pixel to the sink
+*/
+static inline
+void SPRITE_Fill(sprite_sink_t *k, uint16_t color, uint32_t n)
+{
+	if (k->s != NULL) {
+		LCD_DMA_PushFill(k->s, color, n);
+	} else {
+		LCD_PX_Fill(k->dst, color, n);
+		k->dst += n;
+	}
+}
+
+static inline
+void SPRITE_Copy(sprite_sink_t *k, const uint16_t *px, uint32_t n)
+{
+	if (k->s != NULL) {
+		LCD_DMA_PushPixels(k->s, px, n);
+	} else {
+		memcpy(k->dst, px, n * sizeof(uint16_t));
+		k->dst += n;
+	}
+}
+
+static inline
+void SPRITE_Put(sprite_sink_t *k, uint16_t color)
+{
+	if (k->s != NULL) {
+		LCD_DMA_Push(k->s, color);
+	} else {
+		*k->dst++ = color;
+	}
+}
+
+/**
+ * @func	SPRITE_Walk
+ * @brief	Emit the sprite row by row, run by run
+ * @param	sp:			the sprite
+ *			background:	color under the sprite
+ *			full:		1 for the design box, 0 for the visible box
+ *			k:			sink
+ * @retval	None
+*/
+static
+void SPRITE_Walk(const sprite_t *sp, uint16_t background, int full, sprite_sink_t *k)
+{
+	const uint8_t *run = sp->runs;
+	const uint16_t *px = sp->pixels;
+	const uint8_t *alpha = sp->alpha;
+	uint32_t width = full ? sp->width : sp->w;
+	uint32_t left = full ? sp->x : 0;
+	uint16_t lut[33];
+	uint32_t used, n;
+
+	SPRITE_Lut(background, lut);
+
+	/* Rows above and below the visible box are one fill each */
+	if (full) {
+		SPRITE_Fill(k, background, sp->y * width);
+	}
+	for (uint16_t row = 0; row < sp->h; row++) {
+		SPRITE_Fill(k, background, left);
+		for (used = 0; SPRITE_RUN_TYPE(*run) != SPRITE_RUN_END; run++) {
+			n = SPRITE_RUN_LEN(*run);
+			switch (SPRITE_RUN_TYPE(*run)) {
+				case SPRITE_RUN_CLEAR:
+					SPRITE_Fill(k, background, n);
+					break;
+				case SPRITE_RUN_OPAQUE:
+					SPRITE_Copy(k, px, n);
+					px += n;
+					break;
+				default:
+					for (uint32_t i = 0; i < n; i++) {
+						SPRITE_Put(k, px[i] + lut[SPRITE_ALPHA5(alpha[i])]);
+					}
+					px += n;
+					alpha += n;
+					break;
+			}
+			used += n;
+		}
+		run++;
+		SPRITE_Fill(k, background, width - left - used);
+	}
+	if (full) {
+		SPRITE_Fill(k, background, (sp->height - sp->y - sp->h) * width);
+	}
+}
+
+/**
+ * @func	SPRITE_Draw
+ * @brief	Composite a sprite onto a background color and send it
+ * @param	sp:			the sprite
+ *			x, y:		top-left corner of its design box
+ *			background:	color under the sprite
+ *			full:		1 repaints the whole design box, 0 only the visible box
+ * @retval	None
+*/
+void SPRITE_Draw(const sprite_t *sp, uint16_t x, uint16_t y, uint16_t background, int full)
+{
+	lcd_dma_stream_t s;
+	sprite_sink_t k = { .s = &s };
+	uint16_t x1, y1;
+
+	if (!full) {
+		if (sp->w == 0 || sp->h == 0) {
+			return;
+		}
+		x += sp->x;
+		y += sp->y;
+	}
+	x1 = x + (full ? sp->width : sp->w) - 1;
+	y1 = y + (full ? sp->height : sp->h) - 1;
+
+	// Sprites are drawn whole or not at all
+	if (x1 >= lcddev.width || y1 >= lcddev.height) {
+		return;
+	}
+	LCD_DMA_Begin(&s, x, y, x1, y1);
+	SPRITE_Walk(sp, background, full, &k);
+	LCD_DMA_End(&s);
+}
+
+/**
+ * @func	SPRITE_Compose
+ * @brief	Composite a sprite into memory
+ * @param	sp:			the sprite
+ *			background:	color under the sprite
+ *			dst:		width * height native-order pixels
+ * @retval	None
+*/
+void SPRITE_Compose(const sprite_t *sp, uint16_t background, uint16_t *dst)
+{
+	sprite_sink_t k = { .dst = dst };
+
+	SPRITE_Walk(sp, background, 1, &k);
+}
+
+/**
+ * @func	SPRITE_Bench
+ * @brief	Log the cost of compositing a sprite
+ * @param	name:		label for the log line
+ *			sp:			the sprite
+ *			background:	color under the sprite
+ * @retval	Nanoseconds per composite
+*/
+uint32_t SPRITE_Bench(const char *name, const sprite_t *sp, uint16_t background)
+{
+	uint32_t pixels = (uint32_t)sp->width * sp->height;
+	uint32_t visible = sp->opaque + sp->blended;
+	uint16_t *buf = heap_caps_malloc(pixels * sizeof(uint16_t), MALLOC_CAP_8BIT);
+	int64_t t0;
+	uint32_t ns;
+
+	if (buf == NULL) {
+		return 0;
+	}
+	t0 = esp_timer_get_time();
+	for (int i = 0; i < SPRITE_BENCH_REPEAT; i++) {
+		SPRITE_Compose(sp, background, buf);
+	}
+	ns = (uint32_t)((esp_timer_get_time() - t0) * 1000 / SPRITE_BENCH_REPEAT);
+	heap_caps_free(buf);
+
+	ESP_LOGI(TAG, "%s %ux%u: %lu visible (%u opaque, %u blended), %lu ns/blit, %lu ns/visible px",
+			name, sp->width, sp->height, (unsigned long)visible, sp->opaque, sp->blended,
+			(unsigned long)ns, (unsigned long)(visible ? ns / visible : 0));
+	return ns;
+}
+
+
+/* END FILE */
@@ -0,0 +1,463 @@
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "lcd.h"
+#include "GUI.h"
+#include "lcd_font.h"
+#include "widget.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define WIDGET_ICON_SIZE		40
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static widget_t *_widget_new(widget_screen_t *screen, widget_type_t type);
+static uint32_t _widget_value(const widget_t *w);
+static void _widget_draw(widget_t *w, uint32_t value, widget_rect_t *damage);
+static void _widget_draw_text(widget_t *w, uint16_t color, const char *text, widget_rect_t *damage);
+static void _damage_add(widget_rect_t *d, const widget_rect_t *r);
+static uint32_t _hash_text(const char *text);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func	_widget_new
+ * @brief	Take the next free slot of a screen
+ * @param	screen:	the screen
+ *			type:	the widget kind
+ * @retval	Zeroed widget, NULL if the screen is full
+*/
+static
+widget_t *_widget_new(widget_screen_t *screen, widget_type_t type)
+{
+	widget_t *w;
+
+	if (screen->count >= screen->capacity) {
+		return NULL;
+	}
+	w = &screen->widgets[screen->count++];
+	memset(w, 0, sizeof(*w));
+	w->type = type;
+	return w;
+}
+
+/**
+ * @func	_hash_text
+ * @brief	FNV-1a hash of a string, used as the "value" of a label
+ * @param	text: the string (NULL hashes like "")
+ * @retval	32-bit hash
+*/
+static
+uint32_t _hash_text(const char *text)
+{
+	uint32_t h = 2166136261u;
+
+	while (text != NULL && *text != '\0') {
+		h ^= (uint8_t)*text++;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+/**
+ * @func	_widget_value
+ * @brief	Read the current value of a widget's bound data
+ * @param	w: the widget
+ * @retval	A value that changes whenever the widget must be redrawn
+*/
+static
+uint32_t _widget_value(const widget_t *w)
+{
+	int32_t v;
+
+	switch (w->type) {
+		case WIDGET_LABEL:
+			return _hash_text(*w->bind.text);
+		case WIDGET_TOGGLE:
+		case WIDGET_SPRITE:
+			return *w->bind.state ? 1 : 0;
+		case WIDGET_ICON:
+			return (uint32_t)(uintptr_t)*w->bind.image;
+		case WIDGET_PROGRESS:
+			/* Quantise to pixels so sub-pixel changes cost nothing */
+			v = *w->bind.state;
+			if (v < 0) v = 0;
+			if (v > w->max) v = w->max;
+			return w->max > 0 ? (uint32_t)(v * (w->rect.w - 2) / w->max) : 0;
+		case WIDGET_BOX:
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @func	_widget_draw_text
+ * @brief	Replace the text of a label or toggle, sending only what changed
+ * @param	w:		the widget
+ *			color:	ink color
+ *			text:	new text (NULL for none)
+ *			damage:	receives the area sent
+ * @retval	None
+ * @note	Columns past both the old and the new text already hold the
+ *			background, so only the wider of the two extents is sent; the
+ *			first draw sends the whole box.
+*/
+static
+void _widget_draw_text(widget_t *w, uint16_t color, const char *text, widget_rect_t *damage)
+{
+	const widget_rect_t *r = &w->rect;
+	uint16_t tw = 0, dw;
+
+	if (text != NULL) {
+		tw = LCD_FONT_Width((const uint8_t *)text, w->size);
+	}
+	if (tw > r->w) {
+		tw = r->w;
+	}
+	dw = !w->valid ? r->w : (tw > w->drawn.w ? tw : w->drawn.w);
+	if (dw > 0) {
+		LCD_FONT_DrawLine(r->x, r->y, dw, r->h, color, w->background,
+				(const uint8_t *)text, w->size);
+	}
+	*damage = (widget_rect_t){ r->x, r->y, dw, r->h };
+	w->drawn = (widget_rect_t){ r->x, r->y, tw, r->h };
+}
+
+/**
+ * @func	_widget_draw
+ * @brief	Put a widget on the panel for the given value
+ * @param	w:		the widget
+ *			value:	value returned by _widget_value
+ *			damage:	receives the area sent (w == 0 when nothing was)
+ * @retval	None
+*/
+static
+void _widget_draw(widget_t *w, uint32_t value, widget_rect_t *damage)
+{
+	const widget_rect_t *r = &w->rect;
+	uint16_t inner = r->w - 2;
+	uint16_t fillx;
+
+	*damage = *r;
+	switch (w->type) {
+		case WIDGET_BOX:
+			LCD_DrawFillBox(r->x, r->y, r->w, r->h, w->color, w->fill);
+			break;
+
+		// Text and the background around it go out as one transaction
+		case WIDGET_LABEL:
+			_widget_draw_text(w, w->color, *w->bind.text, damage);
+			break;
+
+		case WIDGET_TOGGLE:
+			_widget_draw_text(w, value ? w->color : w->alt_color,
+					value ? w->on_text : w->off_text, damage);
+			break;
+
+		case WIDGET_ICON:
+			if (*w->bind.image != NULL) {
+				LCD_DrawBMP16(r->x, r->y, *w->bind.image);
+			} else {
+				damage->w = 0;
+			}
+			break;
+
+		case WIDGET_PROGRESS:
+			fillx = (uint16_t)value;
+			if (!w->valid) {
+				/* First draw: frame, filled part and empty part */
+				LCD_DrawFillBox(r->x, r->y, r->w, r->h, w->color, 0);
+				if (fillx > 0) {
+					LCD_DrawFillBox(r->x + 1, r->y + 1, fillx, r->h - 2, w->color, 1);
+				}
+				if (fillx < inner) {
+					LCD_DrawFillBox(r->x + 1 + fillx, r->y + 1, inner - fillx, r->h - 2, w->background, 1);
+				}
+			} else if (fillx > w->last) {
+				/* Grow: paint only the newly covered columns */
+				*damage = (widget_rect_t){ r->x + 1 + w->last, r->y + 1, fillx - w->last, r->h - 2 };
+				LCD_DrawFillBox(damage->x, damage->y, damage->w, damage->h, w->color, 1);
+			} else {
+				/* Shrink: clear only the uncovered columns */
+				*damage = (widget_rect_t){ r->x + 1 + fillx, r->y + 1, w->last - fillx, r->h - 2 };
+				LCD_DrawFillBox(damage->x, damage->y, damage->w, damage->h, w->background, 1);
+			}
+			break;
+
+		case WIDGET_SPRITE:
+			/* The whole design box, so the other state leaves nothing behind */
+			SPRITE_Draw(w->sprites[value], r->x, r->y, w->background, 1);
+			break;
+
+		default:
+			damage->w = 0;
+			break;
+	}
+}
+
+/**
+ * @func	_damage_add
+ * @brief	Grow a damage rectangle to include r
+ * @param	d:	the damage so far (w == 0 when empty)
+ *			r:	an area just sent
+ * @retval	None
+*/
+static
+void _damage_add(widget_rect_t *d, const widget_rect_t *r)
+{
+	uint16_t x1, y1;
+
+	if (r->w == 0 || r->h == 0) {
+		return;
+	}
+	if (d->w == 0 || d->h == 0) {
+		*d = *r;
+		return;
+	}
+	x1 = (d->x + d->w > r->x + r->w) ? d->x + d->w : r->x + r->w;
+	y1 = (d->y + d->h > r->y + r->h) ? d->y + d->h : r->y + r->h;
+	if (r->x < d->x) d->x = r->x;
+	if (r->y < d->y) d->y = r->y;
+	d->w = x1 - d->x;
+	d->h = y1 - d->y;
+}
+
+/**
+ * @func	WIDGET_ScreenInit
+ * @brief	Attach widget storage to a screen and empty it
+ * @param	screen:		the screen
+ *			storage:	array of at least capacity widgets
+ *			capacity:	number of widgets storage can hold
+ * @retval	None
+*/
+void WIDGET_ScreenInit(widget_screen_t *screen, widget_t *storage, uint16_t capacity)
+{
+	memset(screen, 0, sizeof(*screen));
+	screen->widgets = storage;
+	screen->capacity = capacity;
+}
+
+/**
+ * @func	WIDGET_AddBox
+ * @brief	Add a static box (drawn once, then only on invalidate)
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddBox(
+		widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+		uint16_t color, int fill
+) {
+	widget_t *wd = _widget_new(screen, WIDGET_BOX);
+
+	if (wd != NULL) {
+		wd->rect = (widget_rect_t){ x, y, w, h };
+		wd->color = color;
+		wd->fill = fill ? 1 : 0;
+	}
+	return wd;
+}
+
+/**
+ * @func	WIDGET_AddLabel
+ * @brief	Add a text label bound to a string pointer
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddLabel(
+		widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint16_t w, uint8_t size,
+		uint16_t color, uint16_t background,
+		const char *const *text
+) {
+	widget_t *wd = _widget_new(screen, WIDGET_LABEL);
+
+	// Proportional text: the width comes from the glyphs, not a character count
+	if (w == 0 && *text != NULL) {
+		w = LCD_FONT_Width((const uint8_t *)*text, size);
+	}
+	if (wd != NULL) {
+		wd->rect = (widget_rect_t){ x, y, w, size };
+		wd->color = color;
+		wd->background = background;
+		wd->size = size;
+		wd->bind.text = text;
+	}
+	return wd;
+}
+
+/**
+ * @func	WIDGET_AddToggle
+ * @brief	Add an ON/OFF indicator bound to an int
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddToggle(
+		widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint8_t size,
+		uint16_t on_color, uint16_t off_color, uint16_t background,
+		const volatile int *state
+) {
+	widget_t *wd = _widget_new(screen, WIDGET_TOGGLE);
+
+	if (wd != NULL) {
+		wd->rect = (widget_rect_t){ x, y, 0, size };
+		wd->color = on_color;
+		wd->alt_color = off_color;
+		wd->background = background;
+		wd->size = size;
+		wd->bind.state = state;
+		WIDGET_SetToggleText(wd, "ON", "OFF");
+	}
+	return wd;
+}
+
+/**
+ * @func	WIDGET_SetToggleText
+ * @brief	Replace the ON/OFF texts of a toggle, resizing its bounds
+ * @retval	None
+*/
+void WIDGET_SetToggleText(widget_t *w, const char *on, const char *off)
+{
+	uint16_t won = LCD_FONT_Width((const uint8_t *)on, w->size);
+	uint16_t woff = LCD_FONT_Width((const uint8_t *)off, w->size);
+
+	// Proportional text: the box is as wide as the wider text
+	w->on_text = on;
+	w->off_text = off;
+	w->rect.w = won > woff ? won : woff;
+	w->valid = 0;
+}
+
+/**
+ * @func	WIDGET_AddIcon
+ * @brief	Add a 40x40 BMP16 icon bound to an image pointer
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddIcon(
+		widget_screen_t *screen,
+		uint16_t x, uint16_t y,
+		const unsigned char *const *image
+) {
+	widget_t *wd = _widget_new(screen, WIDGET_ICON);
+
+	if (wd != NULL) {
+		wd->rect = (widget_rect_t){ x, y, WIDGET_ICON_SIZE, WIDGET_ICON_SIZE };
+		wd->bind.image = image;
+	}
+	return wd;
+}
+
+/**
+ * @func	WIDGET_AddProgress
+ * @brief	Add a horizontal progress bar bound to an int in [0, max]
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddProgress(
+		widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+		uint16_t color, uint16_t background,
+		const volatile int *value, int32_t max
+) {
+	widget_t *wd;
+
+	if (w < 3 || h < 3) {
+		return NULL;
+	}
+	wd = _widget_new(screen, WIDGET_PROGRESS);
+	if (wd != NULL) {
+		wd->rect = (widget_rect_t){ x, y, w, h };
+		wd->color = color;
+		wd->background = background;
+		wd->bind.state = value;
+		wd->max = max;
+	}
+	return wd;
+}
+
+/**
+ * @func	WIDGET_AddSprite
+ * @brief	Add a sprite pair bound to an int, composited onto background
+ * @retval	Pointer to the widget, NULL if the screen is full
+*/
+widget_t *WIDGET_AddSprite(
+		widget_screen_t *screen,
+		uint16_t x, uint16_t y, uint16_t background,
+		const sprite_t *off, const sprite_t *on,
+		const volatile int *state
+) {
+	widget_t *wd;
+
+	if (off->width != on->width || off->height != on->height) {
+		return NULL;
+	}
+	wd = _widget_new(screen, WIDGET_SPRITE);
+	if (wd != NULL) {
+		wd->rect = (widget_rect_t){ x, y, on->width, on->height };
+		wd->background = background;
+		wd->sprites[0] = off;
+		wd->sprites[1] = on;
+		wd->bind.state = state;
+	}
+	return wd;
+}
+
+/**
+ * @func	WIDGET_Invalidate
+ * @brief	Force every widget of the screen to redraw on the next render
+ * @param	screen: the screen
+ * @retval	None
+*/
+void WIDGET_Invalidate(widget_screen_t *screen)
+{
+	for (uint16_t i = 0; i < screen->count; i++) {
+		screen->widgets[i].valid = 0;
+	}
+}
+
+/**
+ * @func	WIDGET_Render
+ * @brief	Redraw the widgets whose bound value changed since last render
+ * @param	screen: the screen
+ * @retval	Number of widgets redrawn
+ * @note	Each widget sends only its damage, the union of the area it
+ *			covered before and the area it covers now, minus what stays the
+ *			same. screen->damage receives the union of this pass (w == 0
+ *			when nothing was sent).
+*/
+uint16_t WIDGET_Render(widget_screen_t *screen)
+{
+	uint16_t drawn = 0;
+	widget_rect_t damage;
+
+	memset(&screen->damage, 0, sizeof(screen->damage));
+	/* Widgets are kept in z-order, so painting in array order keeps
+	 * overlapping widgets (labels on boxes) correct on a full redraw. */
+	for (uint16_t i = 0; i < screen->count; i++) {
+		widget_t *w = &screen->widgets[i];
+		uint32_t value = _widget_value(w);
+		uint16_t len = 0;
+
+		/* A label is unchanged only if both its length and its hash are:
+		 * a hash collision alone no longer skips a redraw */
+		if (w->type == WIDGET_LABEL && *w->bind.text != NULL) {
+			len = strlen(*w->bind.text);
+		}
+		if (w->valid && w->last == value && w->last_len == len) {
+			continue;
+		}
+		_widget_draw(w, value, &damage);
+		_damage_add(&screen->damage, &damage);
+		w->last = value;
+		w->last_len = len;
+		w->valid = 1;
+		drawn++;
+	}
+	return drawn;
+}
+
+
+/* END FILE */
@@ -0,0 +1,71 @@
+#ifndef __METRICS_H__
+#define __METRICS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Số bucket lớn nhất của một histogram (không tính +Inf)
+#define METRIC_BUCKETS_MAX  12
+
+typedef enum {
+    METRIC_COUNTER = 0,
+    METRIC_GAUGE,
+    METRIC_HISTOGRAM,
+} metric_type_t;
+
+// Một chuỗi số liệu (tên + nhãn). Cập nhật bằng phép atomic, không khoá,
+// nên gọi được từ bất kỳ task nào (không gọi từ ISR).
+typedef struct metric {
+    const char *name;
+    const char *help;
+    const char *labels;             // ví dụ "handler=\"led\"", NULL nếu không có
+    metric_type_t type;
+    volatile int32_t value;         // counter / gauge
+    // Histogram: giá trị quan sát theo đơn vị gốc (thường là µs)
+    const uint32_t *bounds;         // cận trên mỗi bucket, tăng dần
+    uint8_t nbounds;
+    uint32_t scale;                 // chia khi xuất (1000000: µs -> s)
+    volatile uint32_t buckets[METRIC_BUCKETS_MAX + 1];
+    volatile uint32_t sum_lo;       // tổng 64 bit ghép từ hai nửa 32 bit
+    volatile uint32_t sum_hi;
+    struct metric *next;
+} metric_t;
+
+// Bucket dùng chung cho thời gian xử lý (µs): 100 µs .. 1 s
+extern const uint32_t METRIC_LATENCY_US_BOUNDS[];
+#define METRIC_LATENCY_US_COUNT 12
+
+#define METRIC_COUNTER_INIT(n, l, h)    { .name = (n), .labels = (l), .help = (h), .type = METRIC_COUNTER }
+#define METRIC_GAUGE_INIT(n, l, h)      { .name = (n), .labels = (l), .help = (h), .type = METRIC_GAUGE }
+#define METRIC_LATENCY_INIT(n, l, h)    { .name = (n), .labels = (l), .help = (h), .type = METRIC_HISTOGRAM, \
+                                          .bounds = METRIC_LATENCY_US_BOUNDS, .nbounds = METRIC_LATENCY_US_COUNT, \
+                                          .scale = 1000000 }
+
+// Hàm nhận dữ liệu xuất ra, trả về 0 nếu thành công (cùng dạng json_flush_t)
+typedef int (*metrics_flush_t)(void *ctx, const char *data, size_t len);
+
+// Hàm được gọi ngay trước khi xuất để cập nhật các gauge lấy mẫu
+typedef void (*metrics_collector_t)(void);
+
+void metrics_register(metric_t *m);
+int metrics_add_collector(metrics_collector_t fn);
+int metrics_export(char *buf, size_t size, metrics_flush_t flush, void *ctx);
+
+static inline void metric_inc(metric_t *m)
+{
+    __atomic_fetch_add(&m->value, 1, __ATOMIC_RELAXED);
+}
+
+static inline void metric_add(metric_t *m, int32_t v)
+{
+    __atomic_fetch_add(&m->value, v, __ATOMIC_RELAXED);
+}
+
+static inline void metric_set(metric_t *m, int32_t v)
+{
+    __atomic_store_n(&m->value, v, __ATOMIC_RELAXED);
+}
+
+void metric_observe(metric_t *m, uint32_t v);
+
+#endif
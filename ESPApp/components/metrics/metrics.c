@@ -0,0 +1,243 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <freertos/FreeRTOS.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include "metrics.h"
+
+#define METRICS_COLLECTOR_MAX   8
+
+const uint32_t METRIC_LATENCY_US_BOUNDS[METRIC_LATENCY_US_COUNT] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000,
+};
+
+static metric_t *metrics_head;
+static portMUX_TYPE metrics_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static metrics_collector_t collectors[METRICS_COLLECTOR_MAX];
+static int collector_count;
+
+// Số liệu hệ thống luôn có
+static metric_t heap_free = METRIC_GAUGE_INIT("smartlight_heap_free_bytes", NULL, "Free heap");
+static metric_t heap_min_free = METRIC_GAUGE_INIT("smartlight_heap_min_free_bytes", NULL, "Lowest free heap since boot");
+static metric_t heap_largest = METRIC_GAUGE_INIT("smartlight_heap_largest_free_block_bytes", NULL, "Largest free heap block");
+static metric_t uptime = METRIC_GAUGE_INIT("smartlight_uptime_seconds", NULL, "Seconds since boot");
+
+/* Bộ đệm xuất: gom các dòng và đẩy ra khi đầy */
+typedef struct {
+    char *buf;
+    size_t size;
+    size_t len;
+    metrics_flush_t flush;
+    void *ctx;
+    int error;
+} metrics_out_t;
+
+static void out_write(metrics_out_t *o, const char *s, size_t n)
+{
+    while (n > 0 && !o->error) {
+        size_t part = o->size - o->len < n ? o->size - o->len : n;
+
+        memcpy(o->buf + o->len, s, part);
+        o->len += part;
+        s += part;
+        n -= part;
+        if (o->len == o->size) {
+            o->error = o->flush(o->ctx, o->buf, o->len);
+            o->len = 0;
+        }
+    }
+}
+
+static void out_printf(metrics_out_t *o, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+static void out_printf(metrics_out_t *o, const char *fmt, ...)
+{
+    char line[160];
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = vsnprintf(line, sizeof(line), fmt, ap);
+    va_end(ap);
+    if (n > 0) {
+        out_write(o, line, n < (int)sizeof(line) ? n : sizeof(line) - 1);
+    }
+}
+
+/* In v / scale dưới dạng số thập phân không dùng float */
+static void format_scaled(char *dst, size_t size, uint64_t v, uint32_t scale)
+{
+    if (scale <= 1) {
+        snprintf(dst, size, "%llu", (unsigned long long)v);
+        return;
+    }
+    int digits = 0;
+    for (uint32_t s = scale; s > 1; s /= 10) {
+        digits++;
+    }
+    snprintf(dst, size, "%llu.%0*llu", (unsigned long long)(v / scale), digits,
+             (unsigned long long)(v % scale));
+}
+
+static void metrics_collect_system(void)
+{
+    metric_set(&heap_free, heap_caps_get_free_size(MALLOC_CAP_DEFAULT));
+    metric_set(&heap_min_free, heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT));
+    metric_set(&heap_largest, heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT));
+    metric_set(&uptime, esp_timer_get_time() / 1000000);
+}
+
+static void metrics_init_once(void)
+{
+    static int done;
+
+    if (done) {
+        return;
+    }
+    done = 1;
+    metrics_register(&heap_free);
+    metrics_register(&heap_min_free);
+    metrics_register(&heap_largest);
+    metrics_register(&uptime);
+    metrics_add_collector(metrics_collect_system);
+}
+
+/// @brief Thêm một chuỗi số liệu vào registry (thường gọi lúc khởi tạo).
+///        Các chuỗi cùng tên được giữ liền nhau để HELP/TYPE chỉ in một lần.
+/// @param m số liệu có thời gian sống suốt chương trình (static)
+void metrics_register(metric_t *m)
+{
+    metric_t **pp;
+    metric_t **last_same = NULL;
+
+    portENTER_CRITICAL(&metrics_lock);
+    for (pp = &metrics_head; *pp != NULL; pp = &(*pp)->next) {
+        if (*pp == m) {
+            portEXIT_CRITICAL(&metrics_lock);
+            return;
+        }
+        if (strcmp((*pp)->name, m->name) == 0) {
+            last_same = &(*pp)->next;
+        }
+    }
+    if (last_same != NULL) {
+        pp = last_same;
+    }
+    m->next = *pp;
+    *pp = m;
+    portEXIT_CRITICAL(&metrics_lock);
+}
+
+/// @brief Đăng ký hàm cập nhật gauge, được gọi mỗi lần xuất
+/// @return 0 nếu thành công, -1 nếu đã đầy
+int metrics_add_collector(metrics_collector_t fn)
+{
+    int ret = -1;
+
+    portENTER_CRITICAL(&metrics_lock);
+    if (collector_count < METRICS_COLLECTOR_MAX) {
+        collectors[collector_count++] = fn;
+        ret = 0;
+    }
+    portEXIT_CRITICAL(&metrics_lock);
+    return ret;
+}
+
+/// @brief Ghi một giá trị vào histogram
+/// @param m histogram
+/// @param v giá trị theo đơn vị gốc (µs với METRIC_LATENCY_INIT)
+void metric_observe(metric_t *m, uint32_t v)
+{
+    uint8_t i = 0;
+
+    while (i < m->nbounds && v > m->bounds[i]) {
+        i++;
+    }
+    __atomic_fetch_add(&m->buckets[i], 1, __ATOMIC_RELAXED);
+    // Cộng 64 bit không khoá: nửa thấp tràn thì tăng nửa cao
+    if (__atomic_add_fetch(&m->sum_lo, v, __ATOMIC_RELAXED) < v) {
+        __atomic_fetch_add(&m->sum_hi, 1, __ATOMIC_RELAXED);
+    }
+}
+
+static void export_histogram(metrics_out_t *o, const metric_t *m)
+{
+    const char *sep = m->labels != NULL ? "," : "";
+    const char *labels = m->labels != NULL ? m->labels : "";
+    char le[24];
+    uint64_t count = 0;
+    uint64_t sum;
+    uint32_t hi;
+
+    for (uint8_t i = 0; i < m->nbounds; i++) {
+        count += m->buckets[i];
+        format_scaled(le, sizeof(le), m->bounds[i], m->scale);
+        out_printf(o, "%s_bucket{%s%sle=\"%s\"} %llu\n", m->name, labels, sep, le, (unsigned long long)count);
+    }
+    count += m->buckets[m->nbounds];
+    out_printf(o, "%s_bucket{%s%sle=\"+Inf\"} %llu\n", m->name, labels, sep, (unsigned long long)count);
+
+    do {
+        hi = m->sum_hi;
+        sum = ((uint64_t)hi << 32) | m->sum_lo;
+    } while (hi != m->sum_hi);
+    format_scaled(le, sizeof(le), sum, m->scale);
+    if (m->labels != NULL) {
+        out_printf(o, "%s_sum{%s} %s\n%s_count{%s} %llu\n", m->name, labels, le, m->name, labels,
+                   (unsigned long long)count);
+    } else {
+        out_printf(o, "%s_sum %s\n%s_count %llu\n", m->name, le, m->name, (unsigned long long)count);
+    }
+}
+
+/// @brief Xuất toàn bộ registry theo định dạng text của Prometheus (0.0.4)
+/// @param buf bộ đệm tạm
+/// @param size kích thước buf
+/// @param flush hàm nhận dữ liệu khi buf đầy và ở cuối
+/// @param ctx tham số truyền cho flush
+/// @return 0 nếu thành công
+int metrics_export(char *buf, size_t size, metrics_flush_t flush, void *ctx)
+{
+    static const char *type_names[] = { "counter", "gauge", "histogram" };
+    metrics_out_t o = { .buf = buf, .size = size, .flush = flush, .ctx = ctx };
+    const char *last_name = NULL;
+
+    metrics_init_once();
+    for (int i = 0; i < collector_count; i++) {
+        collectors[i]();
+    }
+
+    // Danh sách chỉ được thêm vào đầu hoặc giữa bằng cách gán con trỏ, nên
+    // duyệt không khoá vẫn thấy một danh sách hợp lệ
+    for (metric_t *m = metrics_head; m != NULL && !o.error; m = m->next) {
+        if (last_name == NULL || strcmp(last_name, m->name) != 0) {
+            out_printf(&o, "# HELP %s %s\n# TYPE %s %s\n", m->name, m->help ? m->help : "",
+                       m->name, type_names[m->type]);
+            last_name = m->name;
+        }
+        if (m->type == METRIC_HISTOGRAM) {
+            export_histogram(&o, m);
+        } else {
+            char value[16];
+
+            // Counter chỉ tăng nên in không dấu (tràn sau 2^32 thay vì 2^31)
+            if (m->type == METRIC_COUNTER) {
+                snprintf(value, sizeof(value), "%lu", (unsigned long)(uint32_t)m->value);
+            } else {
+                snprintf(value, sizeof(value), "%ld", (long)m->value);
+            }
+            if (m->labels != NULL) {
+                out_printf(&o, "%s{%s} %s\n", m->name, m->labels, value);
+            } else {
+                out_printf(&o, "%s %s\n", m->name, value);
+            }
+        }
+    }
+
+    if (!o.error && o.len > 0) {
+        o.error = flush(ctx, o.buf, o.len);
+    }
+    return o.error;
+}
@@ -0,0 +1,27 @@
+#ifndef __MIRROR_H__
+#define __MIRROR_H__
+
+#include <esp_http_server.h>
+
+/*
+ * Tin nhắn WebSocket nhị phân, little-endian:
+ *   u8 type (1 = keyframe, 2 = delta), u8 0, u16 width, u16 height, u16 count
+ *   count × { u16 x, u16 y, u16 w, u16 h, h hàng RLE }
+ * Mỗi hàng của một hình chữ nhật là w điểm RGB565 mã hoá PackBits theo điểm:
+ *   c < 128:  c + 1 điểm nguyên văn theo sau
+ *   c >= 128: điểm tiếp theo lặp lại c - 126 lần (2..129)
+ * Keyframe là một hình chữ nhật phủ cả màn hình; delta chỉ chứa vùng đã đổi.
+ * Client gửi một frame dữ liệu bất kỳ để xin keyframe.
+ */
+#define MIRROR_MSG_KEYFRAME     1
+#define MIRROR_MSG_DELTA        2
+
+void mirror_init(void);
+
+// Handler của endpoint WebSocket (đăng ký với is_websocket và handle_ws_control_frames)
+esp_err_t mirror_ws_handler(httpd_req_t *req);
+
+// Gọi từ close_fn của httpd trước khi đóng socket
+void mirror_client_closed(int fd);
+
+#endif
@@ -0,0 +1,508 @@
+#include <sdkconfig.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <lcd_shadow.h>
+#include <metrics.h>
+#include "mirror.h"
+
+#ifdef CONFIG_MIRROR_ENABLE
+
+static const char *TAG = "MIRROR";
+
+// Số vùng tối đa của một delta; vượt quá thì vùng cuối gộp phần còn lại
+#define MIRROR_MAX_RECTS    16
+
+// Chỗ dành trước dữ liệu cho header WebSocket (tối đa 10 byte, không mask)
+#define MIRROR_WS_HEAD      10
+
+// Một tin nhắn đã mã hoá, dùng chung cho mọi client nhận nó
+typedef struct {
+    uint32_t refs;          // chỉ đổi khi giữ mirror_lock
+    uint32_t len;           // số byte từ data, gồm header WebSocket
+    uint8_t *data;
+    uint8_t buf[];
+} mirror_msg_t;
+
+typedef struct {
+    int fd;                 // -1: chỗ trống
+    httpd_handle_t hd;
+    mirror_msg_t *msg;      // tin đang gửi dở, NULL khi rảnh
+    uint32_t sent;          // số byte của msg đã gửi
+    mirror_msg_t *ctrl;     // frame điều khiển (pong, close) chờ gửi sau msg
+    bool stale;             // đã lỡ một delta (hoặc mới vào): chờ keyframe
+    bool closing;           // client đã gửi close: chỉ còn trả close rồi đóng
+} mirror_client_t;
+
+static mirror_client_t clients[CONFIG_MIRROR_MAX_CLIENTS];
+static int client_count;
+static SemaphoreHandle_t mirror_lock;
+static TaskHandle_t mirror_task_handle;
+
+static metric_t clients_metric = METRIC_GAUGE_INIT("smartlight_mirror_clients", NULL, "Connected display viewers");
+static metric_t bytes_metric = METRIC_COUNTER_INIT("smartlight_mirror_bytes_total", NULL,
+                                                   "Bytes sent to display viewers");
+static metric_t keyframes_metric = METRIC_COUNTER_INIT("smartlight_mirror_keyframes_total", NULL,
+                                                       "Full screens sent to display viewers");
+static metric_t dropped_metric = METRIC_COUNTER_INIT("smartlight_mirror_dropped_total", NULL,
+                                                     "Updates skipped because a viewer was still receiving");
+
+static uint8_t *put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+/* Mã hoá n điểm của một hàng theo PackBits (xem mirror.h), trả về cuối dữ liệu */
+static uint8_t *rle_row(uint8_t *p, const uint16_t *px, uint16_t n)
+{
+    uint16_t i = 0, run;
+
+    while (i < n) {
+        run = 1;
+        while (i + run < n && run < 129 && px[i + run] == px[i]) {
+            run++;
+        }
+        if (run >= 2) {
+            *p++ = 126 + run;
+            p = put16(p, px[i]);
+            i += run;
+            continue;
+        }
+        // Nguyên văn cho tới khi gặp hai điểm giống nhau liền nhau
+        run = 1;
+        while (i + run < n && run < 128 && !(i + run + 1 < n && px[i + run] == px[i + run + 1])) {
+            run++;
+        }
+        *p++ = run - 1;
+        while (run--) {
+            p = put16(p, px[i++]);
+        }
+    }
+    return p;
+}
+
+static void msg_release(mirror_msg_t *m)
+{
+    if (m != NULL && --m->refs == 0) {
+        heap_caps_free(m);
+    }
+}
+
+/* Mã hoá các vùng từ bản sao màn hình thành một frame WebSocket nhị phân.
+ * Vùng được cắt theo kích thước hiện tại (màn hình có thể vừa xoay) */
+static mirror_msg_t *msg_build(uint8_t type, lcd_shadow_rect_t *rects, int count)
+{
+    uint16_t row[LCD_SHADOW_ROW_PIXELS];
+    uint16_t width, height;
+    size_t size = MIRROR_WS_HEAD + 8, payload;
+    mirror_msg_t *m;
+    uint8_t *p;
+
+    if (LCD_SHADOW_Size(&width, &height) != 0) {
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        lcd_shadow_rect_t *r = &rects[i];
+
+        r->x = r->x < width ? r->x : width;
+        r->y = r->y < height ? r->y : height;
+        r->w = r->x + r->w <= width ? r->w : width - r->x;
+        r->h = r->y + r->h <= height ? r->h : height - r->y;
+        // Trường hợp xấu nhất: toàn nguyên văn, 1 byte điều khiển cho 128 điểm
+        size += 8 + (size_t)r->h * (2 * r->w + (r->w + 127) / 128);
+    }
+
+    m = heap_caps_malloc(sizeof(*m) + size, MALLOC_CAP_SPIRAM);
+    if (m == NULL) {
+        m = heap_caps_malloc(sizeof(*m) + size, MALLOC_CAP_8BIT);
+    }
+    if (m == NULL) {
+        ESP_LOGW(TAG, "No memory for a %u-byte update", (unsigned)size);
+        return NULL;
+    }
+
+    p = m->buf + MIRROR_WS_HEAD;
+    *p++ = type;
+    *p++ = 0;
+    p = put16(p, width);
+    p = put16(p, height);
+    p = put16(p, count);
+    for (int i = 0; i < count; i++) {
+        const lcd_shadow_rect_t *r = &rects[i];
+
+        p = put16(p, r->x);
+        p = put16(p, r->y);
+        p = put16(p, r->w);
+        p = put16(p, r->h);
+        for (uint16_t y = r->y; y < r->y + r->h; y++) {
+            LCD_SHADOW_Row(y, row);
+            p = rle_row(p, row + r->x, r->w);
+        }
+    }
+
+    // Header WebSocket ngay trước payload: FIN + binary, độ dài 7/16/64 bit
+    payload = p - (m->buf + MIRROR_WS_HEAD);
+    if (payload < 126) {
+        m->data = m->buf + MIRROR_WS_HEAD - 2;
+        m->data[1] = payload;
+    } else if (payload <= 0xFFFF) {
+        m->data = m->buf + MIRROR_WS_HEAD - 4;
+        m->data[1] = 126;
+        m->data[2] = payload >> 8;
+        m->data[3] = payload;
+    } else {
+        m->data = m->buf;
+        m->data[1] = 127;
+        for (int i = 0; i < 8; i++) {
+            m->data[2 + i] = (uint64_t)payload >> (56 - 8 * i);
+        }
+    }
+    m->data[0] = 0x82;
+    m->len = p - m->data;
+    m->refs = 1;
+    return m;
+}
+
+/* Frame điều khiển (pong, close) với payload tối đa 125 byte */
+static mirror_msg_t *msg_control(uint8_t opcode, const uint8_t *payload, size_t len)
+{
+    mirror_msg_t *m = heap_caps_malloc(sizeof(*m) + 2 + len, MALLOC_CAP_8BIT);
+
+    if (m == NULL) {
+        return NULL;
+    }
+    m->data = m->buf;
+    m->data[0] = 0x80 | opcode;
+    m->data[1] = len;
+    memcpy(m->data + 2, payload, len);
+    m->len = 2 + len;
+    m->refs = 1;
+    return m;
+}
+
+static mirror_client_t *client_find(int fd)
+{
+    for (int i = 0; i < CONFIG_MIRROR_MAX_CLIENTS; i++) {
+        if (clients[i].fd == fd) {
+            return &clients[i];
+        }
+    }
+    return NULL;
+}
+
+/* Bỏ một client khỏi bảng, gọi khi giữ mirror_lock */
+static void client_remove(mirror_client_t *c)
+{
+    msg_release(c->msg);
+    msg_release(c->ctrl);
+    c->msg = NULL;
+    c->ctrl = NULL;
+    c->fd = -1;
+    client_count--;
+    metric_set(&clients_metric, client_count);
+}
+
+/* Gửi tiếp tin đang dở của c mà không chặn, gọi khi giữ mirror_lock.
+ * Mọi byte ghi vào socket đều đi qua đây nên frame điều khiển chỉ được gửi
+ * giữa hai tin trọn vẹn. Socket đầy thì để lần sau; lỗi khác thì đóng phiên */
+static void client_send(mirror_client_t *c)
+{
+    ssize_t r;
+
+    if (c->msg == NULL) {
+        c->msg = c->ctrl;
+        c->ctrl = NULL;
+        c->sent = 0;
+    }
+    r = send(c->fd, c->msg->data + c->sent, c->msg->len - c->sent, MSG_DONTWAIT);
+    if (r > 0) {
+        metric_add(&bytes_metric, r);
+        c->sent += r;
+        if (c->sent == c->msg->len) {
+            msg_release(c->msg);
+            c->msg = NULL;
+            if (c->closing && c->ctrl == NULL) {
+                // Đã trả close: đóng phiên
+                httpd_sess_trigger_close(c->hd, c->fd);
+                client_remove(c);
+            }
+        }
+        return;
+    }
+    if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return;
+    }
+    ESP_LOGI(TAG, "Viewer fd %d gone (errno %d)", c->fd, errno);
+    httpd_sess_trigger_close(c->hd, c->fd);
+    client_remove(c);
+}
+
+/* Giao tin mới cho các client rảnh. Client còn đang nhận tin trước sẽ lỡ delta
+ * này và chuyển sang chờ keyframe: client chậm không bao giờ làm tồn đọng dữ liệu */
+static void mirror_update(lcd_shadow_rect_t *rects, int count)
+{
+    mirror_msg_t *key = NULL, *delta = NULL;
+    bool want_key = false, want_delta = false;
+    lcd_shadow_rect_t full = { 0 };
+
+    xSemaphoreTake(mirror_lock, portMAX_DELAY);
+    for (int i = 0; i < CONFIG_MIRROR_MAX_CLIENTS; i++) {
+        mirror_client_t *c = &clients[i];
+
+        if (c->fd < 0 || c->closing) {
+            continue;
+        }
+        if (c->msg != NULL) {
+            if (count > 0 && !c->stale) {
+                c->stale = true;
+                metric_inc(&dropped_metric);
+            }
+        } else if (c->stale) {
+            want_key = true;
+        } else if (count > 0) {
+            want_delta = true;
+        }
+    }
+    xSemaphoreGive(mirror_lock);
+
+    // Mã hoá ngoài khoá: việc vẽ vẫn tiếp tục, vùng vẽ thêm lúc này nằm trong lần sau
+    if (want_key && LCD_SHADOW_Size(&full.w, &full.h) == 0) {
+        key = msg_build(MIRROR_MSG_KEYFRAME, &full, 1);
+    }
+    if (want_delta) {
+        delta = msg_build(MIRROR_MSG_DELTA, rects, count);
+    }
+
+    xSemaphoreTake(mirror_lock, portMAX_DELAY);
+    for (int i = 0; i < CONFIG_MIRROR_MAX_CLIENTS; i++) {
+        mirror_client_t *c = &clients[i];
+
+        if (c->fd < 0 || c->msg != NULL || c->closing) {
+            continue;
+        }
+        if (c->stale && key != NULL) {
+            c->msg = key;
+            c->stale = false;
+            metric_inc(&keyframes_metric);
+        } else if (!c->stale && count > 0) {
+            // Không đủ bộ nhớ cho delta: đồng bộ lại bằng keyframe sau
+            c->msg = delta;
+            c->stale = (delta == NULL);
+        }
+        if (c->msg != NULL) {
+            c->msg->refs++;
+            c->sent = 0;
+        }
+    }
+    msg_release(key);
+    msg_release(delta);
+    xSemaphoreGive(mirror_lock);
+}
+
+/* Đẩy dữ liệu cho các client tới khi gửi hết hoặc đến tick until */
+static void mirror_pump(TickType_t until)
+{
+    struct timeval tv;
+    fd_set wfds;
+    int32_t left;
+    int maxfd;
+
+    while (1) {
+        FD_ZERO(&wfds);
+        maxfd = -1;
+        xSemaphoreTake(mirror_lock, portMAX_DELAY);
+        for (int i = 0; i < CONFIG_MIRROR_MAX_CLIENTS; i++) {
+            mirror_client_t *c = &clients[i];
+
+            if (c->fd < 0 || (c->msg == NULL && c->ctrl == NULL)) {
+                continue;
+            }
+            client_send(c);
+            if (c->fd >= 0 && (c->msg != NULL || c->ctrl != NULL)) {
+                FD_SET(c->fd, &wfds);
+                maxfd = c->fd > maxfd ? c->fd : maxfd;
+            }
+        }
+        xSemaphoreGive(mirror_lock);
+
+        left = (int32_t)(until - xTaskGetTickCount());
+        if (maxfd < 0 || left <= 0) {
+            return;
+        }
+        tv.tv_sec = left * portTICK_PERIOD_MS / 1000;
+        tv.tv_usec = left * portTICK_PERIOD_MS % 1000 * 1000;
+        select(maxfd + 1, NULL, &wfds, NULL, &tv);
+    }
+}
+
+/* Task gửi: mỗi 1/CONFIG_MIRROR_FPS giây lấy các vùng đã đổi và gửi một lần.
+ * Không có client thì ngủ, các vùng đổi trong lúc đó được bỏ (client mới
+ * luôn bắt đầu bằng keyframe) */
+static void mirror_task(void *arg)
+{
+    TickType_t period = pdMS_TO_TICKS(1000 / CONFIG_MIRROR_FPS);
+    TickType_t next = xTaskGetTickCount();
+    lcd_shadow_rect_t rects[MIRROR_MAX_RECTS];
+    int count;
+
+    if (period == 0) {
+        period = 1;
+    }
+    while (1) {
+        if (client_count == 0) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            next = xTaskGetTickCount();
+        }
+        next += period;
+        count = LCD_SHADOW_Damage(rects, MIRROR_MAX_RECTS);
+        mirror_update(rects, count);
+        mirror_pump(next);
+        if ((int32_t)(next - xTaskGetTickCount()) > 0) {
+            vTaskDelay(next - xTaskGetTickCount());
+        } else {
+            next = xTaskGetTickCount();
+        }
+    }
+}
+
+/// @brief Xử lý /mirror/ws: thêm client khi bắt tay, frame dữ liệu client gửi
+///        lên là yêu cầu keyframe. Route đặt handle_ws_control_frames nên
+///        ping/close cũng tới đây; câu trả lời được giao cho task gửi để không
+///        chen vào giữa một tin đang gửi dở. Trả ESP_FAIL để httpd đóng phiên
+esp_err_t mirror_ws_handler(httpd_req_t *req)
+{
+    httpd_ws_frame_t frame = { 0 };
+    uint8_t buf[125];
+    mirror_msg_t *reply = NULL;
+    mirror_client_t *c;
+    int fd = httpd_req_to_sockfd(req);
+
+    if (mirror_lock == NULL) {
+        return ESP_FAIL;
+    }
+
+    if (req->method == HTTP_GET) {
+        // Bắt tay xong (httpd đã trả 101): client chờ keyframe ở tick tới
+        xSemaphoreTake(mirror_lock, portMAX_DELAY);
+        c = client_find(-1);
+        if (c != NULL) {
+            c->fd = fd;
+            c->hd = req->handle;
+            c->msg = NULL;
+            c->ctrl = NULL;
+            c->stale = true;
+            c->closing = false;
+            client_count++;
+            metric_set(&clients_metric, client_count);
+        }
+        xSemaphoreGive(mirror_lock);
+        if (c == NULL) {
+            ESP_LOGW(TAG, "Viewer limit (%d) reached", CONFIG_MIRROR_MAX_CLIENTS);
+            return ESP_FAIL;
+        }
+        xTaskNotifyGive(mirror_task_handle);
+        return ESP_OK;
+    }
+
+    if (httpd_ws_recv_frame(req, &frame, 0) != ESP_OK || frame.len > sizeof(buf)) {
+        return ESP_FAIL;
+    }
+    frame.payload = buf;
+    if (frame.len > 0 && httpd_ws_recv_frame(req, &frame, frame.len) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    if (frame.type == HTTPD_WS_TYPE_PONG) {
+        return ESP_OK;
+    }
+    if (frame.type == HTTPD_WS_TYPE_PING || frame.type == HTTPD_WS_TYPE_CLOSE) {
+        // Close trả lại mã trạng thái (2 byte đầu), bỏ phần lý do
+        if (frame.type == HTTPD_WS_TYPE_PING) {
+            reply = msg_control(HTTPD_WS_TYPE_PONG, buf, frame.len);
+        } else {
+            reply = msg_control(HTTPD_WS_TYPE_CLOSE, buf, frame.len < 2 ? 0 : 2);
+        }
+        if (reply == NULL) {
+            return ESP_FAIL;
+        }
+    }
+
+    xSemaphoreTake(mirror_lock, portMAX_DELAY);
+    c = client_find(fd);
+    if (c != NULL && !c->closing) {
+        if (reply != NULL) {
+            // Chỉ cần trả lời ping mới nhất
+            msg_release(c->ctrl);
+            c->ctrl = reply;
+            c->closing = (frame.type == HTTPD_WS_TYPE_CLOSE);
+            reply = NULL;
+        } else {
+            c->stale = true;
+        }
+    }
+    msg_release(reply);
+    xSemaphoreGive(mirror_lock);
+    return ESP_OK;
+}
+
+void mirror_client_closed(int fd)
+{
+    mirror_client_t *c;
+
+    if (mirror_lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(mirror_lock, portMAX_DELAY);
+    c = client_find(fd);
+    if (c != NULL) {
+        client_remove(c);
+    }
+    xSemaphoreGive(mirror_lock);
+}
+
+/// @brief Khởi tạo task gửi, gọi sau GUI_Init (cần bản sao màn hình của LCD)
+void mirror_init(void)
+{
+    uint16_t width, height;
+
+    if (LCD_SHADOW_Size(&width, &height) != 0) {
+        ESP_LOGW(TAG, "No screen copy, mirror disabled");
+        return;
+    }
+    for (int i = 0; i < CONFIG_MIRROR_MAX_CLIENTS; i++) {
+        clients[i].fd = -1;
+    }
+    metrics_register(&clients_metric);
+    metrics_register(&bytes_metric);
+    metrics_register(&keyframes_metric);
+    metrics_register(&dropped_metric);
+    mirror_lock = xSemaphoreCreateMutex();
+    xTaskCreate(mirror_task, "mirror", 4096, NULL, CONFIG_MIRROR_TASK_PRIORITY, &mirror_task_handle);
+    ESP_LOGI(TAG, "%ux%u at %d fps on /mirror", width, height, CONFIG_MIRROR_FPS);
+}
+
+#else
+
+void mirror_init(void)
+{
+}
+
+esp_err_t mirror_ws_handler(httpd_req_t *req)
+{
+    httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Mirror disabled");
+    return ESP_FAIL;
+}
+
+void mirror_client_closed(int fd)
+{
+}
+
+#endif
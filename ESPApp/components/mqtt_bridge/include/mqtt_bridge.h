@@ -0,0 +1,23 @@
+#ifndef __MQTT_BRIDGE_H__
+#define __MQTT_BRIDGE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Topic (root = <base>/<id>):
+ *   root/status        "online" / "offline" (retained, LWT)
+ *   root/ch/<n>        "ON" / "OFF" (retained)
+ *   root/state         {"state": bitmask, "version": n} (retained)
+ *   root/ch/<n>/set    ON | OFF | TOGGLE | 1 | 0
+ *   root/state/set     giống body của PUT /state
+ *   root/scene/set     tên scene
+ */
+
+#define MQTT_BRIDGE_TOPIC_MAX   64
+
+void mqtt_bridge_init(void);
+
+bool mqtt_bridge_connected(void);
+
+#endif
@@ -0,0 +1,251 @@
+#include <sdkconfig.h>
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_log.h>
+#include <channel.h>
+#include <scene.h>
+#include <json_writer.h>
+#include <trace.h>
+#include "mqtt_bridge.h"
+
+#ifdef CONFIG_MQTT_BRIDGE_ENABLE
+
+#include <esp_mac.h>
+#include <mqtt_client.h>
+
+static const char *TAG = "MQTT";
+
+static esp_mqtt_client_handle_t client;
+static TaskHandle_t publish_task;
+static volatile bool connected;
+
+// Các kênh đã đổi nhưng chưa publish (bit i = kênh i)
+static volatile uint32_t dirty_mask;
+
+// <base>/<id>, ví dụ "smartlight/a1b2c3"
+static char root[MQTT_BRIDGE_TOPIC_MAX - 16];
+static char status_topic[MQTT_BRIDGE_TOPIC_MAX];
+
+static void publish(const char *suffix, const char *data, int len, bool retain)
+{
+    char topic[MQTT_BRIDGE_TOPIC_MAX];
+
+    snprintf(topic, sizeof(topic), "%s/%s", root, suffix);
+    // Đưa vào outbox, task của esp-mqtt gửi đi; không chặn task gọi
+    esp_mqtt_client_enqueue(client, topic, data, len, CONFIG_MQTT_BRIDGE_QOS, retain, true);
+}
+
+/* Publish các kênh trong changed và trạng thái tổng hợp một lần */
+static void publish_changes(uint32_t changed)
+{
+    char suffix[16];
+    char buf[64];
+    json_writer_t w;
+    uint32_t version;
+    uint16_t bits = channel_snapshot(&version);
+
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        if (changed & (1u << i)) {
+            snprintf(suffix, sizeof(suffix), "ch/%d", i);
+            publish(suffix, (bits >> i) & 1 ? "ON" : "OFF", 0, true);
+        }
+    }
+
+    // Không có flush: payload nhỏ phải nằm gọn trong buf
+    json_init(&w, buf, sizeof(buf), NULL, NULL);
+    json_obj_begin(&w);
+    json_kv_uint(&w, "state", bits);
+    json_kv_uint(&w, "version", version);
+    json_obj_end(&w);
+    if (w.error == 0 && w.depth == 0) {
+        publish("state", buf, w.len, true);
+    }
+}
+
+/* Task publish: chờ thay đổi, gom trong CONFIG_MQTT_BRIDGE_BATCH_MS rồi gửi một lô */
+static void mqtt_publish_task(void *arg)
+{
+    uint32_t changed;
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (CONFIG_MQTT_BRIDGE_BATCH_MS > 0) {
+            vTaskDelay(pdMS_TO_TICKS(CONFIG_MQTT_BRIDGE_BATCH_MS));
+        }
+        changed = __atomic_exchange_n(&dirty_mask, 0, __ATOMIC_SEQ_CST);
+        if (!connected || changed == 0) {
+            // Khi kết nối lại sẽ đồng bộ toàn bộ
+            continue;
+        }
+        publish_changes(changed);
+    }
+}
+
+// Listener của channel: chỉ đánh dấu, việc gửi do task publish
+static void mqtt_on_change(uint8_t ch, int state)
+{
+    __atomic_fetch_or(&dirty_mask, 1u << ch, __ATOMIC_SEQ_CST);
+    xTaskNotifyGive(publish_task);
+}
+
+static int payload_state(const char *p)
+{
+    if (strcasecmp(p, "ON") == 0 || strcmp(p, "1") == 0 || strcasecmp(p, "true") == 0) {
+        return 1;
+    }
+    if (strcasecmp(p, "OFF") == 0 || strcmp(p, "0") == 0 || strcasecmp(p, "false") == 0) {
+        return 0;
+    }
+    if (strcasecmp(p, "TOGGLE") == 0) {
+        return 2;
+    }
+    return -1;
+}
+
+/* Xử lý lệnh nhận được; topic đã bỏ phần root */
+static void handle_command(const char *topic, const char *payload)
+{
+    uint16_t mask, values;
+    char *end;
+
+    if (strncmp(topic, "ch/", 3) == 0) {
+        unsigned long ch = strtoul(topic + 3, &end, 10);
+        int state = payload_state(payload);
+
+        if (end == topic + 3 || strcmp(end, "/set") != 0 || ch >= CHANNEL_COUNT || state < 0) {
+            ESP_LOGW(TAG, "Bad command %s: %s", topic, payload);
+            return;
+        }
+        // Cùng đường thay đổi trạng thái với nút nhấn và web server
+        if (state == 2) {
+            channel_toggle(ch);
+        } else {
+            channel_set(ch, state);
+        }
+    } else if (strcmp(topic, "state/set") == 0) {
+        if (channel_parse_state(payload, &mask, &values) != 0) {
+            ESP_LOGW(TAG, "Bad state: %s", payload);
+            return;
+        }
+        channel_set_mask(mask, values);
+    } else if (strcmp(topic, "scene/set") == 0) {
+        if (scene_apply(payload, NULL) != ESP_OK) {
+            ESP_LOGW(TAG, "Unknown scene: %s", payload);
+        }
+    }
+}
+
+static void subscribe(const char *suffix)
+{
+    char topic[MQTT_BRIDGE_TOPIC_MAX];
+
+    snprintf(topic, sizeof(topic), "%s/%s", root, suffix);
+    esp_mqtt_client_subscribe(client, topic, CONFIG_MQTT_BRIDGE_QOS);
+}
+
+static void mqtt_event_handler(void *arg, esp_event_base_t base, int32_t event_id, void *event_data)
+{
+    esp_mqtt_event_handle_t event = event_data;
+    size_t root_len = strlen(root);
+    char topic[MQTT_BRIDGE_TOPIC_MAX];
+    char payload[128];
+
+    switch ((esp_mqtt_event_id_t)event_id) {
+        case MQTT_EVENT_CONNECTED:
+            ESP_LOGI(TAG, "Connected to %s", CONFIG_MQTT_BRIDGE_BROKER_URI);
+            connected = true;
+            publish("status", "online", 0, true);
+            subscribe("ch/+/set");
+            subscribe("state/set");
+            subscribe("scene/set");
+            // Đồng bộ lại toàn bộ trạng thái retained
+            __atomic_fetch_or(&dirty_mask, (1u << CHANNEL_COUNT) - 1, __ATOMIC_SEQ_CST);
+            xTaskNotifyGive(publish_task);
+            break;
+
+        case MQTT_EVENT_DISCONNECTED:
+            ESP_LOGW(TAG, "Disconnected");
+            connected = false;
+            break;
+
+        case MQTT_EVENT_DATA:
+            // Lệnh luôn ngắn; bỏ qua bản tin bị chia nhỏ hoặc quá dài
+            if (event->data_len != event->total_data_len ||
+                event->topic_len >= (int)sizeof(topic) ||
+                event->data_len >= (int)sizeof(payload) ||
+                event->topic_len <= (int)root_len + 1 ||
+                strncmp(event->topic, root, root_len) != 0 ||
+                event->topic[root_len] != '/') {
+                break;
+            }
+            memcpy(topic, event->topic, event->topic_len);
+            topic[event->topic_len] = '\0';
+            memcpy(payload, event->data, event->data_len);
+            payload[event->data_len] = '\0';
+            trace_record(TRACE_MQTT_CMD, 0);
+            handle_command(topic + root_len + 1, payload);
+            break;
+
+        case MQTT_EVENT_ERROR:
+            ESP_LOGE(TAG, "Error event");
+            break;
+
+        default:
+            break;
+    }
+}
+
+/// @brief Khởi tạo MQTT client, gọi sau wifi_init (client tự kết nối lại khi có mạng)
+void mqtt_bridge_init(void)
+{
+    uint8_t mac[6];
+
+    esp_read_mac(mac, ESP_MAC_WIFI_STA);
+    snprintf(root, sizeof(root), "%s/%02x%02x%02x", CONFIG_MQTT_BRIDGE_BASE_TOPIC, mac[3], mac[4], mac[5]);
+    snprintf(status_topic, sizeof(status_topic), "%s/status", root);
+
+    const esp_mqtt_client_config_t config = {
+        .broker.address.uri = CONFIG_MQTT_BRIDGE_BROKER_URI,
+        .credentials.username = CONFIG_MQTT_BRIDGE_USERNAME[0] ? CONFIG_MQTT_BRIDGE_USERNAME : NULL,
+        .credentials.authentication.password = CONFIG_MQTT_BRIDGE_PASSWORD[0] ? CONFIG_MQTT_BRIDGE_PASSWORD : NULL,
+        .session.last_will = {
+            .topic = status_topic,
+            .msg = "offline",
+            .qos = CONFIG_MQTT_BRIDGE_QOS,
+            .retain = 1,
+        },
+    };
+
+    xTaskCreate(mqtt_publish_task, "mqtt_pub", 3072, NULL, CONFIG_MQTT_BRIDGE_TASK_PRIORITY, &publish_task);
+
+    client = esp_mqtt_client_init(&config);
+    if (client == NULL) {
+        ESP_LOGE(TAG, "Failed to create client");
+        return;
+    }
+    esp_mqtt_client_register_event(client, MQTT_EVENT_ANY, mqtt_event_handler, NULL);
+    channel_add_listener(mqtt_on_change);
+    ESP_ERROR_CHECK(esp_mqtt_client_start(client));
+    ESP_LOGI(TAG, "Topic root %s", root);
+}
+
+bool mqtt_bridge_connected(void)
+{
+    return connected;
+}
+
+#else
+
+void mqtt_bridge_init(void)
+{
+}
+
+bool mqtt_bridge_connected(void)
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include <stdint.h>
+#include <esp_err.h>
+
+// Loại hành động hẹn giờ
+typedef enum {
+    SCHED_FREE = 0,
+    SCHED_ONCE,         // một lần, sau một khoảng thời gian ("tắt sau 30 phút")
+    SCHED_WEEKLY,       // lặp theo ngày trong tuần, giờ địa phương (cần SNTP)
+    SCHED_AUTO_OFF,     // tự tắt kênh sau khi bật, do scheduler_set_auto_off tạo
+} sched_kind_t;
+
+// Thông tin một hành động, dùng khi liệt kê
+typedef struct {
+    uint16_t id;
+    uint8_t kind;
+    uint8_t days;       // SCHED_WEEKLY: bit 0 = Chủ nhật ... bit 6 = Thứ bảy
+    uint16_t minute;    // SCHED_WEEKLY: phút trong ngày (0..1439)
+    uint16_t mask;      // các kênh bị tác động
+    uint16_t values;    // trạng thái đặt cho các kênh trong mask
+    int32_t in_s;       // số giây tới lần chạy kế tiếp, -1 nếu đang chờ đồng bộ giờ
+} sched_info_t;
+
+typedef void (*sched_visit_t)(const sched_info_t *info, void *ctx);
+
+void scheduler_init(void);
+
+// Đồng hồ đã được SNTP đặt chưa (lịch tuần chỉ chạy khi đã đặt)
+int scheduler_time_valid(void);
+
+esp_err_t scheduler_add_once(uint32_t delay_s, uint16_t mask, uint16_t values, uint16_t *id);
+esp_err_t scheduler_add_weekly(uint8_t days, uint16_t minute, uint16_t mask, uint16_t values, uint16_t *id);
+esp_err_t scheduler_cancel(uint16_t id);
+
+// Tự tắt kênh sau seconds giây mỗi khi kênh được bật (0: không tự tắt)
+esp_err_t scheduler_set_auto_off(uint8_t ch, uint32_t seconds);
+uint32_t scheduler_get_auto_off(uint8_t ch);
+
+int scheduler_foreach(sched_visit_t visit, void *ctx);
+
+#endif
@@ -0,0 +1,633 @@
+#include "scheduler.h"
+#include <sdkconfig.h>
+#include <channel.h>
+#include <metrics.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <sys/time.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <esp_timer.h>
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include <esp_netif_sntp.h>
+#endif
+#include <esp_log.h>
+#include <nvs.h>
+
+static const char *TAG = "Scheduler";
+
+// Mỗi hành động ONCE/WEEKLY là một blob "e<id>", thời gian tự tắt là blob "auto_off"
+#define SCHED_NAMESPACE     "sched"
+#define SCHED_AUTO_OFF_KEY  "auto_off"
+#define SCHED_DAY_MINUTES   (24 * 60)
+// Trước thời điểm này (2024-01-01) coi như đồng hồ chưa được SNTP đặt
+#define SCHED_EPOCH_MIN     1704067200
+
+typedef struct {
+    int64_t due_us;         // theo esp_timer_get_time()
+    int64_t due_epoch;      // SCHED_ONCE: thời điểm tuyệt đối, 0 khi đồng hồ chưa đặt
+    uint16_t mask;
+    uint16_t values;
+    uint16_t minute;
+    int16_t pos;            // vị trí trong heap, -1 khi không chờ
+    uint8_t kind;
+    uint8_t days;
+} sched_entry_t;
+
+// Bản ghi NVS của một hành động
+typedef struct {
+    uint8_t kind;
+    uint8_t days;
+    uint16_t minute;
+    uint16_t mask;
+    uint16_t values;
+    int64_t due_epoch;
+} sched_record_t;
+
+// id của hành động là chỉ số slot, nên id giữ nguyên qua các lần khởi động
+static sched_entry_t entries[CONFIG_SCHEDULER_MAX_ENTRIES];
+// Min-heap các slot đang chờ, sắp theo due_us: thêm/xoá O(log n), một esp_timer cho phần tử đầu
+static uint16_t heap[CONFIG_SCHEDULER_MAX_ENTRIES];
+static uint16_t heap_len;
+// Ngăn xếp slot trống
+static uint16_t free_slots[CONFIG_SCHEDULER_MAX_ENTRIES];
+static uint16_t free_count;
+
+static uint32_t auto_off_s[CHANNEL_COUNT];
+static int16_t auto_off_slot[CHANNEL_COUNT];
+
+// Mutex (không phải spinlock) vì NVS được ghi khi đang giữ khoá.
+// Hành động được thực hiện sau khi nhả khoá: listener tự tắt của chính module này sẽ lấy lại khoá
+static SemaphoreHandle_t sched_lock;
+static esp_timer_handle_t sched_timer;
+static TaskHandle_t sched_task;
+static volatile bool resync_pending;
+
+static metric_t pending_metric = METRIC_GAUGE_INIT("smartlight_schedule_pending", NULL,
+                                                   "Timed actions waiting to run");
+static metric_t runs_metric = METRIC_COUNTER_INIT("smartlight_schedule_runs_total", NULL,
+                                                  "Timed actions executed");
+
+int scheduler_time_valid(void)
+{
+    return time(NULL) >= SCHED_EPOCH_MIN;
+}
+
+static void heap_place(uint16_t pos, uint16_t slot)
+{
+    heap[pos] = slot;
+    entries[slot].pos = pos;
+}
+
+static void heap_up(uint16_t pos)
+{
+    uint16_t slot = heap[pos];
+
+    while (pos > 0) {
+        uint16_t parent = (pos - 1) / 2;
+        if (entries[heap[parent]].due_us <= entries[slot].due_us) {
+            break;
+        }
+        heap_place(pos, heap[parent]);
+        pos = parent;
+    }
+    heap_place(pos, slot);
+}
+
+static void heap_down(uint16_t pos)
+{
+    uint16_t slot = heap[pos];
+
+    for (;;) {
+        uint16_t child = 2 * pos + 1;
+        if (child >= heap_len) {
+            break;
+        }
+        if (child + 1 < heap_len && entries[heap[child + 1]].due_us < entries[heap[child]].due_us) {
+            child++;
+        }
+        if (entries[slot].due_us <= entries[heap[child]].due_us) {
+            break;
+        }
+        heap_place(pos, heap[child]);
+        pos = child;
+    }
+    heap_place(pos, slot);
+}
+
+static void heap_remove(uint16_t slot)
+{
+    int16_t pos = entries[slot].pos;
+    uint16_t moved;
+
+    if (pos < 0) {
+        return;
+    }
+    entries[slot].pos = -1;
+    heap_len--;
+    if (pos == heap_len) {
+        return;
+    }
+    moved = heap[heap_len];
+    heap_place(pos, moved);
+    heap_up(pos);
+    heap_down(entries[moved].pos);
+}
+
+/* Đặt thời điểm chạy của slot và đưa vào heap (giữ sched_lock) */
+static void sched_queue(uint16_t slot, int64_t due_us)
+{
+    heap_remove(slot);
+    entries[slot].due_us = due_us;
+    heap_place(heap_len++, slot);
+    heap_up(entries[slot].pos);
+}
+
+/* Hẹn esp_timer cho hành động gần nhất (giữ sched_lock) */
+static void sched_arm(void)
+{
+    int64_t delay;
+
+    esp_timer_stop(sched_timer);
+    if (heap_len == 0) {
+        return;
+    }
+    delay = entries[heap[0]].due_us - esp_timer_get_time();
+    esp_timer_start_once(sched_timer, delay > 0 ? delay : 1);
+}
+
+static int sched_alloc(void)
+{
+    int slot;
+
+    if (free_count == 0) {
+        return -1;
+    }
+    slot = free_slots[--free_count];
+    entries[slot] = (sched_entry_t){ .pos = -1 };
+    return slot;
+}
+
+static void sched_free(uint16_t slot)
+{
+    sched_entry_t *e = &entries[slot];
+
+    heap_remove(slot);
+    if (e->kind == SCHED_AUTO_OFF) {
+        auto_off_slot[__builtin_ctz(e->mask)] = -1;
+    }
+    e->kind = SCHED_FREE;
+    free_slots[free_count++] = slot;
+}
+
+/// @brief Lần chạy kế tiếp của lịch tuần, sau thời điểm after
+/// @return thời điểm (epoch), -1 nếu lịch không có ngày nào
+static time_t weekly_next(const sched_entry_t *e, time_t after)
+{
+    struct tm now, t;
+
+    localtime_r(&after, &now);
+    for (int d = 0; d <= 7; d++) {
+        time_t at;
+
+        t = now;
+        t.tm_mday += d;
+        t.tm_hour = e->minute / 60;
+        t.tm_min = e->minute % 60;
+        t.tm_sec = 0;
+        t.tm_isdst = -1;
+        at = mktime(&t);        // chuẩn hoá ngày và tính tm_wday
+        if (at > after && (e->days & (1 << t.tm_wday))) {
+            return at;
+        }
+    }
+    return -1;
+}
+
+/* Xếp lịch tuần vào heap theo giờ thật (giữ sched_lock, đồng hồ đã đặt) */
+static void sched_queue_weekly(uint16_t slot, time_t after)
+{
+    time_t now = time(NULL);
+    time_t at = weekly_next(&entries[slot], after);
+
+    if (at < 0) {
+        heap_remove(slot);
+        return;
+    }
+    sched_queue(slot, esp_timer_get_time() + (int64_t)(at - now) * 1000000);
+}
+
+static void sched_key(uint16_t slot, char *key, size_t size)
+{
+    snprintf(key, size, "e%u", slot);
+}
+
+/* Lưu hành động vào NVS (giữ sched_lock). Hẹn giờ một lần tạo khi đồng hồ
+ * chưa đặt không có thời điểm tuyệt đối nên chỉ được lưu sau khi có SNTP */
+static void sched_store(uint16_t slot)
+{
+    const sched_entry_t *e = &entries[slot];
+    sched_record_t rec = {
+        .kind = e->kind, .days = e->days, .minute = e->minute,
+        .mask = e->mask, .values = e->values, .due_epoch = e->due_epoch,
+    };
+    nvs_handle_t nvs;
+    char key[8];
+    esp_err_t err;
+
+    if (e->kind == SCHED_ONCE && e->due_epoch == 0) {
+        return;
+    }
+    sched_key(slot, key, sizeof(key));
+    err = nvs_open(SCHED_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs, key, &rec, sizeof(rec));
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save action %u (%s)", slot, esp_err_to_name(err));
+    }
+}
+
+static void sched_erase(uint16_t slot)
+{
+    nvs_handle_t nvs;
+    char key[8];
+
+    sched_key(slot, key, sizeof(key));
+    if (nvs_open(SCHED_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+        return;
+    }
+    if (nvs_erase_key(nvs, key) == ESP_OK) {
+        nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+}
+
+/* Tính lại thời điểm chạy theo giờ thật, sau mỗi lần SNTP đồng bộ (giữ sched_lock) */
+static void sched_resync(void)
+{
+    time_t now = time(NULL);
+    int64_t now_us = esp_timer_get_time();
+
+    for (uint16_t slot = 0; slot < CONFIG_SCHEDULER_MAX_ENTRIES; slot++) {
+        sched_entry_t *e = &entries[slot];
+
+        if (e->kind == SCHED_WEEKLY) {
+            sched_queue_weekly(slot, now);
+        } else if (e->kind == SCHED_ONCE && e->due_epoch != 0) {
+            // Hẹn giờ đã quá hạn khi thiết bị tắt sẽ chạy ngay
+            int64_t left = e->due_epoch > now ? (int64_t)(e->due_epoch - now) * 1000000 : 0;
+            sched_queue(slot, now_us + left);
+        } else if (e->kind == SCHED_ONCE && e->pos >= 0) {
+            // Tạo khi chưa có giờ: gắn thời điểm tuyệt đối để giữ được qua khởi động lại
+            e->due_epoch = now + (e->due_us - now_us) / 1000000;
+            sched_store(slot);
+        }
+    }
+    sched_arm();
+}
+
+static void sched_load(void)
+{
+    nvs_iterator_t it = NULL;
+    nvs_entry_info_t info;
+    nvs_handle_t nvs;
+    sched_record_t rec;
+    unsigned slot;
+    size_t len;
+    esp_err_t err;
+
+    if (nvs_open(SCHED_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return;
+    }
+    len = sizeof(auto_off_s);
+    nvs_get_blob(nvs, SCHED_AUTO_OFF_KEY, auto_off_s, &len);
+
+    err = nvs_entry_find(NVS_DEFAULT_PART_NAME, SCHED_NAMESPACE, NVS_TYPE_BLOB, &it);
+    while (err == ESP_OK) {
+        nvs_entry_info(it, &info);
+        len = sizeof(rec);
+        if (sscanf(info.key, "e%u", &slot) == 1 && slot < CONFIG_SCHEDULER_MAX_ENTRIES &&
+            nvs_get_blob(nvs, info.key, &rec, &len) == ESP_OK && len == sizeof(rec) &&
+            (rec.kind == SCHED_ONCE || rec.kind == SCHED_WEEKLY)) {
+            // Chỉ vào heap khi đồng hồ đã đặt (sched_resync)
+            entries[slot] = (sched_entry_t){
+                .kind = rec.kind, .days = rec.days, .minute = rec.minute,
+                .mask = rec.mask, .values = rec.values, .due_epoch = rec.due_epoch, .pos = -1,
+            };
+        }
+        err = nvs_entry_next(&it);
+    }
+    nvs_release_iterator(it);
+    nvs_close(nvs);
+}
+
+/* Thực hiện các hành động đã tới hạn, mỗi lần một hành động để không giữ khoá khi đổi kênh */
+static void sched_run_due(void)
+{
+    for (;;) {
+        sched_entry_t e;
+        uint16_t slot, changed;
+
+        xSemaphoreTake(sched_lock, portMAX_DELAY);
+        if (heap_len == 0 || entries[heap[0]].due_us > esp_timer_get_time()) {
+            sched_arm();
+            xSemaphoreGive(sched_lock);
+            return;
+        }
+        slot = heap[0];
+        e = entries[slot];
+        if (e.kind == SCHED_WEEKLY) {
+            // Tìm lần kế tiếp sau phút vừa chạy, để timer sớm vài ms không chạy lại
+            sched_queue_weekly(slot, time(NULL) + 60);
+        } else {
+            if (e.kind == SCHED_ONCE) {
+                sched_erase(slot);
+            }
+            sched_free(slot);
+        }
+        xSemaphoreGive(sched_lock);
+
+        changed = channel_set_mask(e.mask, e.values);
+        metric_inc(&runs_metric);
+        ESP_LOGI(TAG, "Action %u: mask 0x%04x state 0x%04x (changed 0x%04x)", slot, e.mask, e.values, changed);
+    }
+}
+
+static void scheduler_task(void *arg)
+{
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (resync_pending) {
+            resync_pending = false;
+            xSemaphoreTake(sched_lock, portMAX_DELAY);
+            sched_resync();
+            xSemaphoreGive(sched_lock);
+        }
+        sched_run_due();
+    }
+}
+
+// Chạy trên task esp_timer: chỉ đánh thức task scheduler
+static void sched_timer_cb(void *arg)
+{
+    xTaskNotifyGive(sched_task);
+}
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+static void sched_time_synced(struct timeval *tv)
+{
+    ESP_LOGI(TAG, "Time synchronised");
+    resync_pending = true;
+    xTaskNotifyGive(sched_task);
+}
+#endif
+
+/* Kênh đổi trạng thái: hẹn (hoặc gia hạn) tự tắt khi bật, huỷ khi tắt */
+static void sched_on_channel(uint8_t ch, int state)
+{
+    int slot;
+
+    if (ch >= CHANNEL_COUNT) {
+        return;
+    }
+    xSemaphoreTake(sched_lock, portMAX_DELAY);
+    slot = auto_off_slot[ch];
+    if (state && auto_off_s[ch] > 0) {
+        if (slot < 0) {
+            slot = sched_alloc();
+            if (slot < 0) {
+                ESP_LOGW(TAG, "No free slot for auto-off of channel %d", ch);
+                goto out;
+            }
+            entries[slot].kind = SCHED_AUTO_OFF;
+            entries[slot].mask = 1 << ch;
+            entries[slot].values = 0;
+            auto_off_slot[ch] = slot;
+        }
+        sched_queue(slot, esp_timer_get_time() + (int64_t)auto_off_s[ch] * 1000000);
+        sched_arm();
+    } else if (!state && slot >= 0) {
+        sched_free(slot);
+        sched_arm();
+    }
+out:
+    xSemaphoreGive(sched_lock);
+}
+
+static void scheduler_collect(void)
+{
+    metric_set(&pending_metric, heap_len);
+}
+
+/// @brief Hẹn một hành động chạy một lần
+/// @param delay_s số giây tính từ bây giờ
+/// @param mask các kênh bị tác động
+/// @param values trạng thái đặt cho các kênh trong mask
+/// @param id nhận id của hành động (có thể NULL)
+/// @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM nếu hết slot
+esp_err_t scheduler_add_once(uint32_t delay_s, uint16_t mask, uint16_t values, uint16_t *id)
+{
+    int slot;
+
+    if (mask == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    xSemaphoreTake(sched_lock, portMAX_DELAY);
+    slot = sched_alloc();
+    if (slot < 0) {
+        xSemaphoreGive(sched_lock);
+        return ESP_ERR_NO_MEM;
+    }
+    entries[slot].kind = SCHED_ONCE;
+    entries[slot].mask = mask;
+    entries[slot].values = values & mask;
+    entries[slot].due_epoch = scheduler_time_valid() ? time(NULL) + delay_s : 0;
+    sched_queue(slot, esp_timer_get_time() + (int64_t)delay_s * 1000000);
+    sched_store(slot);
+    sched_arm();
+    xSemaphoreGive(sched_lock);
+
+    if (id != NULL) {
+        *id = slot;
+    }
+    return ESP_OK;
+}
+
+/// @brief Thêm lịch lặp hằng tuần, theo giờ địa phương (CONFIG_SCHEDULER_TZ)
+/// @param days bit 0 = Chủ nhật ... bit 6 = Thứ bảy
+/// @param minute phút trong ngày (7:30 = 450)
+/// @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM nếu hết slot
+esp_err_t scheduler_add_weekly(uint8_t days, uint16_t minute, uint16_t mask, uint16_t values, uint16_t *id)
+{
+    int slot;
+
+    if (mask == 0 || (days & 0x7F) == 0 || minute >= SCHED_DAY_MINUTES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    xSemaphoreTake(sched_lock, portMAX_DELAY);
+    slot = sched_alloc();
+    if (slot < 0) {
+        xSemaphoreGive(sched_lock);
+        return ESP_ERR_NO_MEM;
+    }
+    entries[slot].kind = SCHED_WEEKLY;
+    entries[slot].days = days & 0x7F;
+    entries[slot].minute = minute;
+    entries[slot].mask = mask;
+    entries[slot].values = values & mask;
+    if (scheduler_time_valid()) {
+        sched_queue_weekly(slot, time(NULL));
+        sched_arm();
+    }
+    sched_store(slot);
+    xSemaphoreGive(sched_lock);
+
+    if (id != NULL) {
+        *id = slot;
+    }
+    return ESP_OK;
+}
+
+/// @brief Huỷ một hành động ONCE hoặc WEEKLY
+/// @return ESP_OK, ESP_ERR_NOT_FOUND nếu không có
+esp_err_t scheduler_cancel(uint16_t id)
+{
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+
+    if (id >= CONFIG_SCHEDULER_MAX_ENTRIES) {
+        return err;
+    }
+    xSemaphoreTake(sched_lock, portMAX_DELAY);
+    if (entries[id].kind == SCHED_ONCE || entries[id].kind == SCHED_WEEKLY) {
+        sched_erase(id);
+        sched_free(id);
+        sched_arm();
+        err = ESP_OK;
+    }
+    xSemaphoreGive(sched_lock);
+    return err;
+}
+
+/// @brief Đặt thời gian tự tắt của một kênh, lưu vào NVS
+/// @param ch kênh
+/// @param seconds số giây sau khi bật thì tắt, 0 để bỏ
+/// @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM hoặc lỗi NVS
+esp_err_t scheduler_set_auto_off(uint8_t ch, uint32_t seconds)
+{
+    nvs_handle_t nvs;
+    esp_err_t err;
+
+    if (ch >= CHANNEL_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    xSemaphoreTake(sched_lock, portMAX_DELAY);
+    auto_off_s[ch] = seconds;
+    err = nvs_open(SCHED_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs, SCHED_AUTO_OFF_KEY, auto_off_s, sizeof(auto_off_s));
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    xSemaphoreGive(sched_lock);
+
+    // Áp dụng ngay cho kênh đang bật (hoặc huỷ hẹn cũ)
+    sched_on_channel(ch, channel_get(ch));
+    return err;
+}
+
+uint32_t scheduler_get_auto_off(uint8_t ch)
+{
+    return ch < CHANNEL_COUNT ? auto_off_s[ch] : 0;
+}
+
+/// @brief Liệt kê các hành động đang có
+/// @param visit hàm được gọi cho mỗi hành động (không giữ khoá, có thể gửi dữ liệu mạng)
+/// @param ctx tham số truyền cho visit
+/// @return số hành động đã liệt kê
+int scheduler_foreach(sched_visit_t visit, void *ctx)
+{
+    int count = 0;
+
+    for (uint16_t slot = 0; slot < CONFIG_SCHEDULER_MAX_ENTRIES; slot++) {
+        sched_info_t info;
+        const sched_entry_t *e = &entries[slot];
+
+        xSemaphoreTake(sched_lock, portMAX_DELAY);
+        info = (sched_info_t){
+            .id = slot, .kind = e->kind, .days = e->days, .minute = e->minute,
+            .mask = e->mask, .values = e->values,
+            .in_s = e->pos >= 0 ? (int32_t)((e->due_us - esp_timer_get_time()) / 1000000) : -1,
+        };
+        xSemaphoreGive(sched_lock);
+
+        if (info.kind != SCHED_FREE) {
+            visit(&info, ctx);
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @func	scheduler_init
+ * @brief	Nạp hành động từ NVS, bắt đầu SNTP. Gọi sau wifi_init (cần esp_netif)
+ * @param	None
+ * @retval  None
+*/
+void scheduler_init(void)
+{
+    const esp_timer_create_args_t timer_args = {
+        .callback = sched_timer_cb,
+        .name = "sched",
+    };
+
+    sched_lock = xSemaphoreCreateMutex();
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        auto_off_slot[ch] = -1;
+    }
+    for (uint16_t slot = 0; slot < CONFIG_SCHEDULER_MAX_ENTRIES; slot++) {
+        entries[slot].pos = -1;
+    }
+    sched_load();
+    // Slot thấp được cấp trước
+    for (int slot = CONFIG_SCHEDULER_MAX_ENTRIES - 1; slot >= 0; slot--) {
+        if (entries[slot].kind == SCHED_FREE) {
+            free_slots[free_count++] = slot;
+        }
+    }
+    ESP_LOGI(TAG, "Loaded %d actions", CONFIG_SCHEDULER_MAX_ENTRIES - free_count);
+
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &sched_timer));
+    xTaskCreate(scheduler_task, "sched", 4096, NULL, CONFIG_SCHEDULER_TASK_PRIORITY, &sched_task);
+    channel_add_listener(sched_on_channel);
+
+    metrics_register(&pending_metric);
+    metrics_register(&runs_metric);
+    metrics_add_collector(scheduler_collect);
+
+    // Giờ địa phương cho lịch tuần
+    setenv("TZ", CONFIG_SCHEDULER_TZ, 1);
+    tzset();
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+    esp_sntp_config_t config = ESP_NETIF_SNTP_DEFAULT_CONFIG(CONFIG_SCHEDULER_SNTP_SERVER);
+    config.sync_cb = sched_time_synced;
+    esp_netif_sntp_init(&config);
+#endif
+
+    // Đồng hồ vẫn chạy qua soft reset (bản Linux dùng giờ máy host): xếp lịch ngay, không chờ SNTP
+    if (scheduler_time_valid()) {
+        resync_pending = true;
+        xTaskNotifyGive(sched_task);
+    }
+}
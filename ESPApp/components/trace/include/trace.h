@@ -0,0 +1,51 @@
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <stdint.h>
+#include <sdkconfig.h>
+
+// Các mốc trên đường đi của một lần bật/tắt, từ đầu vào tới khi màn hình vẽ xong
+typedef enum {
+    TRACE_BUTTON_ISR = 0,   // arg: GPIO
+    TRACE_BUTTON_RX,        // button_task nhận từ queue, arg: GPIO
+    TRACE_BUTTON_EVENT,     // đã chống dội, gọi callback, arg: GPIO
+    TRACE_HTTP_BEGIN,       // arg: chỉ số route
+    TRACE_HTTP_END,         // đã gửi phản hồi, arg: chỉ số route
+    TRACE_MQTT_CMD,         // arg: 0
+    TRACE_UDP_CMD,          // arg: op
+    TRACE_GPIO,             // đã ghi GPIO / trạng thái kênh, arg: kênh
+    TRACE_RENDER_REQUEST,
+    TRACE_LCD_BEGIN,
+    TRACE_LCD_END,          // arg: số điểm ảnh đã gửi (tối đa 65535)
+    TRACE_EVENT_COUNT,
+} trace_event_id_t;
+
+typedef struct {
+    uint32_t seq;           // chỉ số ghi + 1, 0 khi đang ghi dở
+    uint32_t ts_us;         // 32 bit thấp của esp_timer_get_time()
+    uint8_t event;
+    uint8_t core;
+    uint16_t arg;
+} trace_event_t;
+
+typedef void (*trace_visit_t)(const trace_event_t *e, void *ctx);
+
+#ifdef CONFIG_TRACE_ENABLE
+
+void trace_init(void);
+void trace_record(trace_event_id_t event, uint16_t arg);
+int trace_foreach(trace_visit_t visit, void *ctx);
+void trace_dump_serial(void);
+
+#else
+
+static inline void trace_init(void) {}
+static inline void trace_record(trace_event_id_t event, uint16_t arg) {}
+static inline int trace_foreach(trace_visit_t visit, void *ctx) { return 0; }
+static inline void trace_dump_serial(void) {}
+
+#endif
+
+const char *trace_event_name(uint8_t event);
+
+#endif
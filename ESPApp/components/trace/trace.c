@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_attr.h>
+#include <esp_timer.h>
+#include "trace.h"
+
+static const char *const event_names[TRACE_EVENT_COUNT] = {
+    [TRACE_BUTTON_ISR] = "button_isr",
+    [TRACE_BUTTON_RX] = "button_rx",
+    [TRACE_BUTTON_EVENT] = "button_event",
+    [TRACE_HTTP_BEGIN] = "http_begin",
+    [TRACE_HTTP_END] = "http_end",
+    [TRACE_MQTT_CMD] = "mqtt_cmd",
+    [TRACE_UDP_CMD] = "udp_cmd",
+    [TRACE_GPIO] = "gpio",
+    [TRACE_RENDER_REQUEST] = "render_request",
+    [TRACE_LCD_BEGIN] = "lcd_begin",
+    [TRACE_LCD_END] = "lcd_end",
+};
+
+const char *trace_event_name(uint8_t event)
+{
+    return event < TRACE_EVENT_COUNT ? event_names[event] : "unknown";
+}
+
+#ifdef CONFIG_TRACE_ENABLE
+
+#define TRACE_MASK  (CONFIG_TRACE_ENTRIES - 1)
+
+_Static_assert((CONFIG_TRACE_ENTRIES & TRACE_MASK) == 0, "CONFIG_TRACE_ENTRIES must be a power of two");
+
+static trace_event_t ring[CONFIG_TRACE_ENTRIES];
+static volatile uint32_t head;
+
+// Thời điểm đầu vào gần nhất (nút, HTTP, MQTT, UDP) để phát hiện lần bật/tắt chậm
+static volatile uint32_t last_input_us;
+static TaskHandle_t dump_task;
+
+static inline bool is_input(trace_event_id_t event)
+{
+    return event == TRACE_BUTTON_ISR || event == TRACE_HTTP_BEGIN ||
+           event == TRACE_MQTT_CMD || event == TRACE_UDP_CMD;
+}
+
+/// @brief Ghi một sự kiện; không khoá, gọi được từ ISR và từ mọi task
+/// @param event mốc trên đường bật/tắt
+/// @param arg tham số của mốc (GPIO, kênh, route...)
+void IRAM_ATTR trace_record(trace_event_id_t event, uint16_t arg)
+{
+    uint32_t idx = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+    trace_event_t *e = &ring[idx & TRACE_MASK];
+    uint32_t now = (uint32_t)esp_timer_get_time();
+
+    // seq = 0 trong lúc ghi để người đọc bỏ qua ô đang ghi dở
+    __atomic_store_n(&e->seq, 0, __ATOMIC_RELAXED);
+    e->ts_us = now;
+    e->event = event;
+    e->core = xPortGetCoreID();
+    e->arg = arg;
+    __atomic_store_n(&e->seq, idx + 1, __ATOMIC_RELEASE);
+
+    if (is_input(event)) {
+        last_input_us = now;
+    } else if (event == TRACE_LCD_END && CONFIG_TRACE_SLOW_TOGGLE_MS > 0 && last_input_us != 0 &&
+               now - last_input_us > CONFIG_TRACE_SLOW_TOGGLE_MS * 1000u) {
+        // LCD_END chỉ đến từ task render (không phải ISR)
+        last_input_us = 0;
+        if (dump_task != NULL) {
+            xTaskNotifyGive(dump_task);
+        }
+    }
+}
+
+/// @brief Duyệt các sự kiện còn trong ring theo thứ tự thời gian
+/// @param visit hàm nhận bản sao của từng sự kiện
+/// @param ctx 
+/// @return số sự kiện đã duyệt
+int trace_foreach(trace_visit_t visit, void *ctx)
+{
+    uint32_t end = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    uint32_t start = end > CONFIG_TRACE_ENTRIES ? end - CONFIG_TRACE_ENTRIES : 0;
+    int count = 0;
+
+    for (uint32_t idx = start; idx != end; idx++) {
+        const trace_event_t *slot = &ring[idx & TRACE_MASK];
+        trace_event_t copy;
+
+        copy.seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        copy.ts_us = slot->ts_us;
+        copy.event = slot->event;
+        copy.core = slot->core;
+        copy.arg = slot->arg;
+        // Ô đã bị ghi đè hoặc đang ghi trong lúc đọc: bỏ qua
+        if (copy.seq != idx + 1 || __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != copy.seq) {
+            continue;
+        }
+        visit(&copy, ctx);
+        count++;
+    }
+    return count;
+}
+
+static void dump_line(const trace_event_t *e, void *ctx)
+{
+    printf("TRACE %lu %lu %s %u %u\n", (unsigned long)e->seq, (unsigned long)e->ts_us,
+           trace_event_name(e->event), e->arg, e->core);
+}
+
+/// @brief In toàn bộ ring ra serial, mỗi dòng "TRACE seq ts_us event arg core"
+///        (utils/trace2chrome.py đọc được log này)
+void trace_dump_serial(void)
+{
+    printf("TRACE-BEGIN %lu\n", (unsigned long)(uint32_t)esp_timer_get_time());
+    trace_foreach(dump_line, NULL);
+    printf("TRACE-END\n");
+}
+
+static void trace_dump_task(void *arg)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        printf("Slow toggle (> %d ms), trace follows\n", CONFIG_TRACE_SLOW_TOGGLE_MS);
+        trace_dump_serial();
+    }
+}
+
+void trace_init(void)
+{
+    if (CONFIG_TRACE_SLOW_TOGGLE_MS > 0) {
+        xTaskCreate(trace_dump_task, "trace_dump", 3072, NULL, 1, &dump_task);
+    }
+}
+
+#endif
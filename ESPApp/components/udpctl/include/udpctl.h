@@ -0,0 +1,46 @@
+#ifndef __UDPCTL_H__
+#define __UDPCTL_H__
+
+#include <stdint.h>
+
+/*
+ * Giao thức điều khiển qua UDP (cổng CONFIG_UDPCTL_PORT, unicast, broadcast hoặc multicast)
+ *
+ * Header 8 byte, số nhiều byte theo big-endian:
+ *   0  'S' 'L'     magic
+ *   2  version     UDPCTL_VERSION
+ *   3  op          UDPCTL_OP_*
+ *   4  seq         do client đánh số; gửi lại cùng seq không thực hiện lại lệnh
+ *   6  group       0: mọi thiết bị, ngược lại bitmask nhóm (xem CONFIG_UDPCTL_GROUPS)
+ *
+ * Payload theo op:
+ *   QUERY     (trống)
+ *   SET       mask:2 values:2
+ *   TOGGLE    mask:2
+ *   SCENE     tên scene (không có '\0')
+ *   DISCOVER  (trống)
+ *
+ * Phản hồi: cùng header với op | UDPCTL_ACK, rồi
+ *   status:1 reserved:1 state:2 version:4
+ *   DISCOVER thêm: http_port:2 name_len:1 name
+ */
+
+#define UDPCTL_MAGIC0       'S'
+#define UDPCTL_MAGIC1       'L'
+#define UDPCTL_VERSION      1
+#define UDPCTL_HDR_LEN      8
+
+#define UDPCTL_OP_QUERY     0x01
+#define UDPCTL_OP_SET       0x02
+#define UDPCTL_OP_TOGGLE    0x03
+#define UDPCTL_OP_SCENE     0x04
+#define UDPCTL_OP_DISCOVER  0x05
+#define UDPCTL_ACK          0x80
+
+#define UDPCTL_STATUS_OK        0
+#define UDPCTL_STATUS_BAD       1
+#define UDPCTL_STATUS_NOT_FOUND 2
+
+void udpctl_init(void);
+
+#endif
@@ -0,0 +1,281 @@
+#include <sdkconfig.h>
+#include <string.h>
+#include <errno.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_log.h>
+#include <esp_mac.h>
+#include <esp_netif.h>
+#include <esp_event.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#ifdef CONFIG_UDPCTL_MDNS
+#include <mdns.h>
+#endif
+#include <channel.h>
+#include <scene.h>
+#include <trace.h>
+#include "udpctl.h"
+
+static const char *TAG = "UDPCTL";
+
+// Số client gần nhất được nhớ seq để bỏ qua gói gửi lại
+#define UDPCTL_PEERS        8
+#define UDPCTL_PKT_MAX      64
+
+// Phản hồi gần nhất cho mỗi client, gửi lại nguyên văn khi nhận trùng seq
+typedef struct {
+    uint32_t addr;
+    uint16_t port;
+    uint16_t seq;
+    uint8_t valid;
+    uint8_t ack_len;
+    uint8_t ack[UDPCTL_PKT_MAX];
+} udpctl_peer_t;
+
+static udpctl_peer_t peers[UDPCTL_PEERS];
+static int peer_next;
+static int sock = -1;
+static char hostname[32];
+
+static inline uint16_t get16(const uint8_t *p)
+{
+    return ((uint16_t)p[0] << 8) | p[1];
+}
+
+static inline void put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8;
+    p[1] = v & 0xFF;
+}
+
+static inline void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v >> 16);
+    put16(p + 2, v & 0xFFFF);
+}
+
+static udpctl_peer_t *peer_find(const struct sockaddr_in *from)
+{
+    for (int i = 0; i < UDPCTL_PEERS; i++) {
+        if (peers[i].valid && peers[i].addr == from->sin_addr.s_addr && peers[i].port == from->sin_port) {
+            return &peers[i];
+        }
+    }
+    return NULL;
+}
+
+static udpctl_peer_t *peer_alloc(const struct sockaddr_in *from)
+{
+    // Thay lần lượt (round-robin), đủ cho vài app điều khiển trong LAN
+    udpctl_peer_t *p = &peers[peer_next];
+
+    peer_next = (peer_next + 1) % UDPCTL_PEERS;
+    p->addr = from->sin_addr.s_addr;
+    p->port = from->sin_port;
+    p->valid = 1;
+    return p;
+}
+
+/* Thực hiện lệnh trong pkt và ghi phản hồi vào ack, trả về độ dài phản hồi */
+static int udpctl_execute(const uint8_t *pkt, int len, uint8_t *ack)
+{
+    uint8_t op = pkt[3];
+    const uint8_t *payload = pkt + UDPCTL_HDR_LEN;
+    int plen = len - UDPCTL_HDR_LEN;
+    uint8_t status = UDPCTL_STATUS_OK;
+    uint16_t bits;
+    uint32_t version;
+    int ack_len;
+
+    switch (op) {
+        case UDPCTL_OP_QUERY:
+        case UDPCTL_OP_DISCOVER:
+            break;
+
+        case UDPCTL_OP_SET:
+            if (plen < 4) {
+                status = UDPCTL_STATUS_BAD;
+                break;
+            }
+            channel_set_mask(get16(payload), get16(payload + 2));
+            break;
+
+        case UDPCTL_OP_TOGGLE:
+            if (plen < 2) {
+                status = UDPCTL_STATUS_BAD;
+                break;
+            }
+            // Đảo các kênh trong mask so với trạng thái hiện tại, áp dụng một lần
+            channel_toggle_mask(get16(payload));
+            break;
+
+        case UDPCTL_OP_SCENE: {
+            char name[SCENE_NAME_MAX + 1];
+
+            if (plen <= 0 || plen > SCENE_NAME_MAX) {
+                status = UDPCTL_STATUS_BAD;
+                break;
+            }
+            memcpy(name, payload, plen);
+            name[plen] = '\0';
+            if (scene_apply(name, NULL) != ESP_OK) {
+                status = UDPCTL_STATUS_NOT_FOUND;
+            }
+            break;
+        }
+
+        default:
+            status = UDPCTL_STATUS_BAD;
+            break;
+    }
+
+    bits = channel_snapshot(&version);
+    memcpy(ack, pkt, UDPCTL_HDR_LEN);
+    ack[3] = op | UDPCTL_ACK;
+    ack[8] = status;
+    ack[9] = 0;
+    put16(ack + 10, bits);
+    put32(ack + 12, version);
+    ack_len = 16;
+
+    if (op == UDPCTL_OP_DISCOVER) {
+        size_t n = strlen(hostname);
+
+        put16(ack + ack_len, CONFIG_WEBSERVER_PORT);
+        ack[ack_len + 2] = n;
+        memcpy(ack + ack_len + 3, hostname, n);
+        ack_len += 3 + n;
+    }
+    return ack_len;
+}
+
+static void udpctl_task(void *arg)
+{
+    uint8_t pkt[UDPCTL_PKT_MAX];
+    struct sockaddr_in from;
+    socklen_t from_len;
+    uint32_t groups = CONFIG_UDPCTL_GROUPS;
+
+    while (1) {
+        from_len = sizeof(from);
+        int len = recvfrom(sock, pkt, sizeof(pkt), 0, (struct sockaddr *)&from, &from_len);
+        if (len < UDPCTL_HDR_LEN) {
+            continue;
+        }
+        if (pkt[0] != UDPCTL_MAGIC0 || pkt[1] != UDPCTL_MAGIC1 ||
+            pkt[2] != UDPCTL_VERSION || (pkt[3] & UDPCTL_ACK)) {
+            continue;
+        }
+        // Lệnh nhóm không dành cho thiết bị này: im lặng
+        if (get16(pkt + 6) != 0 && !(get16(pkt + 6) & groups)) {
+            continue;
+        }
+
+        trace_record(TRACE_UDP_CMD, pkt[3]);
+
+        uint16_t seq = get16(pkt + 4);
+        udpctl_peer_t *peer = peer_find(&from);
+
+        if (peer != NULL && peer->seq == seq) {
+            // Gói gửi lại do mất ack: không thực hiện lại (TOGGLE sẽ đảo ngược)
+            sendto(sock, peer->ack, peer->ack_len, 0, (struct sockaddr *)&from, from_len);
+            continue;
+        }
+        if (peer == NULL) {
+            peer = peer_alloc(&from);
+        }
+        peer->seq = seq;
+        peer->ack_len = udpctl_execute(pkt, len, peer->ack);
+        sendto(sock, peer->ack, peer->ack_len, 0, (struct sockaddr *)&from, from_len);
+    }
+}
+
+/* Tham gia nhóm multicast trên interface có địa chỉ ip */
+static void udpctl_join(uint32_t ip)
+{
+    struct ip_mreq mreq = {0};
+
+    inet_aton(CONFIG_UDPCTL_MULTICAST_ADDR, &mreq.imr_multiaddr);
+    mreq.imr_interface.s_addr = ip;
+    // EADDRINUSE: đã tham gia trên interface này (IP đến trước và sau khi đăng ký handler)
+    if (setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0 && errno != EADDRINUSE) {
+        ESP_LOGW(TAG, "Failed to join %s (errno %d)", CONFIG_UDPCTL_MULTICAST_ADDR, errno);
+    }
+}
+
+/* Tham gia lại mỗi khi có địa chỉ IP (kể cả sau khi kết nối lại) */
+static void udpctl_ip_handler(void *arg, esp_event_base_t base, int32_t event_id, void *event_data)
+{
+    ip_event_got_ip_t *event = event_data;
+
+    udpctl_join(event->ip_info.ip.addr);
+}
+
+#ifdef CONFIG_UDPCTL_MDNS
+static void udpctl_mdns_init(void)
+{
+    mdns_txt_item_t txt[] = {
+        { "channels", "16" },
+        { "udp", "1" },
+    };
+
+    if (mdns_init() != ESP_OK) {
+        ESP_LOGE(TAG, "mDNS init failed");
+        return;
+    }
+    mdns_hostname_set(hostname);
+    mdns_instance_name_set("SmartLight");
+    mdns_service_add(NULL, "_http", "_tcp", CONFIG_WEBSERVER_PORT, txt, sizeof(txt) / sizeof(txt[0]));
+    mdns_service_add(NULL, "_smartlight", "_udp", CONFIG_UDPCTL_PORT, txt, sizeof(txt) / sizeof(txt[0]));
+}
+#endif
+
+/// @brief Quảng bá thiết bị qua mDNS và mở cổng điều khiển UDP, gọi sau wifi_init
+void udpctl_init(void)
+{
+    uint8_t mac[6];
+#ifndef CONFIG_IDF_TARGET_LINUX
+    esp_netif_t *netif;
+    esp_netif_ip_info_t ip_info;
+#endif
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(CONFIG_UDPCTL_PORT),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+
+    esp_read_mac(mac, ESP_MAC_WIFI_STA);
+    snprintf(hostname, sizeof(hostname), "%s-%02x%02x%02x", CONFIG_UDPCTL_HOSTNAME, mac[3], mac[4], mac[5]);
+#ifdef CONFIG_UDPCTL_MDNS
+    udpctl_mdns_init();
+#endif
+
+    sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) {
+        ESP_LOGE(TAG, "Failed to create socket");
+        return;
+    }
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        ESP_LOGE(TAG, "Failed to bind port %d", CONFIG_UDPCTL_PORT);
+        close(sock);
+        sock = -1;
+        return;
+    }
+
+    ESP_ERROR_CHECK(esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP, udpctl_ip_handler, NULL));
+    // Wi-Fi có thể đã có IP trước khi đăng ký handler
+#ifdef CONFIG_IDF_TARGET_LINUX
+    // Máy host luôn có mạng: tham gia trên mọi interface
+    udpctl_join(htonl(INADDR_ANY));
+#else
+    netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+    if (netif != NULL && esp_netif_get_ip_info(netif, &ip_info) == ESP_OK && ip_info.ip.addr != 0) {
+        udpctl_join(ip_info.ip.addr);
+    }
+#endif
+    xTaskCreate(udpctl_task, "udpctl", 3072, NULL, CONFIG_UDPCTL_TASK_PRIORITY, NULL);
+    ESP_LOGI(TAG, "%s.local, UDP port %d", hostname, CONFIG_UDPCTL_PORT);
+}
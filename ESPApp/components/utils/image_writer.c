@@ -0,0 +1,196 @@
+#include <string.h>
+#include "image_writer.h"
+
+static void put16le(uint8_t *p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static void put32le(uint8_t *p, uint32_t v) { put16le(p, v); put16le(p + 2, v >> 16); }
+static void put32be(uint8_t *p, uint32_t v) { p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v; }
+
+static void image_emit(image_writer_t *w, const uint8_t *data, size_t len)
+{
+    if (w->error) {
+        return;
+    }
+    if (w->flush == NULL || w->flush(w->ctx, data, len) != 0) {
+        w->error = -1;
+    }
+}
+
+/* CRC-32 của PNG (đa thức 0xEDB88320), bảng 16 phần tử theo từng nửa byte */
+static uint32_t crc32_update(uint32_t crc, const uint8_t *p, size_t n)
+{
+    static const uint32_t nibble[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ nibble[crc & 15];
+        crc = (crc >> 4) ^ nibble[crc & 15];
+    }
+    return ~crc;
+}
+
+static uint32_t adler32_update(uint32_t adler, const uint8_t *p, size_t n)
+{
+    uint32_t a = adler & 0xFFFF, b = adler >> 16;
+
+    // 5552 byte là số lớn nhất mà b chưa tràn 32 bit trước khi lấy modulo
+    while (n > 0) {
+        size_t part = n < 5552 ? n : 5552;
+
+        n -= part;
+        while (part--) {
+            a += *p++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return b << 16 | a;
+}
+
+/* Đóng một chunk PNG đã có dữ liệu tại buf + 8: độ dài, loại và CRC */
+static void png_chunk(image_writer_t *w, uint8_t *buf, const char *type, size_t len)
+{
+    put32be(buf, len);
+    memcpy(buf + 4, type, 4);
+    put32be(buf + 8 + len, crc32_update(0, buf + 4, len + 4));
+    image_emit(w, buf, len + 12);
+}
+
+/// @brief Bắt đầu một ảnh: kiểm tra bộ đệm và ghi phần đầu file
+/// @param w
+/// @param format IMAGE_BMP hoặc IMAGE_PNG
+/// @param width, height kích thước ảnh
+/// @param buf bộ đệm hàng, ít nhất IMAGE_ROW_BUF_SIZE(width) byte
+/// @param flush hàm nhận dữ liệu
+/// @param ctx tham số truyền cho flush
+/// @return 0 nếu thành công
+int image_begin(image_writer_t *w, image_format_t format, uint16_t width, uint16_t height,
+                uint8_t *buf, size_t size, image_flush_t flush, void *ctx)
+{
+    uint8_t head[66];
+
+    memset(w, 0, sizeof(*w));
+    w->format = format;
+    w->width = width;
+    w->height = height;
+    w->buf = buf;
+    w->size = size;
+    w->flush = flush;
+    w->ctx = ctx;
+    w->adler = 1;
+    if (buf == NULL || size < IMAGE_ROW_BUF_SIZE(width) || width == 0 || height == 0) {
+        w->error = -1;
+        return w->error;
+    }
+
+    if (format == IMAGE_BMP) {
+        uint32_t stride = (2 * width + 3) & ~3u;
+
+        // BITMAPFILEHEADER + BITMAPINFOHEADER + 3 mặt nạ RGB565.
+        // Chiều cao âm: hàng trên cùng ghi trước, đúng thứ tự đọc từ màn hình
+        memset(head, 0, sizeof(head));
+        head[0] = 'B';
+        head[1] = 'M';
+        put32le(head + 2, sizeof(head) + stride * height);
+        put32le(head + 10, sizeof(head));
+        put32le(head + 14, 40);
+        put32le(head + 18, width);
+        put32le(head + 22, (uint32_t)-(int32_t)height);
+        put16le(head + 26, 1);
+        put16le(head + 28, 16);
+        put32le(head + 30, 3);
+        put32le(head + 34, stride * height);
+        put32le(head + 54, 0xF800);
+        put32le(head + 58, 0x07E0);
+        put32le(head + 62, 0x001F);
+        image_emit(w, head, sizeof(head));
+    } else {
+        // Chữ ký + IHDR: 8 bit/kênh, RGB, không interlace
+        memcpy(buf, "\x89PNG\r\n\x1a\n", 8);
+        image_emit(w, buf, 8);
+        put32be(buf + 8, width);
+        put32be(buf + 12, height);
+        memcpy(buf + 16, "\x08\x02\x00\x00\x00", 5);
+        png_chunk(w, buf, "IHDR", 13);
+    }
+    return w->error;
+}
+
+/// @brief Ghi hàng tiếp theo (từ trên xuống)
+/// @param w
+/// @param rgb565 width điểm RGB565
+/// @return 0 nếu thành công
+int image_row(image_writer_t *w, const uint16_t *rgb565)
+{
+    uint8_t *p;
+    size_t len;
+    int last;
+
+    if (w->error || w->row >= w->height) {
+        w->error = -1;
+        return w->error;
+    }
+    last = (w->row == w->height - 1);
+
+    if (w->format == IMAGE_BMP) {
+        p = w->buf;
+        for (uint16_t x = 0; x < w->width; x++, p += 2) {
+            put16le(p, rgb565[x]);
+        }
+        while ((p - w->buf) & 3) {
+            *p++ = 0;
+        }
+        image_emit(w, w->buf, p - w->buf);
+        w->row++;
+        return w->error;
+    }
+
+    // Dữ liệu IDAT của hàng: [header zlib] + khối deflate "stored" chứa
+    // byte filter (0) và RGB888 + [Adler-32 ở hàng cuối]
+    p = w->buf + 8;
+    if (w->row == 0) {
+        *p++ = 0x78;
+        *p++ = 0x01;
+    }
+    len = 1 + 3 * (size_t)w->width;
+    *p++ = last;
+    put16le(p, len);
+    put16le(p + 2, ~len);
+    p += 4;
+    *p = 0;
+    for (uint16_t x = 0; x < w->width; x++) {
+        uint16_t c = rgb565[x];
+        uint8_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+
+        p[1 + 3 * x] = (r << 3) | (r >> 2);
+        p[2 + 3 * x] = (g << 2) | (g >> 4);
+        p[3 + 3 * x] = (b << 3) | (b >> 2);
+    }
+    w->adler = adler32_update(w->adler, p, len);
+    p += len;
+    if (last) {
+        put32be(p, w->adler);
+        p += 4;
+    }
+    png_chunk(w, w->buf, "IDAT", p - (w->buf + 8));
+    w->row++;
+    return w->error;
+}
+
+/// @brief Kết thúc ảnh
+/// @param w
+/// @return 0 nếu đã ghi đủ height hàng và mọi lần flush đều thành công
+int image_finish(image_writer_t *w)
+{
+    if (w->row != w->height) {
+        w->error = -1;
+    }
+    if (w->format == IMAGE_PNG) {
+        png_chunk(w, w->buf, "IEND", 0);
+    }
+    return w->error;
+}
@@ -0,0 +1,38 @@
+#ifndef __IMAGE_WRITER_H__
+#define __IMAGE_WRITER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Hàm nhận dữ liệu của từng hàng (và phần đầu/cuối file), trả về 0 nếu thành công
+typedef int (*image_flush_t)(void *ctx, const uint8_t *data, size_t len);
+
+typedef enum {
+    IMAGE_BMP,              // RGB565 giữ nguyên (BI_BITFIELDS), so sánh được từng điểm
+    IMAGE_PNG,              // RGB888, deflate không nén: mỗi hàng là một chunk IDAT
+} image_format_t;
+
+// Kích thước bộ đệm hàng cần cho ảnh rộng width điểm (đủ cho cả hai định dạng)
+#define IMAGE_ROW_BUF_SIZE(width)   (3 * (width) + 32)
+
+// Bộ ghi ảnh dạng stream: nhận từng hàng RGB565, mã hoá vào bộ đệm của người
+// gọi rồi đẩy ra qua flush ngay, nên bộ nhớ chỉ tốn một hàng. Không cấp phát heap.
+typedef struct {
+    image_format_t format;
+    uint16_t width;
+    uint16_t height;
+    uint16_t row;           // số hàng đã ghi
+    uint8_t *buf;
+    size_t size;
+    uint32_t adler;         // Adler-32 của dữ liệu zlib (PNG)
+    image_flush_t flush;
+    void *ctx;
+    int error;              // khác 0 khi flush lỗi hoặc ghi sai số hàng; mọi lệnh ghi sau đó bị bỏ qua
+} image_writer_t;
+
+int image_begin(image_writer_t *w, image_format_t format, uint16_t width, uint16_t height,
+                uint8_t *buf, size_t size, image_flush_t flush, void *ctx);
+int image_row(image_writer_t *w, const uint16_t *rgb565);
+int image_finish(image_writer_t *w);
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef __JSON_WRITER_H__
+#define __JSON_WRITER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// Độ sâu lồng nhau tối đa của object/array
+#define JSON_MAX_DEPTH      16
+
+// Hàm nhận dữ liệu mỗi khi bộ đệm đầy (hoặc khi kết thúc), trả về 0 nếu thành công
+typedef int (*json_flush_t)(void *ctx, const char *data, size_t len);
+
+// Bộ ghi JSON dạng stream: ghi vào bộ đệm do người gọi cấp (thường trên stack),
+// đẩy ra qua flush khi đầy. Không cấp phát heap.
+typedef struct {
+    char *buf;
+    size_t size;
+    size_t len;             // số byte đang nằm trong buf
+    size_t flushed;         // tổng số byte đã đẩy ra qua flush
+    json_flush_t flush;
+    void *ctx;
+    uint32_t has_item;      // bit d: đã có phần tử ở độ sâu d (cần dấu phẩy)
+    uint8_t depth;
+    uint8_t after_key;      // vừa ghi key, giá trị tiếp theo không cần dấu phẩy
+    int error;              // khác 0 khi flush lỗi hoặc cấu trúc sai; mọi lệnh ghi sau đó bị bỏ qua
+} json_writer_t;
+
+void json_init(json_writer_t *w, char *buf, size_t size, json_flush_t flush, void *ctx);
+int json_finish(json_writer_t *w);
+
+void json_obj_begin(json_writer_t *w);
+void json_obj_end(json_writer_t *w);
+void json_arr_begin(json_writer_t *w);
+void json_arr_end(json_writer_t *w);
+
+void json_key(json_writer_t *w, const char *key);
+void json_str(json_writer_t *w, const char *s);
+void json_strn(json_writer_t *w, const char *s, size_t n);
+void json_int(json_writer_t *w, int64_t v);
+void json_uint(json_writer_t *w, uint64_t v);
+void json_bool(json_writer_t *w, bool v);
+void json_null(json_writer_t *w);
+void json_raw(json_writer_t *w, const char *s, size_t n);
+
+// Ghi cặp "key": value trong một object
+static inline void json_kv_str(json_writer_t *w, const char *k, const char *v)  { json_key(w, k); json_str(w, v); }
+static inline void json_kv_int(json_writer_t *w, const char *k, int64_t v)      { json_key(w, k); json_int(w, v); }
+static inline void json_kv_uint(json_writer_t *w, const char *k, uint64_t v)    { json_key(w, k); json_uint(w, v); }
+static inline void json_kv_bool(json_writer_t *w, const char *k, bool v)        { json_key(w, k); json_bool(w, v); }
+
+#endif
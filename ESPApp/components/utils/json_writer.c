@@ -0,0 +1,227 @@
+#include <string.h>
+#include "json_writer.h"
+
+static void json_flush(json_writer_t *w)
+{
+    if (w->len == 0 || w->error) {
+        return;
+    }
+    if (w->flush == NULL || w->flush(w->ctx, w->buf, w->len) != 0) {
+        w->error = -1;
+        return;
+    }
+    w->flushed += w->len;
+    w->len = 0;
+}
+
+static void json_put(json_writer_t *w, const char *s, size_t n)
+{
+    while (n > 0 && !w->error) {
+        size_t room = w->size - w->len;
+        size_t part = n < room ? n : room;
+
+        memcpy(w->buf + w->len, s, part);
+        w->len += part;
+        s += part;
+        n -= part;
+        if (w->len == w->size) {
+            json_flush(w);
+        }
+    }
+}
+
+static inline void json_putc(json_writer_t *w, char c)
+{
+    if (w->error) {
+        return;
+    }
+    w->buf[w->len++] = c;
+    if (w->len == w->size) {
+        json_flush(w);
+    }
+}
+
+/* Ghi dấu phẩy trước một giá trị nếu cần */
+static void json_sep(json_writer_t *w)
+{
+    uint32_t bit = 1u << w->depth;
+
+    if (w->after_key) {
+        w->after_key = 0;
+        return;
+    }
+    if (w->has_item & bit) {
+        json_putc(w, ',');
+    }
+    w->has_item |= bit;
+}
+
+static void json_escaped(json_writer_t *w, const char *s, size_t n)
+{
+    static const char hex[] = "0123456789abcdef";
+    const char *run = s;
+
+    json_putc(w, '"');
+    for (size_t i = 0; i < n; i++) {
+        unsigned char c = s[i];
+        char esc[6];
+        size_t esc_len = 2;
+
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        // Ghi đoạn không cần escape trong một lần
+        json_put(w, run, s + i - run);
+        run = s + i + 1;
+
+        esc[0] = '\\';
+        switch (c) {
+            case '"':  esc[1] = '"';  break;
+            case '\\': esc[1] = '\\'; break;
+            case '\n': esc[1] = 'n';  break;
+            case '\r': esc[1] = 'r';  break;
+            case '\t': esc[1] = 't';  break;
+            default:
+                esc[1] = 'u';
+                esc[2] = '0';
+                esc[3] = '0';
+                esc[4] = hex[c >> 4];
+                esc[5] = hex[c & 0xF];
+                esc_len = 6;
+                break;
+        }
+        json_put(w, esc, esc_len);
+    }
+    json_put(w, run, s + n - run);
+    json_putc(w, '"');
+}
+
+static void json_open(json_writer_t *w, char c)
+{
+    json_sep(w);
+    if (w->depth + 1 >= JSON_MAX_DEPTH) {
+        w->error = -1;
+        return;
+    }
+    json_putc(w, c);
+    w->depth++;
+    w->has_item &= ~(1u << w->depth);
+}
+
+static void json_close(json_writer_t *w, char c)
+{
+    if (w->depth == 0 || w->after_key) {
+        w->error = -1;
+        return;
+    }
+    w->depth--;
+    json_putc(w, c);
+}
+
+/// @brief Khởi tạo bộ ghi
+/// @param w 
+/// @param buf bộ đệm tạm, kích thước càng lớn thì càng ít lần gọi flush
+/// @param size kích thước buf (>= 1)
+/// @param flush hàm nhận dữ liệu khi buf đầy và khi json_finish
+/// @param ctx tham số truyền cho flush
+void json_init(json_writer_t *w, char *buf, size_t size, json_flush_t flush, void *ctx)
+{
+    memset(w, 0, sizeof(*w));
+    w->buf = buf;
+    w->size = size;
+    w->flush = flush;
+    w->ctx = ctx;
+    if (buf == NULL || size == 0) {
+        w->error = -1;
+    }
+}
+
+/// @brief Đẩy phần còn lại trong bộ đệm ra flush
+/// @param w 
+/// @return 0 nếu toàn bộ tài liệu đã ghi thành công và đã đóng hết object/array
+int json_finish(json_writer_t *w)
+{
+    json_flush(w);
+    if (w->depth != 0 || w->after_key) {
+        w->error = -1;
+    }
+    return w->error;
+}
+
+void json_obj_begin(json_writer_t *w) { json_open(w, '{'); }
+void json_obj_end(json_writer_t *w)   { json_close(w, '}'); }
+void json_arr_begin(json_writer_t *w) { json_open(w, '['); }
+void json_arr_end(json_writer_t *w)   { json_close(w, ']'); }
+
+void json_key(json_writer_t *w, const char *key)
+{
+    // Hai key liền nhau sẽ thành "a":"b": (JSON sai)
+    if (w->after_key) {
+        w->error = -1;
+        return;
+    }
+    json_sep(w);
+    json_escaped(w, key, strlen(key));
+    json_putc(w, ':');
+    w->after_key = 1;
+}
+
+void json_str(json_writer_t *w, const char *s)
+{
+    if (s == NULL) {
+        json_null(w);
+        return;
+    }
+    json_strn(w, s, strlen(s));
+}
+
+void json_strn(json_writer_t *w, const char *s, size_t n)
+{
+    json_sep(w);
+    json_escaped(w, s, n);
+}
+
+void json_uint(json_writer_t *w, uint64_t v)
+{
+    char digits[20];
+    size_t n = sizeof(digits);
+
+    json_sep(w);
+    do {
+        digits[--n] = '0' + (v % 10);
+        v /= 10;
+    } while (v != 0);
+    json_put(w, digits + n, sizeof(digits) - n);
+}
+
+void json_int(json_writer_t *w, int64_t v)
+{
+    if (v >= 0) {
+        json_uint(w, (uint64_t)v);
+        return;
+    }
+    // Ghi dấu trừ rồi phần trị tuyệt đối (không tràn với INT64_MIN)
+    json_sep(w);
+    json_putc(w, '-');
+    w->after_key = 1;
+    json_uint(w, (uint64_t)0 - (uint64_t)v);
+}
+
+void json_bool(json_writer_t *w, bool v)
+{
+    json_sep(w);
+    json_put(w, v ? "true" : "false", v ? 4 : 5);
+}
+
+void json_null(json_writer_t *w)
+{
+    json_sep(w);
+    json_put(w, "null", 4);
+}
+
+/// @brief Ghi một giá trị JSON đã được định dạng sẵn (không kiểm tra)
+void json_raw(json_writer_t *w, const char *s, size_t n)
+{
+    json_sep(w);
+    json_put(w, s, n);
+}
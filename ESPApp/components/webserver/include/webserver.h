@@ -5,6 +5,7 @@
 #include <esp_event.h>
 #include <esp_http_server.h>
 #include <nvs_flash.h>
+#include <sdkconfig.h>
 
 #define WIFI_SSID "minhhchienn and friends"
 #define WIFI_PASS "71846584"
@@ -13,8 +14,30 @@
 #define WIFI_DISCONNECTED    1
 #define WIFI_CONNECTING      2
 
+#define WEBSERVER_MAX_URI_HANDLERS  32
+
+// Nơi mount SPIFFS; bản build Linux đọc thẳng thư mục trên máy host
+#ifdef CONFIG_IDF_TARGET_LINUX
+#define SPIFFS_BASE_PATH    CONFIG_HOST_SPIFFS_DIR
+#else
+#define SPIFFS_BASE_PATH    "/spiffs"
+#endif
+
+// Thống kê kết nối của web server
+typedef struct {
+    uint32_t active;        // kết nối đang mở
+    uint32_t peak;          // số kết nối mở đồng thời lớn nhất
+    uint32_t opened;        // tổng số kết nối đã nhận
+    uint32_t closed;        // tổng số kết nối đã đóng (kể cả LRU purge)
+    uint32_t requests;      // tổng số request đã xử lý
+    uint32_t async_jobs;    // request đã chuyển sang worker
+    uint32_t async_rejected;// request bị trả 503 vì hàng đợi worker đầy
+} webserver_stats_t;
+
 void wifi_init(void);
 
 void webserver_init(void);
 
+void webserver_get_stats(webserver_stats_t *out);
+
 #endif // __WEBSERVER_H__
\ No newline at end of file
@@ -1,10 +1,124 @@
+#include <sdkconfig.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
 #include <esp_log.h>
+#include <esp_timer.h>
+#include <esp_random.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
 #include <webserver.h>
+#include <channel.h>
+#include <scene.h>
+#include <scheduler.h>
+#include <energy.h>
+#include <json_writer.h>
+#include <image_writer.h>
+#include <lcd_shadow.h>
+#include <mirror.h>
+#include <metrics.h>
+#include <trace.h>
+#ifdef CONFIG_IDF_TARGET_LINUX
+#include <host.h>
+#endif
+#include <ctype.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
 
-extern volatile int led1_state;
-extern volatile int led2_state;
+// Kích thước lớn nhất của body PUT /state, PUT /scene và POST /schedule
+#define STATE_BODY_MAX      256
 
-extern void Toggle_Led(uint8_t led);
+// Bộ đệm JSON trên stack của handler; phản hồi lớn hơn được gửi thành nhiều chunk
+#define JSON_CHUNK_SIZE     256
+
+// Thông tin từng kết nối đang mở, chỉ được truy cập từ task của httpd
+typedef struct {
+    int fd;                             // -1: ô trống
+    uint32_t requests;
+    int64_t opened_us;
+    char ip[INET6_ADDRSTRLEN];
+} conn_info_t;
+
+static conn_info_t conns[CONFIG_WEBSERVER_MAX_SOCKETS];
+static webserver_stats_t stats;
+
+static httpd_handle_t server_handle = NULL;
+
+// Ghi phản hồi cho một ảnh chụp trạng thái (bits, version) của các kênh
+typedef esp_err_t (*state_reply_t)(httpd_req_t *req, uint16_t bits, uint32_t version);
+
+// Request long-poll đang chờ trạng thái đổi khác version
+typedef struct {
+    httpd_req_t *req;                   // bản sao async, NULL: ô trống
+    state_reply_t reply;
+    uint32_t version;
+    int64_t deadline_us;
+} longpoll_t;
+
+static longpoll_t longpolls[CONFIG_WEBSERVER_LONGPOLL_MAX > 0 ? CONFIG_WEBSERVER_LONGPOLL_MAX : 1];
+static volatile uint32_t longpoll_count;
+static volatile uint32_t longpoll_queued;
+static esp_timer_handle_t longpoll_timer;
+
+// Ngẫu nhiên mỗi lần khởi động để ETag cũ không trùng sau khi reset
+static uint32_t boot_id;
+
+// Request chậm (SPIFFS, ghi NVS) được chuyển sang worker để task httpd
+// tiếp tục trả lời các endpoint trạng thái
+typedef struct route route_t;
+
+typedef struct {
+    httpd_req_t *req;                   // bản sao async
+    route_t *route;
+    int64_t start_us;                   // lúc nhận request, để đo cả thời gian chờ worker
+} async_job_t;
+
+// Một endpoint: handler thật, chạy trên task httpd hay trên worker, và số liệu của nó
+struct route {
+    const char *uri;
+    const char *name;
+    uint8_t index;                      // vị trí trong bảng routes, ghi vào trace
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t *req);
+    bool async;
+    bool websocket;                     // handler nhận cả bắt tay và các frame (chạy trên task httpd)
+    metric_t requests;
+    metric_t latency;
+};
+
+static QueueHandle_t async_queue;
+
+// Sự kiện Wi-Fi, đếm để biết thiết bị có rớt mạng thường xuyên không
+static metric_t wifi_connected_metric = METRIC_COUNTER_INIT("smartlight_wifi_events_total", "event=\"connected\"",
+                                                            "Wi-Fi events");
+static metric_t wifi_disconnected_metric = METRIC_COUNTER_INIT("smartlight_wifi_events_total", "event=\"disconnected\"",
+                                                               "Wi-Fi events");
+static metric_t wifi_got_ip_metric = METRIC_COUNTER_INIT("smartlight_wifi_events_total", "event=\"got_ip\"",
+                                                         "Wi-Fi events");
+static metric_t wifi_rssi_metric = METRIC_GAUGE_INIT("smartlight_wifi_rssi_dbm", NULL, "RSSI of the current AP");
+
+static void wifi_event_handler(void *arg, esp_event_base_t base, int32_t event_id, void *event_data)
+{
+    if (base == WIFI_EVENT && event_id == WIFI_EVENT_STA_CONNECTED) {
+        metric_inc(&wifi_connected_metric);
+    } else if (base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
+        metric_inc(&wifi_disconnected_metric);
+        // Tự kết nối lại
+        esp_wifi_connect();
+    } else if (base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
+        metric_inc(&wifi_got_ip_metric);
+    }
+}
+
+static void wifi_collect(void)
+{
+    wifi_ap_record_t ap;
+
+    metric_set(&wifi_rssi_metric, esp_wifi_sta_get_ap_info(&ap) == ESP_OK ? ap.rssi : 0);
+}
 
 void wifi_init(void)
 {
@@ -29,6 +143,14 @@ void wifi_init(void)
         },
     };
 
+    metrics_register(&wifi_connected_metric);
+    metrics_register(&wifi_disconnected_metric);
+    metrics_register(&wifi_got_ip_metric);
+    metrics_register(&wifi_rssi_metric);
+    metrics_add_collector(wifi_collect);
+    ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, ESP_EVENT_ANY_ID, wifi_event_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP, wifi_event_handler, NULL));
+
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
     ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config));
     ESP_ERROR_CHECK(esp_wifi_start());
@@ -37,9 +159,207 @@ void wifi_init(void)
     ESP_ERROR_CHECK(esp_wifi_connect());
 }
 
-esp_err_t serve_index_html(httpd_req_t *req) {
-    // Mở tệp "index.html" từ SPIFFS
-    const char *path = "/spiffs/index.html";
+static conn_info_t *conn_find(int fd)
+{
+    for (int i = 0; i < CONFIG_WEBSERVER_MAX_SOCKETS; i++) {
+        if (conns[i].fd == fd) {
+            return &conns[i];
+        }
+    }
+    return NULL;
+}
+
+/* Gọi khi httpd nhận một kết nối mới */
+static esp_err_t conn_open(httpd_handle_t hd, int sockfd)
+{
+    conn_info_t *c = conn_find(-1);
+    struct sockaddr_storage addr;
+    socklen_t len = sizeof(addr);
+
+    stats.opened++;
+    stats.active++;
+    if (stats.active > stats.peak) {
+        stats.peak = stats.active;
+    }
+
+    if (c != NULL) {
+        c->fd = sockfd;
+        c->requests = 0;
+        c->opened_us = esp_timer_get_time();
+        c->ip[0] = '\0';
+        if (getpeername(sockfd, (struct sockaddr *)&addr, &len) == 0) {
+            if (addr.ss_family == AF_INET) {
+                inet_ntop(AF_INET, &((struct sockaddr_in *)&addr)->sin_addr, c->ip, sizeof(c->ip));
+            } else {
+                inet_ntop(AF_INET6, &((struct sockaddr_in6 *)&addr)->sin6_addr, c->ip, sizeof(c->ip));
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+/* Gọi khi kết nối bị đóng (client đóng, timeout hoặc bị LRU purge) */
+static void conn_close(httpd_handle_t hd, int sockfd)
+{
+    conn_info_t *c = conn_find(sockfd);
+
+    stats.closed++;
+    if (stats.active > 0) {
+        stats.active--;
+    }
+    if (c != NULL) {
+        c->fd = -1;
+    }
+    mirror_client_closed(sockfd);
+    close(sockfd);
+}
+
+/* Đếm một request cho kết nối của req */
+static void conn_account(httpd_req_t *req)
+{
+    conn_info_t *c = conn_find(httpd_req_to_sockfd(req));
+
+    stats.requests++;
+    if (c != NULL) {
+        c->requests++;
+    }
+}
+
+/* Worker: chạy handler chậm trên bản sao async của request */
+static void async_worker_task(void *arg)
+{
+    async_job_t job;
+
+    while (1) {
+        xQueueReceive(async_queue, &job, portMAX_DELAY);
+        job.route->handler(job.req);
+        httpd_req_async_handler_complete(job.req);
+        trace_record(TRACE_HTTP_END, job.route->index);
+        metric_observe(&job.route->latency, esp_timer_get_time() - job.start_us);
+    }
+}
+
+/* Handler đăng ký cho các URI nhanh: chạy ngay trên task httpd */
+static esp_err_t route_inline(httpd_req_t *req)
+{
+    route_t *route = req->user_ctx;
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret;
+
+    conn_account(req);
+    metric_inc(&route->requests);
+    trace_record(TRACE_HTTP_BEGIN, route->index);
+    ret = route->handler(req);
+    trace_record(TRACE_HTTP_END, route->index);
+    metric_observe(&route->latency, esp_timer_get_time() - start);
+    return ret;
+}
+
+/* Handler đăng ký cho các URI chậm: chuyển sang worker.
+ * Hàng đợi đầy thì trả 503 ngay thay vì chặn task httpd */
+static esp_err_t route_async(httpd_req_t *req)
+{
+    async_job_t job = { .route = req->user_ctx, .start_us = esp_timer_get_time() };
+
+    conn_account(req);
+    metric_inc(&job.route->requests);
+    trace_record(TRACE_HTTP_BEGIN, job.route->index);
+
+    if (uxQueueSpacesAvailable(async_queue) == 0) {
+        stats.async_rejected++;
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        return httpd_resp_send(req, "Busy", HTTPD_RESP_USE_STRLEN);
+    }
+    if (httpd_req_async_handler_begin(req, &job.req) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Async failed");
+        return ESP_FAIL;
+    }
+    // Chỉ task httpd gửi vào hàng đợi nên chỗ trống vừa kiểm tra vẫn còn
+    xQueueSend(async_queue, &job, 0);
+    stats.async_jobs++;
+    return ESP_OK;
+}
+
+void webserver_get_stats(webserver_stats_t *out)
+{
+    *out = stats;
+}
+
+static int json_send_chunk(void *ctx, const char *data, size_t len)
+{
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, data, len) == ESP_OK ? 0 : -1;
+}
+
+/* Bắt đầu một phản hồi JSON, buf thường là mảng JSON_CHUNK_SIZE trên stack */
+static void json_resp_begin(json_writer_t *w, char *buf, size_t size, httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "application/json");
+    json_init(w, buf, size, json_send_chunk, req);
+}
+
+/* Kết thúc phản hồi JSON. Nếu cả tài liệu nằm gọn trong bộ đệm thì gửi một lần
+ * kèm Content-Length, ngược lại gửi phần còn lại rồi chunk kết thúc */
+static esp_err_t json_resp_end(json_writer_t *w, httpd_req_t *req)
+{
+    if (w->flushed == 0 && w->error == 0 && w->depth == 0) {
+        return httpd_resp_send(req, w->buf, w->len);
+    }
+    if (json_finish(w) != 0) {
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/stats": thống kê kết nối */
+esp_err_t stats_get_handler(httpd_req_t *req)
+{
+    char buf[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    int64_t now = esp_timer_get_time();
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+
+    json_obj_begin(&w);
+    json_key(&w, "connections");
+    json_obj_begin(&w);
+    json_kv_uint(&w, "active", stats.active);
+    json_kv_uint(&w, "peak", stats.peak);
+    json_kv_uint(&w, "opened", stats.opened);
+    json_kv_uint(&w, "closed", stats.closed);
+    json_kv_int(&w, "max", CONFIG_WEBSERVER_MAX_SOCKETS);
+    json_obj_end(&w);
+    json_kv_uint(&w, "requests", stats.requests);
+    json_kv_uint(&w, "longpolls", longpoll_count);
+    json_key(&w, "async");
+    json_obj_begin(&w);
+    json_kv_uint(&w, "jobs", stats.async_jobs);
+    json_kv_uint(&w, "rejected", stats.async_rejected);
+    json_kv_uint(&w, "queued", uxQueueMessagesWaiting(async_queue));
+    json_kv_int(&w, "workers", CONFIG_WEBSERVER_ASYNC_WORKERS);
+    json_obj_end(&w);
+
+    json_key(&w, "clients");
+    json_arr_begin(&w);
+    for (int i = 0; i < CONFIG_WEBSERVER_MAX_SOCKETS; i++) {
+        if (conns[i].fd < 0) {
+            continue;
+        }
+        json_obj_begin(&w);
+        json_kv_int(&w, "fd", conns[i].fd);
+        json_kv_str(&w, "ip", conns[i].ip);
+        json_kv_uint(&w, "requests", conns[i].requests);
+        json_kv_int(&w, "age_ms", (now - conns[i].opened_us) / 1000);
+        json_obj_end(&w);
+    }
+    json_arr_end(&w);
+    json_obj_end(&w);
+
+    return json_resp_end(&w, req);
+}
+
+/* Gửi một tệp trong SPIFFS về máy khách theo từng khối 1 KB */
+static esp_err_t serve_file(httpd_req_t *req, const char *path) {
     FILE *file = fopen(path, "r");
     if (file == NULL) {
         // Xử lý lỗi khi mở tệp
@@ -47,7 +367,7 @@ esp_err_t serve_index_html(httpd_req_t *req) {
         return ESP_FAIL;
     }
 
-    // Gửi nội dung của tệp "index.html" về máy khách
+    // Gửi nội dung của tệp về máy khách
     char buffer[1024];
     size_t read_bytes;
     do {
@@ -65,89 +385,974 @@ esp_err_t serve_index_html(httpd_req_t *req) {
     return ESP_OK;
 }
 
+esp_err_t serve_index_html(httpd_req_t *req) {
+    return serve_file(req, SPIFFS_BASE_PATH "/index.html");
+}
+
+/* Trang xem màn hình LCD trực tiếp, nhận dữ liệu qua WebSocket "/mirror/ws" */
+esp_err_t serve_mirror_html(httpd_req_t *req) {
+    return serve_file(req, SPIFFS_BASE_PATH "/mirror.html");
+}
+
+/* Đặt ETag theo phiên bản trạng thái; etag phải còn sống tới khi gửi phản hồi */
+static void set_etag(httpd_req_t *req, char *etag, size_t size, uint32_t version)
+{
+    snprintf(etag, size, "\"%08lx-%lu\"", (unsigned long)boot_id, (unsigned long)version);
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+}
+
+static esp_err_t send_not_modified(httpd_req_t *req)
+{
+    httpd_resp_set_status(req, "304 Not Modified");
+    return httpd_resp_send(req, NULL, 0);
+}
+
+/* Trả lời các long-poll đã có trạng thái mới hoặc đã hết hạn.
+ * Chạy trên task của httpd (httpd_queue_work) nên không cần khoá */
+static void longpoll_work(void *arg)
+{
+    char etag[24];
+    uint32_t version;
+    uint16_t bits;
+    int64_t now = esp_timer_get_time();
+    int pending = 0;
+
+    __atomic_store_n(&longpoll_queued, 0, __ATOMIC_SEQ_CST);
+    bits = channel_snapshot(&version);
+
+    for (int i = 0; i < CONFIG_WEBSERVER_LONGPOLL_MAX; i++) {
+        longpoll_t *lp = &longpolls[i];
+
+        if (lp->req == NULL) {
+            continue;
+        }
+        if (lp->version != version) {
+            set_etag(lp->req, etag, sizeof(etag), version);
+            lp->reply(lp->req, bits, version);
+        } else if (now >= lp->deadline_us) {
+            set_etag(lp->req, etag, sizeof(etag), version);
+            send_not_modified(lp->req);
+        } else {
+            pending++;
+            continue;
+        }
+        httpd_req_async_handler_complete(lp->req);
+        lp->req = NULL;
+        longpoll_count--;
+    }
+
+    if (pending == 0) {
+        esp_timer_stop(longpoll_timer);
+    }
+}
+
+/* Yêu cầu task httpd xử lý các long-poll; nhiều lần gọi liên tiếp chỉ tạo một work */
+static void longpoll_kick(void)
+{
+    if (longpoll_count == 0 || server_handle == NULL) {
+        return;
+    }
+    if (__atomic_exchange_n(&longpoll_queued, 1, __ATOMIC_SEQ_CST) == 0) {
+        if (httpd_queue_work(server_handle, longpoll_work, NULL) != ESP_OK) {
+            __atomic_store_n(&longpoll_queued, 0, __ATOMIC_SEQ_CST);
+        }
+    }
+}
+
+// Listener của channel: chạy trong task đã đổi trạng thái
+static void longpoll_on_change(uint8_t ch, int state)
+{
+    longpoll_kick();
+}
+
+// Timer 1 s kiểm tra các long-poll hết hạn
+static void longpoll_tick(void *arg)
+{
+    longpoll_kick();
+}
+
+/* Tách request khỏi task httpd và giữ lại tới khi version thay đổi hoặc hết timeout_s */
+static esp_err_t longpoll_park(httpd_req_t *req, state_reply_t reply, uint32_t version, int timeout_s)
+{
+    longpoll_t *lp = NULL;
+    httpd_req_t *copy;
+
+    for (int i = 0; i < CONFIG_WEBSERVER_LONGPOLL_MAX; i++) {
+        if (longpolls[i].req == NULL) {
+            lp = &longpolls[i];
+            break;
+        }
+    }
+    if (lp == NULL || httpd_req_async_handler_begin(req, &copy) != ESP_OK) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    lp->req = copy;
+    lp->reply = reply;
+    lp->version = version;
+    lp->deadline_us = esp_timer_get_time() + (int64_t)timeout_s * 1000000;
+    longpoll_count++;
+
+    if (!esp_timer_is_active(longpoll_timer)) {
+        esp_timer_start_periodic(longpoll_timer, 1000000);
+    }
+    return ESP_OK;
+}
+
+/* GET có điều kiện cho "/led" và "/state":
+ *   ?wait=<version>[&timeout=<s>]  chờ tới khi phiên bản khác <version>
+ *   If-None-Match: <etag>          trả 304 nếu trạng thái chưa đổi */
+static esp_err_t conditional_get(httpd_req_t *req, state_reply_t reply)
+{
+    char query[48];
+    char value[12];
+    char etag[24];
+    char match[32];
+    uint32_t version;
+    uint16_t bits = channel_snapshot(&version);
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "wait", value, sizeof(value)) == ESP_OK &&
+        strtoul(value, NULL, 10) == version) {
+        int timeout = CONFIG_WEBSERVER_LONGPOLL_TIMEOUT;
+
+        if (httpd_query_key_value(query, "timeout", value, sizeof(value)) == ESP_OK) {
+            timeout = atoi(value);
+        }
+        if (timeout > CONFIG_WEBSERVER_LONGPOLL_TIMEOUT_MAX) {
+            timeout = CONFIG_WEBSERVER_LONGPOLL_TIMEOUT_MAX;
+        }
+        // Hết chỗ chờ thì trả lời ngay như một GET thường
+        if (timeout > 0 && longpoll_park(req, reply, version, timeout) == ESP_OK) {
+            return ESP_OK;
+        }
+    }
+
+    set_etag(req, etag, sizeof(etag), version);
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", match, sizeof(match)) == ESP_OK &&
+        strcmp(match, etag) == 0) {
+        return send_not_modified(req);
+    }
+    return reply(req, bits, version);
+}
+
+static esp_err_t reply_led(httpd_req_t *req, uint16_t bits, uint32_t version)
+{
+    char buf[JSON_CHUNK_SIZE];
+    json_writer_t w;
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_obj_begin(&w);
+    json_kv_bool(&w, "led1", bits & 1);
+    json_kv_bool(&w, "led2", (bits >> 1) & 1);
+    json_kv_uint(&w, "version", version);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+
 /* Xử lý yêu cầu GET cho endpoint "/led" */
 esp_err_t led_get_handler(httpd_req_t *req)
 {
-    char response_data[40];
-    snprintf(response_data, sizeof(response_data), "{\"led1\": %s, \"led2\": %s}", 
-             led1_state ? "true" : "false", led2_state ? "true" : "false");
+    return conditional_get(req, reply_led);
+}
 
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, response_data, strlen(response_data));
-    return ESP_OK;
+/* Đảo trạng thái một kênh và gửi trạng thái mới dưới dạng {"<key>": bool} */
+static esp_err_t toggle_and_reply(httpd_req_t *req, uint8_t ch, const char *key)
+{
+    char buf[JSON_CHUNK_SIZE];
+    json_writer_t w;
+    // Trạng thái sau khi đảo, lấy trong cùng lần khoá: một yêu cầu khác
+    // đảo kênh ngay sau đó không làm phản hồi sai
+    uint16_t values = channel_toggle_mask(1u << ch);
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_obj_begin(&w);
+    json_kv_bool(&w, key, values & (1u << ch));
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
 }
 
 /* Xử lý yêu cầu POST cho endpoint "/toggle-led1" */
 esp_err_t toggle_led1_post_handler(httpd_req_t *req)
 {
     // Đảo trạng thái của Relay 1
-    Toggle_Led(1);
+    return toggle_and_reply(req, 0, "led1");
+}
 
-    // Gửi trạng thái mới của Relay 1 dưới dạng JSON
-    char response_data[20];
-    snprintf(response_data, sizeof(response_data), "{\"led1\": %s}", led1_state ? "true" : "false");
+/* Xử lý yêu cầu POST cho endpoint "/toggle-led2" */
+esp_err_t toggle_led2_post_handler(httpd_req_t *req)
+{
+    // Đảo trạng thái của Relay 2
+    return toggle_and_reply(req, 1, "led2");
+}
 
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, response_data, strlen(response_data));
+/* Đọc toàn bộ body của request vào buf (kết thúc bằng '\0')
+ * Trả về độ dài, -1 nếu lỗi hoặc body quá lớn. Khi lỗi đã gửi 400, handler chỉ
+ * cần trả về ESP_OK như mọi lỗi 4xx khác */
+static int recv_body(httpd_req_t *req, char *buf, size_t size)
+{
+    size_t got = 0;
+
+    if (req->content_len >= size) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Body too large");
+        return -1;
+    }
+    while (got < req->content_len) {
+        int n = httpd_req_recv(req, buf + got, req->content_len - got);
+        if (n == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (n <= 0) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Failed to read body");
+            return -1;
+        }
+        got += n;
+    }
+    buf[got] = '\0';
+    return got;
+}
+
+static const char *skip_ws(const char *p)
+{
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    return p;
+}
+
+static esp_err_t write_state(httpd_req_t *req, uint16_t bits, uint32_t version, uint16_t changed)
+{
+    char buf[JSON_CHUNK_SIZE];
+    json_writer_t w;
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_obj_begin(&w);
+    json_kv_uint(&w, "state", bits);
+    json_kv_uint(&w, "changed", changed);
+    json_kv_uint(&w, "version", version);
+    json_key(&w, "channels");
+    json_arr_begin(&w);
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        json_uint(&w, (bits >> i) & 1);
+    }
+    json_arr_end(&w);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+
+static esp_err_t reply_state(httpd_req_t *req, uint16_t bits, uint32_t version)
+{
+    return write_state(req, bits, version, 0);
+}
+
+/* Gửi trạng thái hiện tại của tất cả các kênh */
+static esp_err_t send_state(httpd_req_t *req, uint16_t changed)
+{
+    char etag[24];
+    uint32_t version;
+    uint16_t bits = channel_snapshot(&version);
+
+    set_etag(req, etag, sizeof(etag), version);
+    return write_state(req, bits, version, changed);
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/state" */
+esp_err_t state_get_handler(httpd_req_t *req)
+{
+    return conditional_get(req, reply_state);
+}
+
+/* Xử lý yêu cầu PUT cho endpoint "/state": đặt nhiều kênh trong một bước.
+ * Gửi lại cùng một body không đổi gì (idempotent), khác với /toggle-led* */
+esp_err_t state_put_handler(httpd_req_t *req)
+{
+    char body[STATE_BODY_MAX];
+    uint16_t mask, values;
+
+    if (recv_body(req, body, sizeof(body)) < 0) {
+        return ESP_OK;
+    }
+    if (channel_parse_state(body, &mask, &values) != 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid state");
+        return ESP_OK;
+    }
+    return send_state(req, channel_set_mask(mask, values));
+}
+
+/* Lấy tham số name=... của các endpoint "/scene" */
+static int scene_name_from_query(httpd_req_t *req, char *name, size_t size)
+{
+    char query[64];
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "name", name, size) != ESP_OK ||
+        !scene_name_valid(name)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid scene name");
+        return -1;
+    }
+    return 0;
+}
+
+static void json_scene(json_writer_t *w, const char *name, uint16_t mask, uint16_t values)
+{
+    json_obj_begin(w);
+    json_kv_str(w, "name", name);
+    json_kv_uint(w, "mask", mask);
+    json_kv_uint(w, "state", values);
+    json_obj_end(w);
+}
+
+static void scene_list_visit(const char *name, uint16_t mask, uint16_t values, void *ctx)
+{
+    json_scene((json_writer_t *)ctx, name, mask, values);
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/scenes": liệt kê các scene đã lưu */
+esp_err_t scenes_get_handler(httpd_req_t *req)
+{
+    char buf[JSON_CHUNK_SIZE];
+    json_writer_t w;
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_arr_begin(&w);
+    scene_foreach(scene_list_visit, &w);
+    json_arr_end(&w);
+    return json_resp_end(&w, req);
+}
+
+/* Xử lý yêu cầu PUT cho endpoint "/scene?name=...": lưu scene.
+ * Body giống PUT /state; body rỗng lưu trạng thái hiện tại của cả 16 kênh */
+esp_err_t scene_put_handler(httpd_req_t *req)
+{
+    char name[SCENE_NAME_MAX + 1];
+    char body[STATE_BODY_MAX];
+    uint16_t mask, values;
+
+    if (scene_name_from_query(req, name, sizeof(name)) != 0 ||
+        recv_body(req, body, sizeof(body)) < 0) {
+        return ESP_OK;
+    }
+    if (*skip_ws(body) == '\0') {
+        mask = 0xFFFF;
+        values = channel_get_mask();
+    } else if (channel_parse_state(body, &mask, &values) != 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid state");
+        return ESP_OK;
+    }
+    if (scene_save(name, mask, values) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save scene");
+        return ESP_OK;
+    }
+
+    json_writer_t w;
+
+    // Dùng lại bộ đệm body (đã phân tích xong) cho phản hồi
+    json_resp_begin(&w, body, sizeof(body), req);
+    json_scene(&w, name, mask, values);
+    return json_resp_end(&w, req);
+}
+
+/* Xử lý yêu cầu POST cho endpoint "/scene?name=...": áp dụng scene */
+esp_err_t scene_post_handler(httpd_req_t *req)
+{
+    char name[SCENE_NAME_MAX + 1];
+    uint16_t changed;
+    esp_err_t err;
+
+    if (scene_name_from_query(req, name, sizeof(name)) != 0) {
+        return ESP_OK;
+    }
+    err = scene_apply(name, &changed);
+    if (err == ESP_ERR_NOT_FOUND) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No such scene");
+        return ESP_OK;
+    }
+    if (err != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to read scene");
+        return ESP_OK;
+    }
+    return send_state(req, changed);
+}
+
+/* Xử lý yêu cầu DELETE cho endpoint "/scene?name=..." */
+esp_err_t scene_delete_handler(httpd_req_t *req)
+{
+    char name[SCENE_NAME_MAX + 1];
+    esp_err_t err;
+
+    if (scene_name_from_query(req, name, sizeof(name)) != 0) {
+        return ESP_OK;
+    }
+    err = scene_delete(name);
+    if (err == ESP_ERR_NOT_FOUND) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No such scene");
+        return ESP_OK;
+    }
+    if (err != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to delete scene");
+        return ESP_OK;
+    }
+    httpd_resp_set_status(req, "204 No Content");
+    httpd_resp_send(req, NULL, 0);
     return ESP_OK;
 }
 
-/* Xử lý yêu cầu POST cho endpoint "/toggle-led2" */
-esp_err_t toggle_led2_post_handler(httpd_req_t *req)
+static const char *const sched_kind_names[] = {
+    [SCHED_ONCE] = "once",
+    [SCHED_WEEKLY] = "weekly",
+    [SCHED_AUTO_OFF] = "auto_off",
+};
+
+static void json_schedule(json_writer_t *w, const sched_info_t *info)
 {
-    // Đảo trạng thái của Relay 1
-    Toggle_Led(2);
+    json_obj_begin(w);
+    json_kv_uint(w, "id", info->id);
+    json_kv_str(w, "kind", sched_kind_names[info->kind]);
+    json_kv_uint(w, "mask", info->mask);
+    json_kv_uint(w, "state", info->values);
+    if (info->kind == SCHED_WEEKLY) {
+        char at[6];
 
-    // Gửi trạng thái mới của Relay 1 dưới dạng JSON
-    char response_data[20];
-    snprintf(response_data, sizeof(response_data), "{\"led2\": %s}", led1_state ? "true" : "false");
+        snprintf(at, sizeof(at), "%02u:%02u", info->minute / 60, info->minute % 60);
+        json_kv_uint(w, "days", info->days);
+        json_kv_str(w, "at", at);
+    }
+    // -1: lịch tuần đang chờ SNTP
+    json_kv_int(w, "in", info->in_s);
+    json_obj_end(w);
+}
 
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, response_data, strlen(response_data));
+static void schedule_list_visit(const sched_info_t *info, void *ctx)
+{
+    json_schedule((json_writer_t *)ctx, info);
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/schedules": hẹn giờ, lịch tuần và thời gian tự tắt */
+esp_err_t schedules_get_handler(httpd_req_t *req)
+{
+    char buf[JSON_CHUNK_SIZE];
+    json_writer_t w;
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_obj_begin(&w);
+    json_kv_bool(&w, "time_valid", scheduler_time_valid());
+    json_kv_uint(&w, "now", (uint32_t)time(NULL));
+    json_key(&w, "auto_off");
+    json_arr_begin(&w);
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        json_uint(&w, scheduler_get_auto_off(i));
+    }
+    json_arr_end(&w);
+    json_key(&w, "actions");
+    json_arr_begin(&w);
+    scheduler_foreach(schedule_list_visit, &w);
+    json_arr_end(&w);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+
+/* Xử lý yêu cầu POST cho endpoint "/schedule", body giống PUT /state:
+ *   ?in=1800                   chạy một lần sau 1800 giây
+ *   ?days=62&at=07:30          lặp lại, bit 0 = Chủ nhật ... bit 6 = Thứ bảy, giờ địa phương */
+esp_err_t schedule_post_handler(httpd_req_t *req)
+{
+    char query[48];
+    char value[8];
+    char body[STATE_BODY_MAX];
+    uint16_t mask, values, id;
+    unsigned hour, minute;
+    esp_err_t err;
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+        query[0] = '\0';
+    }
+    if (recv_body(req, body, sizeof(body)) < 0) {
+        return ESP_OK;
+    }
+    if (channel_parse_state(body, &mask, &values) != 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid state");
+        return ESP_OK;
+    }
+
+    if (httpd_query_key_value(query, "in", value, sizeof(value)) == ESP_OK) {
+        err = scheduler_add_once(strtoul(value, NULL, 10), mask, values, &id);
+    } else if (httpd_query_key_value(query, "at", value, sizeof(value)) == ESP_OK &&
+               sscanf(value, "%u:%u", &hour, &minute) == 2 && hour < 24 && minute < 60) {
+        uint8_t days = 0x7F;
+
+        if (httpd_query_key_value(query, "days", value, sizeof(value)) == ESP_OK) {
+            days = strtoul(value, NULL, 0);
+        }
+        err = scheduler_add_weekly(days, hour * 60 + minute, mask, values, &id);
+    } else {
+        err = ESP_ERR_INVALID_ARG;
+    }
+
+    if (err == ESP_ERR_NO_MEM) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Too many schedules");
+        return ESP_OK;
+    }
+    if (err != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Use ?in=<seconds> or ?at=HH:MM[&days=<mask>]");
+        return ESP_OK;
+    }
+
+    json_writer_t w;
+
+    httpd_resp_set_status(req, "201 Created");
+    json_resp_begin(&w, body, sizeof(body), req);
+    json_obj_begin(&w);
+    json_kv_uint(&w, "id", id);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+
+/* Xử lý yêu cầu DELETE cho endpoint "/schedule?id=..." */
+esp_err_t schedule_delete_handler(httpd_req_t *req)
+{
+    char query[16];
+    char value[8];
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "id", value, sizeof(value)) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing id");
+        return ESP_OK;
+    }
+    if (scheduler_cancel(strtoul(value, NULL, 10)) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No such schedule");
+        return ESP_OK;
+    }
+    httpd_resp_set_status(req, "204 No Content");
+    httpd_resp_send(req, NULL, 0);
     return ESP_OK;
 }
 
+/* Xử lý yêu cầu PUT cho endpoint "/auto-off?ch=0&seconds=1800": kênh tự tắt
+ * sau khi bật; seconds=0 để bỏ */
+esp_err_t auto_off_put_handler(httpd_req_t *req)
+{
+    char query[32];
+    char value[12];
+    char buf[64];
+    unsigned long ch, seconds;
+    json_writer_t w;
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "ch", value, sizeof(value)) != ESP_OK ||
+        (ch = strtoul(value, NULL, 10)) >= CHANNEL_COUNT ||
+        httpd_query_key_value(query, "seconds", value, sizeof(value)) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Use ?ch=<n>&seconds=<s>");
+        return ESP_OK;
+    }
+    seconds = strtoul(value, NULL, 10);
+    if (scheduler_set_auto_off(ch, seconds) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save auto-off");
+        return ESP_OK;
+    }
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_obj_begin(&w);
+    json_kv_uint(&w, "ch", ch);
+    json_kv_uint(&w, "seconds", seconds);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+/* Chỉ bản build Linux: "POST /host/press?gpio=0&ms=100" nhấn giả lập một nút
+ * active low, để kiểm thử tải đi qua button.c như trên board */
+esp_err_t host_press_post_handler(httpd_req_t *req)
+{
+    char query[32];
+    char value[12];
+    char buf[64];
+    unsigned long gpio, ms = 100;
+    json_writer_t w;
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "gpio", value, sizeof(value)) != ESP_OK ||
+        (gpio = strtoul(value, NULL, 10)) >= GPIO_NUM_MAX) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Use ?gpio=<n>[&ms=<hold>]");
+        return ESP_OK;
+    }
+    if (httpd_query_key_value(query, "ms", value, sizeof(value)) == ESP_OK) {
+        ms = strtoul(value, NULL, 10);
+    }
+    if (ms > 10000) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "ms must be at most 10000");
+        return ESP_OK;
+    }
+    host_gpio_press((gpio_num_t)gpio, ms);
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_obj_begin(&w);
+    json_kv_uint(&w, "gpio", gpio);
+    json_kv_uint(&w, "ms", ms);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+#endif
+
+static int metrics_send_chunk(void *ctx, const char *data, size_t len)
+{
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, data, len) == ESP_OK ? 0 : -1;
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/metrics": định dạng text của Prometheus */
+esp_err_t metrics_get_handler(httpd_req_t *req)
+{
+    char buf[512];
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    if (metrics_export(buf, sizeof(buf), metrics_send_chunk, req) != 0) {
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static void routes_json(json_writer_t *w);
+
+static void trace_json_visit(const trace_event_t *e, void *ctx)
+{
+    json_writer_t *w = ctx;
+
+    json_arr_begin(w);
+    json_uint(w, e->seq);
+    json_uint(w, e->ts_us);
+    json_str(w, trace_event_name(e->event));
+    json_uint(w, e->arg);
+    json_uint(w, e->core);
+    json_arr_end(w);
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/trace": nội dung ring sự kiện.
+ * ?serial=1 in thêm ra serial. Chuyển sang Chrome trace bằng utils/trace2chrome.py */
+esp_err_t trace_get_handler(httpd_req_t *req)
+{
+    char buf[JSON_CHUNK_SIZE];
+    char query[16];
+    char value[4];
+    json_writer_t w;
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "serial", value, sizeof(value)) == ESP_OK && value[0] == '1') {
+        trace_dump_serial();
+    }
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_obj_begin(&w);
+    json_kv_uint(&w, "now_us", (uint32_t)esp_timer_get_time());
+    json_key(&w, "routes");
+    routes_json(&w);
+    // Mỗi sự kiện: [seq, ts_us, event, arg, core]
+    json_key(&w, "events");
+    json_arr_begin(&w);
+    trace_foreach(trace_json_visit, &w);
+    json_arr_end(&w);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+
+static int image_send_chunk(void *ctx, const uint8_t *data, size_t len)
+{
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, (const char *)data, len) == ESP_OK ? 0 : -1;
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/screenshot": nội dung màn hình, BMP RGB565
+ * (mặc định, đúng từng điểm) hoặc PNG với ?format=png. Đọc từng hàng từ bản sao
+ * màn hình của lcd và gửi ngay, nên chỉ tốn bộ nhớ một hàng */
+esp_err_t screenshot_get_handler(httpd_req_t *req)
+{
+    uint16_t row[LCD_SHADOW_ROW_PIXELS];
+    uint8_t buf[IMAGE_ROW_BUF_SIZE(LCD_SHADOW_ROW_PIXELS)];
+    image_format_t format = IMAGE_BMP;
+    image_writer_t w;
+    uint16_t width, height;
+    char query[16];
+    char value[4];
+
+    if (LCD_SHADOW_Size(&width, &height) != 0) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Screenshots disabled (LCD_SHADOW)");
+        return ESP_OK;
+    }
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "format", value, sizeof(value)) == ESP_OK) {
+        if (strcmp(value, "png") == 0) {
+            format = IMAGE_PNG;
+        } else if (strcmp(value, "bmp") != 0) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "format must be bmp or png");
+            return ESP_OK;
+        }
+    }
+
+    httpd_resp_set_type(req, format == IMAGE_PNG ? "image/png" : "image/bmp");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    image_begin(&w, format, width, height, buf, sizeof(buf), image_send_chunk, req);
+    for (uint16_t y = 0; y < height && w.error == 0; y++) {
+        LCD_SHADOW_Row(y, row);
+        image_row(&w, row);
+    }
+    if (image_finish(&w) != 0) {
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/energy": thời gian bật (giây) và điện năng
+ * (Wh, theo công suất danh định) tích luỹ của từng kênh */
+esp_err_t energy_get_handler(httpd_req_t *req)
+{
+    char buf[JSON_CHUNK_SIZE];
+    energy_channel_t e;
+    json_writer_t w;
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    json_obj_begin(&w);
+    json_kv_bool(&w, "time_valid", scheduler_time_valid());
+    json_key(&w, "channels");
+    json_arr_begin(&w);
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        energy_get(i, &e);
+        json_obj_begin(&w);
+        json_kv_bool(&w, "on", e.on);
+        json_kv_uint(&w, "on_s", e.on_s);
+        json_kv_uint(&w, "today_s", e.today_s);
+        json_kv_uint(&w, "watts", e.watts);
+        json_kv_uint(&w, "wh", e.on_s * e.watts / 3600);
+        json_obj_end(&w);
+    }
+    json_arr_end(&w);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+
+typedef struct {
+    json_writer_t *w;
+    uint16_t mask;
+} energy_series_ctx_t;
+
+static void energy_series_visit(uint32_t start, const uint32_t on_s[CHANNEL_COUNT], void *ctx)
+{
+    energy_series_ctx_t *c = ctx;
+
+    json_arr_begin(c->w);
+    json_uint(c->w, start);
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        if (c->mask & (1u << i)) {
+            json_uint(c->w, on_s[i]);
+        }
+    }
+    json_arr_end(c->w);
+}
+
+/* Xử lý yêu cầu GET cho endpoint "/energy/series": số giây bật theo bucket,
+ * mỗi phần tử [epoch đầu bucket, giây của từng kênh được chọn]:
+ *   ?step=minute|hour|day      độ dài bucket (mặc định hour)
+ *   &from=<epoch>&to=<epoch>   khoảng đầu bucket (mặc định tất cả)
+ *   &ch=0x3                    các kênh (mặc định tất cả)
+ * Bucket cuối của hour/day là giờ/ngày đang chạy */
+esp_err_t energy_series_get_handler(httpd_req_t *req)
+{
+    static const char *const step_names[] = { "minute", "hour", "day" };
+    static const uint32_t step_seconds[] = { 60, 3600, 86400 };
+    char buf[JSON_CHUNK_SIZE];
+    char query[96];
+    char value[16];
+    energy_series_ctx_t ctx = { .mask = 0xFFFF };
+    energy_step_t step = ENERGY_HOUR;
+    uint32_t from = 0, to = UINT32_MAX;
+    json_writer_t w;
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+        query[0] = '\0';
+    }
+    if (httpd_query_key_value(query, "step", value, sizeof(value)) == ESP_OK) {
+        for (step = ENERGY_MINUTE; step <= ENERGY_DAY; step++) {
+            if (strcmp(value, step_names[step]) == 0) {
+                break;
+            }
+        }
+        if (step > ENERGY_DAY) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "step must be minute, hour or day");
+            return ESP_OK;
+        }
+    }
+    if (httpd_query_key_value(query, "from", value, sizeof(value)) == ESP_OK) {
+        from = strtoul(value, NULL, 10);
+    }
+    if (httpd_query_key_value(query, "to", value, sizeof(value)) == ESP_OK) {
+        to = strtoul(value, NULL, 10);
+    }
+    if (httpd_query_key_value(query, "ch", value, sizeof(value)) == ESP_OK) {
+        ctx.mask = strtoul(value, NULL, 0);
+    }
+
+    json_resp_begin(&w, buf, sizeof(buf), req);
+    ctx.w = &w;
+    json_obj_begin(&w);
+    json_kv_str(&w, "step", step_names[step]);
+    json_kv_uint(&w, "seconds", step_seconds[step]);
+    json_key(&w, "channels");
+    json_arr_begin(&w);
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        if (ctx.mask & (1u << i)) {
+            json_int(&w, i);
+        }
+    }
+    json_arr_end(&w);
+    json_key(&w, "series");
+    json_arr_begin(&w);
+    energy_series(step, from, to, energy_series_visit, &ctx);
+    json_arr_end(&w);
+    json_obj_end(&w);
+    return json_resp_end(&w, req);
+}
+
+// Gauge lấy mẫu từ thống kê của server mỗi lần Prometheus đọc
+static metric_t conn_active_metric = METRIC_GAUGE_INIT("smartlight_http_connections", NULL, "Open HTTP connections");
+static metric_t conn_opened_metric = METRIC_COUNTER_INIT("smartlight_http_connections_opened_total", NULL,
+                                                         "Accepted HTTP connections");
+static metric_t longpoll_metric = METRIC_GAUGE_INIT("smartlight_http_longpolls", NULL, "Parked long-poll requests");
+static metric_t async_queue_metric = METRIC_GAUGE_INIT("smartlight_http_async_queued", NULL,
+                                                       "Slow requests waiting for a worker");
+
+static void webserver_collect(void)
+{
+    metric_set(&conn_active_metric, stats.active);
+    metric_set(&conn_opened_metric, stats.opened);
+    metric_set(&longpoll_metric, longpoll_count);
+    metric_set(&async_queue_metric, uxQueueMessagesWaiting(async_queue));
+}
+
+#define ROUTE_FIELDS(u, m, h, a, n) \
+    .uri = (u), .name = (n), .method = (m), .handler = (h), .async = (a), \
+    .requests = METRIC_COUNTER_INIT("smartlight_http_requests_total", "handler=\"" n "\"", "HTTP requests"), \
+    .latency = METRIC_LATENCY_INIT("smartlight_http_request_duration_seconds", "handler=\"" n "\"", \
+                                   "HTTP handler latency, including time queued for a worker")
+#define ROUTE(u, m, h, a, n)    { ROUTE_FIELDS(u, m, h, a, n) }
+// WebSocket: mỗi frame nhận được tính là một request
+#define WS_ROUTE(u, h, n)       { ROUTE_FIELDS(u, HTTP_GET, h, false, n), .websocket = true }
+
+// Các endpoint; async = true cho handler chậm (SPIFFS, ghi NVS, in serial, phản hồi
+// nhiều chunk) để task httpd chỉ còn các handler ngắn như /led và toggle
+static route_t routes[] = {
+    ROUTE("/",            HTTP_GET,    serve_index_html,         true,  "index"),
+    ROUTE("/led",         HTTP_GET,    led_get_handler,          false, "led"),
+    ROUTE("/toggle-led1", HTTP_POST,   toggle_led1_post_handler, false, "toggle_led1"),
+    ROUTE("/toggle-led2", HTTP_POST,   toggle_led2_post_handler, false, "toggle_led2"),
+    ROUTE("/stats",       HTTP_GET,    stats_get_handler,        false, "stats"),
+    ROUTE("/metrics",     HTTP_GET,    metrics_get_handler,      true,  "metrics"),
+    ROUTE("/trace",       HTTP_GET,    trace_get_handler,        true,  "trace"),
+    ROUTE("/screenshot",  HTTP_GET,    screenshot_get_handler,   true,  "screenshot"),
+    ROUTE("/mirror",      HTTP_GET,    serve_mirror_html,        true,  "mirror"),
+    WS_ROUTE("/mirror/ws",             mirror_ws_handler,               "mirror_ws"),
+    ROUTE("/state",       HTTP_GET,    state_get_handler,        false, "state_get"),
+    ROUTE("/state",       HTTP_PUT,    state_put_handler,        false, "state_put"),
+    ROUTE("/scenes",      HTTP_GET,    scenes_get_handler,       true,  "scenes"),
+    ROUTE("/scene",       HTTP_PUT,    scene_put_handler,        true,  "scene_put"),
+    ROUTE("/scene",       HTTP_POST,   scene_post_handler,       false, "scene_apply"),
+    ROUTE("/scene",       HTTP_DELETE, scene_delete_handler,     true,  "scene_delete"),
+    ROUTE("/schedules",   HTTP_GET,    schedules_get_handler,    true,  "schedules"),
+    ROUTE("/schedule",    HTTP_POST,   schedule_post_handler,    true,  "schedule_add"),
+    ROUTE("/schedule",    HTTP_DELETE, schedule_delete_handler,  true,  "schedule_delete"),
+    ROUTE("/auto-off",    HTTP_PUT,    auto_off_put_handler,     true,  "auto_off"),
+    ROUTE("/energy",      HTTP_GET,    energy_get_handler,       true,  "energy"),
+    ROUTE("/energy/series", HTTP_GET,  energy_series_get_handler, true, "energy_series"),
+#ifdef CONFIG_IDF_TARGET_LINUX
+    // Giữ nút trong lúc xử lý: chạy trên worker
+    ROUTE("/host/press",  HTTP_POST,   host_press_post_handler,  true,  "host_press"),
+#endif
+};
+
+// Tên các endpoint theo thứ tự index, để đọc arg của HTTP_BEGIN/HTTP_END trong trace
+static void routes_json(json_writer_t *w)
+{
+    json_arr_begin(w);
+    for (size_t i = 0; i < sizeof(routes) / sizeof(routes[0]); i++) {
+        json_str(w, routes[i].name);
+    }
+    json_arr_end(w);
+}
+
 void webserver_init(void){
     httpd_handle_t server = NULL;
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
 
+    // Cấu hình server theo Kconfig (menu "SmartLight web server")
+    config.server_port = CONFIG_WEBSERVER_PORT;
+    config.max_open_sockets = CONFIG_WEBSERVER_MAX_SOCKETS;
+#ifdef CONFIG_WEBSERVER_LRU_PURGE
+    config.lru_purge_enable = true;
+#endif
+    config.backlog_conn = CONFIG_WEBSERVER_BACKLOG;
+    config.stack_size = CONFIG_WEBSERVER_STACK_SIZE;
+    config.task_priority = CONFIG_WEBSERVER_TASK_PRIORITY;
+    config.core_id = CONFIG_WEBSERVER_CORE < 0 ? tskNO_AFFINITY : CONFIG_WEBSERVER_CORE;
+    config.recv_wait_timeout = CONFIG_WEBSERVER_RECV_TIMEOUT;
+    config.send_wait_timeout = CONFIG_WEBSERVER_SEND_TIMEOUT;
+    config.max_uri_handlers = WEBSERVER_MAX_URI_HANDLERS;
+#ifdef CONFIG_WEBSERVER_KEEP_ALIVE
+    config.keep_alive_enable = true;
+    config.keep_alive_idle = CONFIG_WEBSERVER_KEEP_ALIVE_IDLE;
+    config.keep_alive_interval = CONFIG_WEBSERVER_KEEP_ALIVE_INTERVAL;
+    config.keep_alive_count = CONFIG_WEBSERVER_KEEP_ALIVE_COUNT;
+#endif
+
+    // Theo dõi từng kết nối để báo cáo ở "/stats"
+    for (int i = 0; i < CONFIG_WEBSERVER_MAX_SOCKETS; i++) {
+        conns[i].fd = -1;
+    }
+    config.open_fn = conn_open;
+    config.close_fn = conn_close;
+
+    // Worker cho các handler chậm (xem route_async)
+    async_queue = xQueueCreate(CONFIG_WEBSERVER_ASYNC_QUEUE, sizeof(async_job_t));
+    for (int i = 0; i < CONFIG_WEBSERVER_ASYNC_WORKERS; i++) {
+        xTaskCreatePinnedToCore(async_worker_task, "httpd_async", CONFIG_WEBSERVER_ASYNC_STACK_SIZE, NULL,
+                                CONFIG_WEBSERVER_TASK_PRIORITY - 1, NULL, config.core_id);
+    }
+
     // Khởi tạo và bắt đầu web server
     ESP_ERROR_CHECK(httpd_start(&server, &config));
+    server_handle = server;
 
-    /* Đăng ký xử lý yêu cầu GET cho tệp "index.html" */
-    httpd_uri_t index_html = {
-        .uri = "/",
-        .method = HTTP_GET,
-        .handler = serve_index_html,
-        .user_ctx = NULL
+    // Long-poll: được đánh thức khi kênh đổi trạng thái hoặc theo timer để hết hạn
+    boot_id = esp_random();
+    const esp_timer_create_args_t longpoll_timer_args = {
+        .callback = longpoll_tick,
+        .name = "longpoll"
     };
+    ESP_ERROR_CHECK(esp_timer_create(&longpoll_timer_args, &longpoll_timer));
+    channel_add_listener(longpoll_on_change);
 
-    // Đăng ký xử lý yêu cầu GET cho endpoint "/led1"
-    httpd_uri_t led_uri = {
-        .uri = "/led",
-        .method = HTTP_GET,
-        .handler = led_get_handler,
-        .user_ctx = NULL
-    };
-    httpd_register_uri_handler(server, &led_uri);
-
-    /* Đăng ký xử lý yêu cầu POST cho các endpoint */
-        httpd_uri_t toggle_relay1_uri = {
-            .uri = "/toggle-led1",
-            .method = HTTP_POST,
-            .handler = toggle_led1_post_handler,
-            .user_ctx = NULL
+    // Đăng ký các endpoint trong bảng routes
+    for (size_t i = 0; i < sizeof(routes) / sizeof(routes[0]); i++) {
+        httpd_uri_t uri = {
+            .uri = routes[i].uri,
+            .method = routes[i].method,
+            .handler = routes[i].async ? route_async : route_inline,
+            .user_ctx = &routes[i],
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+            .is_websocket = routes[i].websocket,
+            // Handler WebSocket tự trả ping/close: chỉ nó biết lúc nào socket rảnh
+            .handle_ws_control_frames = routes[i].websocket,
+#endif
         };
-        httpd_register_uri_handler(server, &toggle_relay1_uri);
-
-        httpd_uri_t toggle_relay2_uri = {
-            .uri = "/toggle-led2",
-            .method = HTTP_POST,
-            .handler = toggle_led2_post_handler,
-            .user_ctx = NULL
-        };
-        httpd_register_uri_handler(server, &toggle_relay2_uri);
-
-    
-    httpd_register_uri_handler(server, &index_html);
+        routes[i].index = i;
+#ifndef CONFIG_HTTPD_WS_SUPPORT
+        // Bản build không có WebSocket: bỏ các endpoint cần nó
+        if (routes[i].websocket) {
+            continue;
+        }
+#endif
+        httpd_register_uri_handler(server, &uri);
+        metrics_register(&routes[i].requests);
+        metrics_register(&routes[i].latency);
+    }
+    metrics_register(&conn_active_metric);
+    metrics_register(&conn_opened_metric);
+    metrics_register(&longpoll_metric);
+    metrics_register(&async_queue_metric);
+    metrics_add_collector(webserver_collect);
 }
\ No newline at end of file
@@ -0,0 +1,241 @@
+/* Sinh bởi utils/sprite2c.py, không sửa tay:
+ *   python sprite2c.py ../assets/icons/bulb_off.png ../assets/icons/bulb_on.png ../assets/icons/wifi_0.png ../assets/icons/wifi_1.png ../assets/icons/wifi_2.png ../assets/icons/wifi_3.png -o ../main/icons
+ */
+#include "icons.h"
+
+static const uint8_t bulb_off_runs[] = {
+	0x02, 0x81, 0x41, 0x81, 0xC0, 0x00, 0x89, 0xC0, 0x00, 0x82, 0x03, 0x82, 0xC0, 0x80, 0x40, 0x80,
+	0x05, 0x80, 0x40, 0x80, 0xC0, 0x81, 0x07, 0x81, 0xC0, 0x81, 0x07, 0x81, 0xC0, 0x81, 0x07, 0x81,
+	0xC0, 0x80, 0x40, 0x80, 0x05, 0x80, 0x40, 0x80, 0xC0, 0x00, 0x82, 0x03, 0x82, 0xC0, 0x00, 0x89,
+	0xC0, 0x02, 0x80, 0x43, 0x80, 0xC0, 0x02, 0x80, 0x43, 0x80, 0xC0, 0x02, 0x81, 0x41, 0x81, 0xC0,
+	0x03, 0x83, 0xC0,
+};
+static const uint16_t bulb_off_pixels[] = {
+	0x2965, 0x630C, 0x7BCF, 0x7BCF, 0x630C, 0x2965, 0x0020, 0x5ACB, 0x738E, 0x39E7, 0x18E3, 0x18E3,
+	0x39E7, 0x738E, 0x5ACB, 0x0020, 0x4208, 0x630C, 0x0020, 0x0020, 0x630C, 0x4208, 0x0861, 0x7BCF,
+	0x18E3, 0x18E3, 0x7BCF, 0x0861, 0x31A6, 0x630C, 0x630C, 0x31A6, 0x39E7, 0x5ACB, 0x5ACB, 0x39E7,
+	0x31A6, 0x630C, 0x630C, 0x31A6, 0x0861, 0x7BCF, 0x18E3, 0x18E3, 0x7BCF, 0x0861, 0x4208, 0x630C,
+	0x0020, 0x0020, 0x630C, 0x4208, 0x0020, 0x5ACB, 0x738E, 0x39E7, 0x18E3, 0x18E3, 0x39E7, 0x738E,
+	0x5ACB, 0x0020, 0x4A49, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x4A49, 0x39E7, 0x7BCF, 0x7BCF, 0x7BCF,
+	0x7BCF, 0x39E7, 0x18E3, 0x5ACB, 0x7BCF, 0x7BCF, 0x5ACB, 0x18E3, 0x18E3, 0x39E7, 0x39E7, 0x18E3,
+};
+static const uint8_t bulb_off_alpha[] = {
+	 95, 207, 207,  95,  15, 191, 239, 127,  63,  63, 127, 239, 191,  15, 143, 207,
+	 15,  15, 207, 143,  31,  63,  63,  31, 111, 207, 207, 111, 127, 191, 191, 127,
+	111, 207, 207, 111,  31,  63,  63,  31, 143, 207,  15,  15, 207, 143,  15, 191,
+	239, 127,  63,  63, 127, 239, 191,  15, 159, 159, 127, 127,  63, 191, 191,  63,
+	 63, 127, 127,  63,
+};
+
+const sprite_t icon_bulb_off = {
+	.width = 16, .height = 16,
+	.x = 2, .y = 1, .w = 12, .h = 14,
+	.runs = bulb_off_runs, .pixels = bulb_off_pixels, .alpha = bulb_off_alpha,
+	.opaque = 16, .blended = 68,
+};
+
+static const uint8_t bulb_on_runs[] = {
+	0x02, 0x81, 0x41, 0x81, 0xC0, 0x00, 0x81, 0x45, 0x81, 0xC0, 0x00, 0x80, 0x47, 0x80, 0xC0, 0x80,
+	0x49, 0x80, 0xC0, 0x80, 0x49, 0x80, 0xC0, 0x80, 0x49, 0x80, 0xC0, 0x80, 0x49, 0x80, 0xC0, 0x80,
+	0x49, 0x80, 0xC0, 0x00, 0x80, 0x47, 0x80, 0xC0, 0x00, 0x81, 0x45, 0x81, 0xC0, 0x02, 0x80, 0x43,
+	0x80, 0xC0, 0x02, 0x80, 0x43, 0x80, 0xC0, 0x02, 0x81, 0x41, 0x81, 0xC0, 0x03, 0x83, 0xC0,
+};
+static const uint16_t bulb_on_pixels[] = {
+	0x5A63, 0xCD66, 0xFEA8, 0xFEA8, 0xCD66, 0x5A63, 0x0860, 0xBCE6, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8,
+	0xFEA8, 0xFEA8, 0xBCE6, 0x0860, 0x8BA4, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8,
+	0xFEA8, 0x8BA4, 0x18C1, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8,
+	0xFEA8, 0x18C1, 0x6AE3, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8,
+	0xFEA8, 0x6AE3, 0x7B44, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8,
+	0xFEA8, 0x7B44, 0x6AE3, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8,
+	0xFEA8, 0x6AE3, 0x18C1, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8,
+	0xFEA8, 0x18C1, 0x8BA4, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0x8BA4,
+	0x0860, 0xBCE6, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xFEA8, 0xBCE6, 0x0860, 0x83A7, 0xEE4A,
+	0xFEA8, 0xFEA8, 0xEE4A, 0x83A7, 0x4A89, 0x9D13, 0x9D13, 0x9D13, 0x9D13, 0x4A89, 0x2144, 0x73CE,
+	0x9D13, 0x9D13, 0x73CE, 0x2144, 0x2144, 0x4A89, 0x4A89, 0x2144,
+};
+static const uint8_t bulb_on_alpha[] = {
+	 95, 207, 207,  95,  15, 191, 191,  15, 143, 143,  31,  31, 111, 111, 127, 127,
+	111, 111,  31,  31, 143, 143,  15, 191, 191,  15, 159, 159, 127, 127,  63, 191,
+	191,  63,  63, 127, 127,  63,
+};
+
+const sprite_t icon_bulb_on = {
+	.width = 16, .height = 16,
+	.x = 2, .y = 1, .w = 12, .h = 14,
+	.runs = bulb_on_runs, .pixels = bulb_on_pixels, .alpha = bulb_on_alpha,
+	.opaque = 90, .blended = 38,
+};
+
+static const uint8_t wifi_0_runs[] = {
+	0x01, 0x82, 0x45, 0x82, 0xC0, 0x81, 0x4B, 0x81, 0xC0, 0x80, 0x42, 0x87, 0x42, 0x80, 0xC0, 0x41,
+	0x81, 0x01, 0x83, 0x01, 0x81, 0x41, 0xC0, 0x81, 0x00, 0x82, 0x43, 0x82, 0x00, 0x81, 0xC0, 0x82,
+	0x49, 0x82, 0xC0, 0x00, 0x80, 0x41, 0x87, 0x41, 0x80, 0xC0, 0x00, 0x80, 0x40, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x40, 0x80, 0xC0, 0x01, 0x80, 0x00, 0x81, 0x43, 0x81, 0x00, 0x80, 0xC0, 0x02, 0x81,
+	0x45, 0x81, 0xC0, 0x03, 0x87, 0xC0, 0x04, 0x80, 0x03, 0x80, 0xC0, 0x05, 0x83, 0xC0, 0x05, 0x80,
+	0x41, 0x80, 0xC0, 0x05, 0x80, 0x41, 0x80, 0xC0, 0x05, 0x83, 0xC0,
+};
+static const uint16_t wifi_0_pixels[] = {
+	0x0841, 0x2124, 0x4208, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x4208, 0x2124, 0x0841,
+	0x0841, 0x31A6, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
+	0x5ACB, 0x5ACB, 0x31A6, 0x0841, 0x528A, 0x5ACB, 0x5ACB, 0x5ACB, 0x39E7, 0x2965, 0x10A2, 0x10A2,
+	0x10A2, 0x10A2, 0x2965, 0x39E7, 0x5ACB, 0x5ACB, 0x5ACB, 0x528A, 0x5ACB, 0x5ACB, 0x3186, 0x0841,
+	0x0020, 0x10A2, 0x10A2, 0x0020, 0x0841, 0x3186, 0x5ACB, 0x5ACB, 0x4228, 0x1082, 0x0841, 0x31A6,
+	0x4A69, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x4A69, 0x31A6, 0x0841, 0x1082, 0x4228, 0x0020, 0x0020,
+	0x3186, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x3186,
+	0x0020, 0x0020, 0x4228, 0x5ACB, 0x5ACB, 0x528A, 0x31A6, 0x18C3, 0x10A2, 0x10A2, 0x18C3, 0x31A6,
+	0x528A, 0x5ACB, 0x5ACB, 0x4228, 0x2104, 0x5ACB, 0x39E7, 0x0020, 0x10A2, 0x10A2, 0x0020, 0x39E7,
+	0x5ACB, 0x2104, 0x0841, 0x0841, 0x31A6, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x31A6, 0x0841, 0x0841,
+	0x0841, 0x528A, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x528A, 0x0841, 0x2104, 0x528A,
+	0x2965, 0x10A2, 0x10A2, 0x2965, 0x528A, 0x2104, 0x0020, 0x0020, 0x2965, 0xAD75, 0xAD75, 0x2965,
+	0xAD75, 0xFFFF, 0xFFFF, 0xAD75, 0xAD75, 0xFFFF, 0xFFFF, 0xAD75, 0x2965, 0xAD75, 0xAD75, 0x2965,
+};
+static const uint8_t wifi_0_alpha[] = {
+	 31, 111, 191, 191, 111,  31,  31, 159, 159,  31, 239, 175, 127,  63,  63,  63,
+	 63, 127, 175, 239, 143,  31,  15,  63,  63,  15,  31, 143, 207,  47,  31, 159,
+	223, 223, 159,  31,  47, 207,  15,  15, 143, 143,  15,  15, 207, 239, 159,  79,
+	 63,  63,  79, 159, 239, 207,  95, 175,  15,  63,  63,  15, 175,  95,  31,  31,
+	159, 159,  31,  31,  31, 239, 239,  31,  95, 239, 127,  63,  63, 127, 239,  95,
+	 15,  15,  47, 175, 175,  47, 175, 175, 175, 175,  47, 175, 175,  47,
+};
+
+const sprite_t icon_wifi_0 = {
+	.width = 16, .height = 16,
+	.x = 0, .y = 0, .w = 16, .h = 16,
+	.runs = wifi_0_runs, .pixels = wifi_0_pixels, .alpha = wifi_0_alpha,
+	.opaque = 62, .blended = 94,
+};
+
+static const uint8_t wifi_1_runs[] = {
+	0x01, 0x82, 0x45, 0x82, 0xC0, 0x81, 0x4B, 0x81, 0xC0, 0x80, 0x42, 0x87, 0x42, 0x80, 0xC0, 0x41,
+	0x81, 0x01, 0x83, 0x01, 0x81, 0x41, 0xC0, 0x81, 0x00, 0x82, 0x43, 0x82, 0x00, 0x81, 0xC0, 0x82,
+	0x49, 0x82, 0xC0, 0x00, 0x80, 0x41, 0x87, 0x41, 0x80, 0xC0, 0x00, 0x80, 0x40, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x40, 0x80, 0xC0, 0x01, 0x80, 0x00, 0x81, 0x43, 0x81, 0x00, 0x80, 0xC0, 0x02, 0x81,
+	0x45, 0x81, 0xC0, 0x03, 0x87, 0xC0, 0x04, 0x80, 0x03, 0x80, 0xC0, 0x05, 0x83, 0xC0, 0x05, 0x80,
+	0x41, 0x80, 0xC0, 0x05, 0x80, 0x41, 0x80, 0xC0, 0x05, 0x83, 0xC0,
+};
+static const uint16_t wifi_1_pixels[] = {
+	0x0841, 0x2124, 0x4208, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x4208, 0x2124, 0x0841,
+	0x0841, 0x31A6, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
+	0x5ACB, 0x5ACB, 0x31A6, 0x0841, 0x528A, 0x5ACB, 0x5ACB, 0x5ACB, 0x39E7, 0x2965, 0x10A2, 0x10A2,
+	0x10A2, 0x10A2, 0x2965, 0x39E7, 0x5ACB, 0x5ACB, 0x5ACB, 0x528A, 0x5ACB, 0x5ACB, 0x3186, 0x0841,
+	0x0020, 0x10A2, 0x10A2, 0x0020, 0x0841, 0x3186, 0x5ACB, 0x5ACB, 0x4228, 0x1082, 0x0841, 0x31A6,
+	0x4A69, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x4A69, 0x31A6, 0x0841, 0x1082, 0x4228, 0x0020, 0x0020,
+	0x3186, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x3186,
+	0x0020, 0x0020, 0x4228, 0x5ACB, 0x5ACB, 0x528A, 0x31A6, 0x18C3, 0x10A2, 0x10A2, 0x18C3, 0x31A6,
+	0x528A, 0x5ACB, 0x5ACB, 0x4228, 0x2104, 0x5ACB, 0x39E7, 0x0020, 0x39E7, 0x39E7, 0x0020, 0x39E7,
+	0x5ACB, 0x2104, 0x0841, 0x18E3, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x18E3, 0x0841,
+	0x18E3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x18E3, 0x5AEB, 0xEF7D,
+	0x7BEF, 0x39E7, 0x39E7, 0x7BEF, 0xEF7D, 0x5AEB, 0x0861, 0x0861, 0x2965, 0xAD75, 0xAD75, 0x2965,
+	0xAD75, 0xFFFF, 0xFFFF, 0xAD75, 0xAD75, 0xFFFF, 0xFFFF, 0xAD75, 0x2965, 0xAD75, 0xAD75, 0x2965,
+};
+static const uint8_t wifi_1_alpha[] = {
+	 31, 111, 191, 191, 111,  31,  31, 159, 159,  31, 239, 175, 127,  63,  63,  63,
+	 63, 127, 175, 239, 143,  31,  15,  63,  63,  15,  31, 143, 207,  47,  31, 159,
+	223, 223, 159,  31,  47, 207,  15,  15, 143, 143,  15,  15, 207, 239, 159,  79,
+	 63,  63,  79, 159, 239, 207,  95, 175,  15,  63,  63,  15, 175,  95,  31,  31,
+	159, 159,  31,  31,  31, 239, 239,  31,  95, 239, 127,  63,  63, 127, 239,  95,
+	 15,  15,  47, 175, 175,  47, 175, 175, 175, 175,  47, 175, 175,  47,
+};
+
+const sprite_t icon_wifi_1 = {
+	.width = 16, .height = 16,
+	.x = 0, .y = 0, .w = 16, .h = 16,
+	.runs = wifi_1_runs, .pixels = wifi_1_pixels, .alpha = wifi_1_alpha,
+	.opaque = 62, .blended = 94,
+};
+
+static const uint8_t wifi_2_runs[] = {
+	0x01, 0x82, 0x45, 0x82, 0xC0, 0x81, 0x4B, 0x81, 0xC0, 0x80, 0x42, 0x87, 0x42, 0x80, 0xC0, 0x41,
+	0x81, 0x01, 0x83, 0x01, 0x81, 0x41, 0xC0, 0x81, 0x00, 0x82, 0x43, 0x82, 0x00, 0x81, 0xC0, 0x82,
+	0x49, 0x82, 0xC0, 0x00, 0x80, 0x41, 0x87, 0x41, 0x80, 0xC0, 0x00, 0x80, 0x40, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x40, 0x80, 0xC0, 0x01, 0x80, 0x00, 0x81, 0x43, 0x81, 0x00, 0x80, 0xC0, 0x02, 0x81,
+	0x45, 0x81, 0xC0, 0x03, 0x87, 0xC0, 0x04, 0x80, 0x03, 0x80, 0xC0, 0x05, 0x83, 0xC0, 0x05, 0x80,
+	0x41, 0x80, 0xC0, 0x05, 0x80, 0x41, 0x80, 0xC0, 0x05, 0x83, 0xC0,
+};
+static const uint16_t wifi_2_pixels[] = {
+	0x0841, 0x2124, 0x4208, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x4208, 0x2124, 0x0841,
+	0x0841, 0x31A6, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
+	0x5ACB, 0x5ACB, 0x31A6, 0x0841, 0x528A, 0x5ACB, 0x5ACB, 0x5ACB, 0x39E7, 0x2965, 0x10A2, 0x10A2,
+	0x10A2, 0x10A2, 0x2965, 0x39E7, 0x5ACB, 0x5ACB, 0x5ACB, 0x528A, 0x5ACB, 0x5ACB, 0x3186, 0x0841,
+	0x0861, 0x39E7, 0x39E7, 0x0861, 0x0841, 0x3186, 0x5ACB, 0x5ACB, 0x4228, 0x1082, 0x18E3, 0x9CF3,
+	0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x9CF3, 0x18E3, 0x1082, 0x4228, 0x0020, 0x0861,
+	0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,
+	0x0861, 0x0020, 0xCE79, 0xFFFF, 0xFFFF, 0xEF7D, 0x9CF3, 0x4A69, 0x39E7, 0x39E7, 0x4A69, 0x9CF3,
+	0xEF7D, 0xFFFF, 0xFFFF, 0xCE79, 0x5AEB, 0xFFFF, 0xAD75, 0x0861, 0x39E7, 0x39E7, 0x0861, 0xAD75,
+	0xFFFF, 0x5AEB, 0x18E3, 0x18E3, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x18E3, 0x18E3,
+	0x18E3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x18E3, 0x5AEB, 0xEF7D,
+	0x7BEF, 0x39E7, 0x39E7, 0x7BEF, 0xEF7D, 0x5AEB, 0x0861, 0x0861, 0x2965, 0xAD75, 0xAD75, 0x2965,
+	0xAD75, 0xFFFF, 0xFFFF, 0xAD75, 0xAD75, 0xFFFF, 0xFFFF, 0xAD75, 0x2965, 0xAD75, 0xAD75, 0x2965,
+};
+static const uint8_t wifi_2_alpha[] = {
+	 31, 111, 191, 191, 111,  31,  31, 159, 159,  31, 239, 175, 127,  63,  63,  63,
+	 63, 127, 175, 239, 143,  31,  15,  63,  63,  15,  31, 143, 207,  47,  31, 159,
+	223, 223, 159,  31,  47, 207,  15,  15, 143, 143,  15,  15, 207, 239, 159,  79,
+	 63,  63,  79, 159, 239, 207,  95, 175,  15,  63,  63,  15, 175,  95,  31,  31,
+	159, 159,  31,  31,  31, 239, 239,  31,  95, 239, 127,  63,  63, 127, 239,  95,
+	 15,  15,  47, 175, 175,  47, 175, 175, 175, 175,  47, 175, 175,  47,
+};
+
+const sprite_t icon_wifi_2 = {
+	.width = 16, .height = 16,
+	.x = 0, .y = 0, .w = 16, .h = 16,
+	.runs = wifi_2_runs, .pixels = wifi_2_pixels, .alpha = wifi_2_alpha,
+	.opaque = 62, .blended = 94,
+};
+
+static const uint8_t wifi_3_runs[] = {
+	0x01, 0x82, 0x45, 0x82, 0xC0, 0x81, 0x4B, 0x81, 0xC0, 0x80, 0x42, 0x87, 0x42, 0x80, 0xC0, 0x41,
+	0x81, 0x01, 0x83, 0x01, 0x81, 0x41, 0xC0, 0x81, 0x00, 0x82, 0x43, 0x82, 0x00, 0x81, 0xC0, 0x82,
+	0x49, 0x82, 0xC0, 0x00, 0x80, 0x41, 0x87, 0x41, 0x80, 0xC0, 0x00, 0x80, 0x40, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x40, 0x80, 0xC0, 0x01, 0x80, 0x00, 0x81, 0x43, 0x81, 0x00, 0x80, 0xC0, 0x02, 0x81,
+	0x45, 0x81, 0xC0, 0x03, 0x87, 0xC0, 0x04, 0x80, 0x03, 0x80, 0xC0, 0x05, 0x83, 0xC0, 0x05, 0x80,
+	0x41, 0x80, 0xC0, 0x05, 0x80, 0x41, 0x80, 0xC0, 0x05, 0x83, 0xC0,
+};
+static const uint16_t wifi_3_pixels[] = {
+	0x18E3, 0x6B6D, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x6B6D, 0x18E3,
+	0x18E3, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x9CF3, 0x18E3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x7BEF, 0x39E7, 0x39E7,
+	0x39E7, 0x39E7, 0x7BEF, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFFF, 0xFFFF, 0x8C71, 0x18E3,
+	0x0861, 0x39E7, 0x39E7, 0x0861, 0x18E3, 0x8C71, 0xFFFF, 0xFFFF, 0xCE79, 0x2965, 0x18E3, 0x9CF3,
+	0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x9CF3, 0x18E3, 0x2965, 0xCE79, 0x0861, 0x0861,
+	0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,
+	0x0861, 0x0861, 0xCE79, 0xFFFF, 0xFFFF, 0xEF7D, 0x9CF3, 0x4A69, 0x39E7, 0x39E7, 0x4A69, 0x9CF3,
+	0xEF7D, 0xFFFF, 0xFFFF, 0xCE79, 0x5AEB, 0xFFFF, 0xAD75, 0x0861, 0x39E7, 0x39E7, 0x0861, 0xAD75,
+	0xFFFF, 0x5AEB, 0x18E3, 0x18E3, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x18E3, 0x18E3,
+	0x18E3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x18E3, 0x5AEB, 0xEF7D,
+	0x7BEF, 0x39E7, 0x39E7, 0x7BEF, 0xEF7D, 0x5AEB, 0x0861, 0x0861, 0x2965, 0xAD75, 0xAD75, 0x2965,
+	0xAD75, 0xFFFF, 0xFFFF, 0xAD75, 0xAD75, 0xFFFF, 0xFFFF, 0xAD75, 0x2965, 0xAD75, 0xAD75, 0x2965,
+};
+static const uint8_t wifi_3_alpha[] = {
+	 31, 111, 191, 191, 111,  31,  31, 159, 159,  31, 239, 175, 127,  63,  63,  63,
+	 63, 127, 175, 239, 143,  31,  15,  63,  63,  15,  31, 143, 207,  47,  31, 159,
+	223, 223, 159,  31,  47, 207,  15,  15, 143, 143,  15,  15, 207, 239, 159,  79,
+	 63,  63,  79, 159, 239, 207,  95, 175,  15,  63,  63,  15, 175,  95,  31,  31,
+	159, 159,  31,  31,  31, 239, 239,  31,  95, 239, 127,  63,  63, 127, 239,  95,
+	 15,  15,  47, 175, 175,  47, 175, 175, 175, 175,  47, 175, 175,  47,
+};
+
+const sprite_t icon_wifi_3 = {
+	.width = 16, .height = 16,
+	.x = 0, .y = 0, .w = 16, .h = 16,
+	.runs = wifi_3_runs, .pixels = wifi_3_pixels, .alpha = wifi_3_alpha,
+	.opaque = 62, .blended = 94,
+};
+
+const sprite_t *const icon_all[ICON_COUNT] = {
+	&icon_bulb_off,
+	&icon_bulb_on,
+	&icon_wifi_0,
+	&icon_wifi_1,
+	&icon_wifi_2,
+	&icon_wifi_3,
+};
+
+const char *const icon_names[ICON_COUNT] = {
+	"bulb_off",
+	"bulb_on",
+	"wifi_0",
+	"wifi_1",
+	"wifi_2",
+	"wifi_3",
+};
@@ -0,0 +1,20 @@
+/* Sinh bởi utils/sprite2c.py, không sửa tay:
+ *   python sprite2c.py ../assets/icons/bulb_off.png ../assets/icons/bulb_on.png ../assets/icons/wifi_0.png ../assets/icons/wifi_1.png ../assets/icons/wifi_2.png ../assets/icons/wifi_3.png -o ../main/icons
+ */
+#ifndef __ICONS_H__
+#define __ICONS_H__
+
+#include "sprite.h"
+
+extern const sprite_t icon_bulb_off;
+extern const sprite_t icon_bulb_on;
+extern const sprite_t icon_wifi_0;
+extern const sprite_t icon_wifi_1;
+extern const sprite_t icon_wifi_2;
+extern const sprite_t icon_wifi_3;
+
+#define ICON_COUNT 6
+extern const sprite_t *const icon_all[ICON_COUNT];
+extern const char *const icon_names[ICON_COUNT];
+
+#endif
@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <lcd.h>
+#include <GUI.h>
+#include <lcd_font.h>
+#include <widget.h>
+#include <render.h>
+#include <channel.h>
+#include "icons.h"
+#include "ui.h"
+
+const char* loadingString = "Loading...";
+const char* netText = "Net: Connected";
+
+// Danh sách thiết bị hiển thị trên trang chủ
+#define DEVICE_COUNT 2
+static const char *deviceNames[DEVICE_COUNT] = { "Thiết bị 1", "Thiết bị 2" };
+
+// Trang chủ: 3 khung + nhãn mạng + 2 widget mỗi thiết bị
+#define HOME_WIDGET_MAX (4 + 2 * DEVICE_COUNT)
+static widget_t home_widgets[HOME_WIDGET_MAX];
+static widget_screen_t home_screen;
+
+// Trang danh sách kênh: mỗi kênh là một cột rộng LIST_SLOT_W. Ở hướng ngang
+// (LCD_Direction(3)) phần cứng cuộn theo trục x, nên kênh c luôn nằm ở ô nhớ
+// c % LIST_SLOTS và chỉ cần đổi VSCRSADD + vẽ lại đúng một ô khi cuộn.
+#define LIST_SLOT_W     40
+#define LIST_SLOTS      (LCD_PANEL_LINES / LIST_SLOT_W)
+#define LIST_WIDGET_MAX (4 * LIST_SLOTS)
+static widget_t list_widgets[LIST_WIDGET_MAX];
+static widget_screen_t list_screen;
+
+static widget_t *slot_state[LIST_SLOTS];
+static const char *slot_text[LIST_SLOTS];
+static int slot_selected[LIST_SLOTS];
+static char channel_names[CHANNEL_COUNT][6];
+
+static ui_page_t page = UI_PAGE_HOME;
+static ui_page_t shown_page = UI_PAGE_HOME;
+static int selected = 0;        // kênh đang chọn
+static int first = 0;           // kênh đầu tiên đang hiển thị
+static int list_dirty = 0;      // đổi kênh chọn/cuộn, cần gắn lại các ô
+
+// Chỉ task render được vẽ lên LCD; nút nhấn chỉ đổi trạng thái giao diện
+// dưới khóa này rồi yêu cầu vẽ lại
+static SemaphoreHandle_t ui_lock;
+
+static void ui_build_home(void)
+{
+    WIDGET_ScreenInit(&home_screen, home_widgets, HOME_WIDGET_MAX);
+    WIDGET_AddBox(&home_screen, 20, 15, 120, 90, SKIN, 1);
+    WIDGET_AddBox(&home_screen, 20, 15, 120, 90, WHITE, 0);
+    WIDGET_AddBox(&home_screen, 25, 20, 110, 80, WHITE, 0);
+
+    // Hiển thị trạng thái kết nối mạng
+    WIDGET_AddLabel(&home_screen, 30, 25, 100, 15, BLACK, SKIN, &netText);
+
+    // Mỗi thiết bị là một dòng: nhãn + bóng đèn sáng/tắt (sprite có alpha
+    // trộn lên nền SKIN của khung)
+    for (int i = 0; i < DEVICE_COUNT; i++) {
+        uint16_t y = 60 + i * 20;
+        WIDGET_AddLabel(&home_screen, 30, y, 80, 15, BLACK, SKIN, &deviceNames[i]);
+        WIDGET_AddSprite(&home_screen, 112, y, SKIN, &icon_bulb_off, &icon_bulb_on, channel_state_ref(i));
+    }
+}
+
+static void ui_build_list(void)
+{
+    widget_t *mark;
+
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+        snprintf(channel_names[i], sizeof(channel_names[i]), "CH%d", i + 1);
+    }
+
+    WIDGET_ScreenInit(&list_screen, list_widgets, LIST_WIDGET_MAX);
+    for (int k = 0; k < LIST_SLOTS; k++) {
+        uint16_t x = k * LIST_SLOT_W;
+        WIDGET_AddBox(&list_screen, x + 2, 4, LIST_SLOT_W - 4, 120, WHITE, 0);
+        WIDGET_AddLabel(&list_screen, x + 4, 20, LIST_SLOT_W - 8, 16, WHITE, BLACK, &slot_text[k]);
+        slot_state[k] = WIDGET_AddToggle(&list_screen, x + 8, 56, 16, BLUE, RED, BLACK, channel_state_ref(0));
+        mark = WIDGET_AddToggle(&list_screen, x + 8, 96, 16, YELLOW, BLACK, BLACK, &slot_selected[k]);
+        WIDGET_SetToggleText(mark, "<*>", "   ");
+    }
+}
+
+// Gắn mỗi ô nhớ với kênh đang hiển thị tại đó và cuộn tới kênh đầu tiên
+static void ui_bind_list(void)
+{
+    for (int c = first; c < first + LIST_SLOTS; c++) {
+        int k = c % LIST_SLOTS;
+        slot_text[k] = channel_names[c];
+        slot_state[k]->bind.state = channel_state_ref(c);
+        slot_selected[k] = (c == selected);
+    }
+    LCD_ScrollTo((first % LIST_SLOTS) * LIST_SLOT_W);
+}
+
+static void ui_show_page(ui_page_t next)
+{
+    shown_page = next;
+    if (next == UI_PAGE_HOME) {
+        LCD_ScrollTo(0);
+        LCD_ShowImg(161,130);
+        WIDGET_Invalidate(&home_screen);
+        WIDGET_Render(&home_screen);
+    } else {
+        LCD_Clear(BLACK);
+        LCD_SetScrollArea(0, LCD_PANEL_LINES);
+        ui_bind_list();
+        WIDGET_Invalidate(&list_screen);
+        WIDGET_Render(&list_screen);
+    }
+}
+
+void GUI_Init(void){
+    ui_lock = xSemaphoreCreateMutex();
+
+    //LCD Init
+    LCD_Init();
+    LCD_Direction(3);
+    LCD_Clear(BLACK);
+    LCD_ShowCentredString(WHITE, BLACK, (uint8_t *)loadingString, 16, 1);
+    vTaskDelay(1 / portTICK_PERIOD_MS);
+
+#if CONFIG_LCD_TEXT_BENCH
+    LCD_FONT_Bench();
+    LCD_Clear(BLACK);
+    LCD_ShowCentredString(WHITE, BLACK, (uint8_t *)loadingString, 16, 1);
+#endif
+#if CONFIG_LCD_SPRITE_BENCH
+    for (int i = 0; i < ICON_COUNT; i++) {
+        SPRITE_Bench(icon_names[i], icon_all[i], SKIN);
+    }
+#endif
+
+    ui_build_home();
+    ui_build_list();
+    ui_show_page(UI_PAGE_HOME);
+
+    // Từ đây mọi lần vẽ đều đi qua task render (giới hạn tốc độ khung hình)
+    RENDER_Init(LCD_Update, 0);
+}
+
+// Vẽ một khung hình, chạy trên task render. Trả về diện tích vùng đã gửi
+// xuống LCD (điểm ảnh) cho bộ đếm của task render
+uint32_t LCD_Update(void){
+    widget_screen_t *screen;
+    uint32_t pixels;
+
+    xSemaphoreTake(ui_lock, portMAX_DELAY);
+    if (page != shown_page) {
+        list_dirty = 0;
+        ui_show_page(page);
+        // Đổi trang vẽ lại cả màn hình
+        pixels = LCD_W * LCD_H;
+    } else {
+        screen = page == UI_PAGE_CHANNELS ? &list_screen : &home_screen;
+        if (page == UI_PAGE_CHANNELS && list_dirty) {
+            list_dirty = 0;
+            ui_bind_list();
+        }
+        // Chỉ vẽ lại các widget có dữ liệu thay đổi trên trang hiện tại
+        WIDGET_Render(screen);
+        pixels = (uint32_t)screen->damage.w * screen->damage.h;
+    }
+    xSemaphoreGive(ui_lock);
+    return pixels;
+}
+
+/// @brief Điều hướng bằng 2 nút: nhấn ngắn để chọn, giữ lâu để bật/tắt
+/// @param pin nút được nhấn
+/// @param event nhấn ngắn hoặc giữ lâu
+void ui_handle_button(int pin, button_event_t event)
+{
+    int toggle = -1;
+
+    xSemaphoreTake(ui_lock, portMAX_DELAY);
+
+    if (page == UI_PAGE_HOME) {
+        if (event == BUTTON_EVENT_LONG_PRESS) {
+            // Giữ lâu ở trang chủ: bật/tắt nhanh thiết bị 1 (BACK) hoặc 2 (NEXT)
+            toggle = (pin == BUTTON_BACK) ? 0 : 1;
+        } else {
+            page = UI_PAGE_CHANNELS;
+        }
+    } else if (event == BUTTON_EVENT_LONG_PRESS) {
+        toggle = selected;
+    } else if (pin == BUTTON_NEXT) {
+        if (selected == CHANNEL_COUNT - 1) {
+            selected = 0;
+            first = 0;
+        } else if (++selected >= first + LIST_SLOTS) {
+            first++;
+        }
+        list_dirty = 1;
+    } else if (pin == BUTTON_BACK) {
+        if (selected == 0) {
+            page = UI_PAGE_HOME;
+        } else {
+            if (--selected < first) {
+                first--;
+            }
+            list_dirty = 1;
+        }
+    }
+
+    xSemaphoreGive(ui_lock);
+
+    // channel_toggle báo cho listener, listener sẽ yêu cầu vẽ lại
+    if (toggle >= 0) {
+        channel_toggle(toggle);
+    } else {
+        RENDER_Request();
+    }
+}
@@ -0,0 +1,18 @@
+#ifndef __UI_H__
+#define __UI_H__
+
+#include <stdint.h>
+#include <button.h>
+
+// Các trang giao diện trên LCD
+typedef enum {
+    UI_PAGE_HOME = 0,       // Khung trạng thái mạng + thiết bị 1, 2
+    UI_PAGE_CHANNELS,       // Danh sách kênh cuộn bằng phần cứng
+} ui_page_t;
+
+void GUI_Init(void);
+uint32_t LCD_Update(void);
+
+void ui_handle_button(int pin, button_event_t event);
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ * Thông lượng của json_writer với bộ đệm 256 byte như các handler HTTP
+ * (JSON_CHUNK_SIZE), so với snprintf ghi cùng tài liệu vào một bộ đệm lớn.
+ *   bench_json_writer [số lần lặp]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include "json_writer.h"
+
+#define CHUNK_SIZE      256
+#define CHANNELS        16
+
+static volatile size_t sink_bytes;
+
+// Giả lập httpd_resp_send_chunk: chỉ đếm byte
+static int count_flush(void *ctx, const char *data, size_t len)
+{
+    sink_bytes += len;
+    return 0;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Giống GET /state và /channels: mảng kênh, số và bool */
+static void write_channels(json_writer_t *w, uint32_t version)
+{
+    json_obj_begin(w);
+    json_kv_uint(w, "version", version);
+    json_key(w, "channels");
+    json_arr_begin(w);
+    for (int i = 0; i < CHANNELS; i++) {
+        json_obj_begin(w);
+        json_kv_int(w, "ch", i);
+        json_kv_bool(w, "on", (version >> i) & 1);
+        json_kv_uint(w, "on_s", (uint64_t)version * 3600 + i);
+        json_obj_end(w);
+    }
+    json_arr_end(w);
+    json_obj_end(w);
+}
+
+static int snprintf_channels(char *buf, size_t size, uint32_t version)
+{
+    int n = snprintf(buf, size, "{\"version\":%" PRIu32 ",\"channels\":[", version);
+
+    for (int i = 0; i < CHANNELS; i++) {
+        n += snprintf(buf + n, size - n, "%s{\"ch\":%d,\"on\":%s,\"on_s\":%" PRIu64 "}", i ? "," : "", i,
+                      (version >> i) & 1 ? "true" : "false", (uint64_t)version * 3600 + i);
+    }
+    n += snprintf(buf + n, size - n, "]}");
+    return n;
+}
+
+/* Nhiều chuỗi cần escape, giống /trace và /scenes */
+static void write_strings(json_writer_t *w, uint32_t seed)
+{
+    json_arr_begin(w);
+    for (int i = 0; i < CHANNELS; i++) {
+        json_obj_begin(w);
+        json_kv_str(w, "name", "Phòng khách \"chính\"");
+        json_kv_str(w, "path", "C:\\smartlight\\scene\n");
+        json_kv_uint(w, "id", seed + i);
+        json_obj_end(w);
+    }
+    json_arr_end(w);
+}
+
+static void report(const char *name, size_t bytes, int docs, double seconds)
+{
+    printf("%-22s %8.1f MB/s  %8.2f us/doc  (%zu bytes/doc)\n", name,
+           bytes / seconds / 1e6, seconds * 1e6 / docs, bytes / docs);
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+    char buf[CHUNK_SIZE];
+    char big[4096];
+    json_writer_t w;
+    size_t bytes;
+    double t0;
+
+    sink_bytes = 0;
+    t0 = now_s();
+    for (int i = 0; i < iterations; i++) {
+        json_init(&w, buf, sizeof(buf), count_flush, NULL);
+        write_channels(&w, i);
+        json_finish(&w);
+    }
+    report("json_writer channels", sink_bytes, iterations, now_s() - t0);
+
+    bytes = 0;
+    t0 = now_s();
+    for (int i = 0; i < iterations; i++) {
+        bytes += snprintf_channels(big, sizeof(big), i);
+    }
+    report("snprintf channels", bytes, iterations, now_s() - t0);
+
+    sink_bytes = 0;
+    t0 = now_s();
+    for (int i = 0; i < iterations; i++) {
+        json_init(&w, buf, sizeof(buf), count_flush, NULL);
+        write_strings(&w, i);
+        json_finish(&w);
+    }
+    report("json_writer strings", sink_bytes, iterations, now_s() - t0);
+
+    return 0;
+}
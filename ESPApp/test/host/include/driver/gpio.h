@@ -0,0 +1,2 @@
+/* channel.h include driver/gpio.h nhưng không dùng kiểu nào của nó */
+#pragma once
@@ -0,0 +1,11 @@
+/* FreeRTOS trên host: kiểm thử chạy một luồng */
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE          1
+#define pdFALSE         0
+#define portMAX_DELAY   0xFFFFFFFFu
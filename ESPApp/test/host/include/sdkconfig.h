@@ -0,0 +1,2 @@
+/* Bản build host không có sdkconfig: các CONFIG_ cần thiết được đặt trong CMakeLists.txt */
+#pragma once
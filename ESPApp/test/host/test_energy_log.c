@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <esp_partition.h>
+#include "energy_log.h"
+
+static int failures;
+
+#define CHECK(cond) do {                                                    \
+    if (!(cond)) {                                                          \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+        failures++;                                                         \
+    }                                                                       \
+} while (0)
+
+// Partition "energy" giả lập trong RAM: 4 sector, ghi chỉ xoá được bit như flash
+#define FLASH_SIZE      (4 * 4096)
+
+static uint8_t flash[FLASH_SIZE];
+static const esp_partition_t energy_part = { .size = FLASH_SIZE, .label = "energy" };
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+    return &energy_part;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *part, size_t offset, void *dst, size_t size)
+{
+    if (offset + size > FLASH_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(dst, flash + offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *part, size_t offset, const void *src, size_t size)
+{
+    const uint8_t *p = src;
+
+    if (offset + size > FLASH_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < size; i++) {
+        flash[offset + i] &= p[i];
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *part, size_t offset, size_t size)
+{
+    if (offset + size > FLASH_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(flash + offset, 0xFF, size);
+    return ESP_OK;
+}
+
+// Các ngày đã ghi, để so với những gì đọc lại
+#define MAX_DAYS        256
+
+static uint32_t ref_day[MAX_DAYS];
+static uint32_t ref_on_s[MAX_DAYS][CHANNEL_COUNT];
+static int ref_count;
+
+typedef struct {
+    int next;               // chỉ số ref của ngày kế tiếp mong đợi
+    int mismatches;
+} visit_ctx_t;
+
+static void visit(uint32_t day, const uint32_t on_s[CHANNEL_COUNT], void *arg)
+{
+    visit_ctx_t *ctx = arg;
+
+    // Các sector cũ có thể đã bị xoá: bỏ qua các ngày đầu không còn trong log
+    while (ctx->next < ref_count && ref_day[ctx->next] < day) {
+        ctx->next++;
+    }
+    if (ctx->next >= ref_count || ref_day[ctx->next] != day ||
+        memcmp(ref_on_s[ctx->next], on_s, sizeof(ref_on_s[0])) != 0) {
+        ctx->mismatches++;
+    }
+    ctx->next++;
+}
+
+static void append(uint32_t day, const uint32_t on_s[CHANNEL_COUNT])
+{
+    CHECK(energy_log_append(day, on_s) == ESP_OK);
+    ref_day[ref_count] = day;
+    memcpy(ref_on_s[ref_count], on_s, sizeof(ref_on_s[0]));
+    ref_count++;
+}
+
+/* Đọc lại cả log: trả về số ngày, mọi ngày phải khớp và là các ngày mới nhất */
+static int read_back(void)
+{
+    visit_ctx_t ctx = { 0 };
+    int n = energy_log_foreach(0, UINT32_MAX, visit, &ctx);
+
+    CHECK(ctx.mismatches == 0);
+    CHECK(ctx.next == ref_count);
+    return n;
+}
+
+/* Hiệu lớn nhất có thể: mọi varint (ngày và 16 kênh) dài 5 byte */
+static void test_max_deltas(void)
+{
+    uint32_t on_s[CHANNEL_COUNT];
+
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        on_s[ch] = INT32_MAX;
+    }
+    append(0x10000000, on_s);
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        on_s[ch] = (uint32_t)INT32_MIN + INT32_MAX;     // hiệu INT32_MIN
+    }
+    append(0x20000000, on_s);
+    CHECK(read_back() == ref_count);
+}
+
+/* Chạy 12 ngày không có SNTP: ngày đầu có giờ gồm cả thời gian chờ (4 byte/kênh),
+ * ngày sau trở về bình thường */
+static void test_undated_days(void)
+{
+    uint32_t on_s[CHANNEL_COUNT];
+    uint32_t day = ref_day[ref_count - 1];
+
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        on_s[ch] = 12 * 86400 + ch;
+    }
+    append(++day, on_s);
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        on_s[ch] = 6 * 3600;
+    }
+    append(++day, on_s);
+    CHECK(read_back() == ref_count);
+}
+
+/* Nhiều bản ghi lớn nhất: sang sector mới và xoá sector cũ nhất không làm hỏng dữ liệu */
+static void test_sector_wrap(void)
+{
+    uint32_t on_s[CHANNEL_COUNT];
+    uint32_t day = ref_day[ref_count - 1];
+    uint32_t used, size;
+    int n;
+
+    while (ref_count < MAX_DAYS) {
+        for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+            on_s[ch] = ref_count & 1 ? INT32_MAX : 0;
+        }
+        day += 0x10000000 / MAX_DAYS;
+        append(day, on_s);
+    }
+    n = read_back();
+    // Còn lại ít nhất 3 sector đầy (sector đang ghi có thể gần như trống)
+    CHECK(n >= 3 * ((4096 - 8) / 89) && n < ref_count);
+    energy_log_usage(&used, &size);
+    CHECK(size == FLASH_SIZE);
+    CHECK(used <= size);
+    // Ngày cũ hơn ngày đã ghi bị từ chối
+    CHECK(energy_log_append(day, on_s) == ESP_ERR_INVALID_ARG);
+}
+
+int main(void)
+{
+    memset(flash, 0xFF, sizeof(flash));
+    CHECK(energy_log_init() == ESP_OK);
+
+    test_max_deltas();
+    test_undated_days();
+    test_sector_wrap();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("energy_log: all tests passed\n");
+    return 0;
+}
@@ -0,0 +1,252 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "json_writer.h"
+
+static int failures;
+
+#define CHECK(cond) do {                                                    \
+    if (!(cond)) {                                                          \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+        failures++;                                                         \
+    }                                                                       \
+} while (0)
+
+// Nơi nhận dữ liệu flush: gom lại thành chuỗi, có thể giả lập lỗi
+typedef struct {
+    char out[4096];
+    size_t len;
+    size_t max_chunk;       // lần flush lớn nhất
+    int calls;
+    int fail_at;            // lần flush thứ fail_at trả lỗi (0: không lỗi)
+} sink_t;
+
+static int sink_flush(void *ctx, const char *data, size_t len)
+{
+    sink_t *s = ctx;
+
+    s->calls++;
+    if (s->fail_at != 0 && s->calls >= s->fail_at) {
+        return -1;
+    }
+    if (s->len + len >= sizeof(s->out)) {
+        return -1;
+    }
+    memcpy(s->out + s->len, data, len);
+    s->len += len;
+    s->out[s->len] = '\0';
+    if (len > s->max_chunk) {
+        s->max_chunk = len;
+    }
+    return 0;
+}
+
+/* Tài liệu dùng chung cho các test ranh giới bộ đệm: đủ mọi loại giá trị */
+static void write_sample(json_writer_t *w)
+{
+    json_obj_begin(w);
+    json_kv_str(w, "name", "Đèn \"phòng\" khách\\1");
+    json_kv_int(w, "min", INT64_MIN);
+    json_kv_uint(w, "max", UINT64_MAX);
+    json_kv_bool(w, "on", true);
+    json_key(w, "channels");
+    json_arr_begin(w);
+    for (int i = 0; i < 16; i++) {
+        json_obj_begin(w);
+        json_kv_int(w, "ch", i);
+        json_kv_bool(w, "on", i & 1);
+        json_obj_end(w);
+    }
+    json_arr_end(w);
+    json_key(w, "raw");
+    json_raw(w, "[1,2]", 5);
+    json_key(w, "none");
+    json_null(w);
+    json_obj_end(w);
+}
+
+static const char sample_text[] =
+    "{\"name\":\"Đèn \\\"phòng\\\" khách\\\\1\",\"min\":-9223372036854775808,"
+    "\"max\":18446744073709551615,\"on\":true,\"channels\":["
+    "{\"ch\":0,\"on\":false},{\"ch\":1,\"on\":true},{\"ch\":2,\"on\":false},{\"ch\":3,\"on\":true},"
+    "{\"ch\":4,\"on\":false},{\"ch\":5,\"on\":true},{\"ch\":6,\"on\":false},{\"ch\":7,\"on\":true},"
+    "{\"ch\":8,\"on\":false},{\"ch\":9,\"on\":true},{\"ch\":10,\"on\":false},{\"ch\":11,\"on\":true},"
+    "{\"ch\":12,\"on\":false},{\"ch\":13,\"on\":true},{\"ch\":14,\"on\":false},{\"ch\":15,\"on\":true}"
+    "],\"raw\":[1,2],\"none\":null}";
+
+static void test_nesting(void)
+{
+    char buf[64];
+    sink_t s = { 0 };
+    json_writer_t w;
+
+    json_init(&w, buf, sizeof(buf), sink_flush, &s);
+    json_arr_begin(&w);
+    json_arr_begin(&w);
+    json_arr_end(&w);
+    json_obj_begin(&w);
+    json_obj_end(&w);
+    json_int(&w, 0);
+    json_int(&w, -1);
+    json_obj_begin(&w);
+    json_key(&w, "a");
+    json_arr_begin(&w);
+    json_str(&w, NULL);
+    json_obj_begin(&w);
+    json_key(&w, "b");
+    json_int(&w, -42);
+    json_obj_end(&w);
+    json_arr_end(&w);
+    json_kv_uint(&w, "c", 7);
+    json_obj_end(&w);
+    json_arr_end(&w);
+    CHECK(json_finish(&w) == 0);
+    CHECK(strcmp(s.out, "[[],{},0,-1,{\"a\":[null,{\"b\":-42}],\"c\":7}]") == 0);
+}
+
+static void test_escaping(void)
+{
+    static const char raw[] = "q\" b\\ n\n r\r t\t x\x01 y\x1f del\x7f é";
+    char buf[128];
+    sink_t s = { 0 };
+    json_writer_t w;
+
+    json_init(&w, buf, sizeof(buf), sink_flush, &s);
+    json_arr_begin(&w);
+    json_str(&w, raw);
+    // Chuỗi có byte 0 ở giữa
+    json_strn(&w, "a\0b", 3);
+    json_str(&w, "");
+    json_arr_end(&w);
+    CHECK(json_finish(&w) == 0);
+    CHECK(strcmp(s.out, "[\"q\\\" b\\\\ n\\n r\\r t\\t x\\u0001 y\\u001f del\x7f é\",\"a\\u0000b\",\"\"]") == 0);
+
+    // Key cũng được escape
+    memset(&s, 0, sizeof(s));
+    json_init(&w, buf, sizeof(buf), sink_flush, &s);
+    json_obj_begin(&w);
+    json_kv_int(&w, "k\"\n", 1);
+    json_obj_end(&w);
+    CHECK(json_finish(&w) == 0);
+    CHECK(strcmp(s.out, "{\"k\\\"\\n\":1}") == 0);
+}
+
+/* Mọi kích thước bộ đệm từ 1 byte: kết quả không đổi, không lần flush nào lớn hơn bộ đệm */
+static void test_buffer_boundaries(void)
+{
+    for (size_t size = 1; size <= sizeof(sample_text) + 1; size++) {
+        char buf[sizeof(sample_text) + 1];
+        sink_t s = { 0 };
+        json_writer_t w;
+
+        json_init(&w, buf, size, sink_flush, &s);
+        write_sample(&w);
+        CHECK(json_finish(&w) == 0);
+        CHECK(strcmp(s.out, sample_text) == 0);
+        CHECK(s.max_chunk <= size);
+        CHECK(w.flushed == strlen(sample_text));
+        CHECK(w.len == 0);
+        if (failures) {
+            printf("  buffer size %zu\n", size);
+            return;
+        }
+    }
+}
+
+/* Flush lỗi: lỗi được giữ lại, không ghi/flush thêm, json_finish báo lỗi */
+static void test_flush_error(void)
+{
+    for (int fail_at = 1; fail_at <= 4; fail_at++) {
+        char buf[16];
+        sink_t s = { .fail_at = fail_at };
+        json_writer_t w;
+        int calls;
+
+        json_init(&w, buf, sizeof(buf), sink_flush, &s);
+        write_sample(&w);
+        CHECK(w.error != 0);
+        CHECK(s.calls == fail_at);
+        calls = s.calls;
+        json_kv_str(&w, "after", "error");
+        CHECK(json_finish(&w) != 0);
+        CHECK(s.calls == calls);
+        CHECK(s.len == (size_t)(fail_at - 1) * sizeof(buf));
+    }
+
+    // Không có hàm flush: lỗi khi bộ đệm đầy
+    {
+        char buf[4];
+        json_writer_t w;
+
+        json_init(&w, buf, sizeof(buf), NULL, NULL);
+        json_str(&w, "too long");
+        CHECK(w.error != 0);
+    }
+}
+
+static int structure_error(void (*build)(json_writer_t *w))
+{
+    char buf[64];
+    sink_t s = { 0 };
+    json_writer_t w;
+
+    json_init(&w, buf, sizeof(buf), sink_flush, &s);
+    build(&w);
+    return json_finish(&w) != 0;
+}
+
+static void build_unclosed(json_writer_t *w)    { json_obj_begin(w); json_kv_int(w, "a", 1); }
+static void build_extra_close(json_writer_t *w) { json_arr_begin(w); json_arr_end(w); json_arr_end(w); }
+static void build_key_no_value(json_writer_t *w){ json_obj_begin(w); json_key(w, "a"); json_obj_end(w); }
+static void build_key_at_end(json_writer_t *w)  { json_obj_begin(w); json_obj_end(w); json_key(w, "a"); }
+static void build_double_key(json_writer_t *w)  { json_obj_begin(w); json_key(w, "a"); json_key(w, "b"); json_int(w, 1); json_obj_end(w); }
+static void build_too_deep(json_writer_t *w)
+{
+    for (int i = 0; i < JSON_MAX_DEPTH; i++) {
+        json_arr_begin(w);
+    }
+    for (int i = 0; i < JSON_MAX_DEPTH; i++) {
+        json_arr_end(w);
+    }
+}
+static void build_deepest(json_writer_t *w)
+{
+    for (int i = 0; i < JSON_MAX_DEPTH - 1; i++) {
+        json_arr_begin(w);
+    }
+    for (int i = 0; i < JSON_MAX_DEPTH - 1; i++) {
+        json_arr_end(w);
+    }
+}
+
+static void test_structure_errors(void)
+{
+    json_writer_t w;
+
+    CHECK(structure_error(build_unclosed));
+    CHECK(structure_error(build_extra_close));
+    CHECK(structure_error(build_key_no_value));
+    CHECK(structure_error(build_key_at_end));
+    CHECK(structure_error(build_double_key));
+    CHECK(structure_error(build_too_deep));
+    CHECK(!structure_error(build_deepest));
+
+    json_init(&w, NULL, 16, sink_flush, NULL);
+    CHECK(w.error != 0);
+}
+
+int main(void)
+{
+    test_nesting();
+    test_escaping();
+    test_buffer_boundaries();
+    test_flush_error();
+    test_structure_errors();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("json_writer: all tests passed\n");
+    return 0;
+}
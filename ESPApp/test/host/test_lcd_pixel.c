@@ -0,0 +1,13 @@
+#include <stdio.h>
+#include "lcd_pixel.h"
+
+/* So từng kernel với bản tham chiếu từng pixel trên mọi căn lề (LCD_PX_SelfTest) */
+int main(void)
+{
+    if (LCD_PX_SelfTest() != 1) {
+        printf("lcd_pixel: kernels differ from the reference\n");
+        return 1;
+    }
+    printf("lcd_pixel: all kernels bit-exact\n");
+    return 0;
+}
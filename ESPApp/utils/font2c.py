@@ -0,0 +1,211 @@
+"""Chuyển font bitmap BDF sang font UTF-8 cho components/lcd (lcd_font.h).
+
+  python font2c.py ../assets/fonts/smartlight16.bdf -n LCD_Font16 -o ../components/lcd/lcd_font16.c
+  python font2c.py ../assets/fonts/smartlight_sans15.bdf -n LCD_FontSans15 --bpp 4 \\
+      --kern ../assets/fonts/smartlight_sans15.kern -o ../components/lcd/lcd_font_sans15.c
+
+Nhận cả BDF 2.3 có mức xám (FontForge: trường thứ 4 của SIZE là số bit/điểm),
+dùng cho font khử răng cưa; --bpp chọn độ sâu lưu trong firmware (1, 2 hoặc 4).
+
+Mỗi ký tự có bước tiến DWIDTH (font tỷ lệ) và một hộp chứa điểm mực đặt so với
+bút: x (có dấu, có thể lấn sang ký tự bên cạnh), y tính từ đỉnh dòng, w, h.
+Bitmap lưu 4 byte x, y, w, h rồi các điểm trong hộp xếp liền nhau, bpp bit/điểm
+(bit cao trước, không đệm cuối hàng). Bảng chỉ mục sắp theo code point để
+firmware tìm nhị phân; các ký tự ASCII liên tiếp từ U+0020 nằm đầu bảng nên
+được tra trực tiếp. Ký tự thiếu được vẽ bằng U+FFFD (hoặc '?').
+
+File kerning (--kern): mỗi dòng "U+0041 U+0056 -1" (trái, phải, số điểm cộng
+vào bước tiến); dòng bắt đầu bằng # là chú thích.
+
+In số ký tự và số byte so với ô đầy đủ chưa nén.
+Chỉ dùng thư viện chuẩn.
+"""
+import argparse
+import os
+import sys
+
+
+def read_bdf(path):
+    """Đọc BDF thành (chiều cao, {code point: (bước tiến, x, y, [hàng [0..255, ...]])}).
+
+    x, y là góc trên-trái của hộp mực so với bút và đỉnh dòng.
+    """
+    ascent = descent = None
+    depth = 1
+    glyphs = {}
+    with open(path, encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        key, _, rest = line.partition(" ")
+        if key == "SIZE" and len(rest.split()) > 3:
+            depth = int(rest.split()[3])
+        elif key == "FONT_ASCENT":
+            ascent = int(rest)
+        elif key == "FONT_DESCENT":
+            descent = int(rest)
+        elif key == "STARTCHAR":
+            code = width = None
+            bbx = (0, 0, 0, 0)
+            for line in lines:
+                key, _, rest = line.partition(" ")
+                if key == "ENCODING":
+                    code = int(rest.split()[0])
+                elif key == "DWIDTH":
+                    width = int(rest.split()[0])
+                elif key == "BBX":
+                    bbx = tuple(int(v) for v in rest.split())
+                elif key == "BITMAP":
+                    break
+            bitmap = []
+            for line in lines:
+                if line.startswith("ENDCHAR"):
+                    break
+                bitmap.append(line.strip())
+            glyphs[code] = (width, bbx, bitmap)
+    if ascent is None or descent is None:
+        raise ValueError("%s: thiếu FONT_ASCENT / FONT_DESCENT" % path)
+    if depth not in (1, 2, 4, 8):
+        raise ValueError("%s: %d bit/điểm không hợp lệ" % (path, depth))
+
+    top_level = (1 << depth) - 1
+    cells = {}
+    for code, (width, (bw, bh, bx, by), bitmap) in glyphs.items():
+        if code is None or code < 0:
+            continue
+        rows = []
+        for hexrow in bitmap[:bh]:
+            bits = int(hexrow, 16)
+            nbits = len(hexrow) * 4
+            rows.append([((bits >> (nbits - (c + 1) * depth)) & top_level) * 255 // top_level
+                         for c in range(bw)])
+        cells[code] = (width, bx, ascent - (by + bh), rows)
+    return ascent + descent, cells
+
+
+def encode(x, y, rows, height, bpp):
+    """Lượng tử về bpp bit, cắt theo dòng và theo điểm mực: [x, y, w, h] + bit."""
+    top = (1 << bpp) - 1
+    ink = {}
+    for r, row in enumerate(rows):
+        for c, v in enumerate(row):
+            q = (v * top + 127) // 255
+            if q and 0 <= y + r < height:
+                ink[(c, r)] = q
+    if not ink:
+        return [0, 0, 0, 0]
+    c0 = min(p[0] for p in ink)
+    c1 = max(p[0] for p in ink)
+    r0 = min(p[1] for p in ink)
+    r1 = max(p[1] for p in ink)
+    out = [(x + c0) & 0xFF, y + r0, c1 - c0 + 1, r1 - r0 + 1]
+    acc = nbits = 0
+    for r in range(r0, r1 + 1):
+        for c in range(c0, c1 + 1):
+            acc = (acc << bpp) | ink.get((c, r), 0)
+            nbits += bpp
+            if nbits == 8:
+                out.append(acc)
+                acc = nbits = 0
+    if nbits:
+        out.append(acc << (8 - nbits))
+    return out
+
+
+def read_kern(path, codes):
+    """Đọc cặp kerning, chỉ giữ cặp có cả hai ký tự trong font: {(trái, phải): dx}."""
+    pairs = {}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].split()
+            if len(line) != 3:
+                continue
+            left, right = (int(v[2:], 16) for v in line[:2])
+            if left in codes and right in codes and int(line[2]):
+                pairs[(left, right)] = int(line[2])
+    return pairs
+
+
+def write(out, name, source, command, height, bpp, cells, kerns):
+    codes = sorted(cells)
+    ascii_run = 0
+    while ascii_run < len(codes) and codes[ascii_run] == 0x20 + ascii_run:
+        ascii_run += 1
+    fallback = codes.index(0xFFFD) if 0xFFFD in cells else codes.index(ord("?"))
+    position = {code: i for i, code in enumerate(codes)}
+
+    bits, index = [], []
+    for code in codes:
+        width, x, y, rows = cells[code]
+        index.append((code, len(bits), width))
+        bits += encode(x, y, rows, height, bpp)
+    pairs = sorted((position[a] << 16 | position[b], dx) for (a, b), dx in kerns.items())
+
+    symbol = name.lower()
+    lines = [
+        "/* Sinh bởi utils/font2c.py từ %s, không sửa tay:" % source,
+        " *   %s" % command,
+        " */",
+        '#include "lcd_font.h"',
+        "",
+        "static const lcd_glyph_t %s_glyphs[%d] = {" % (symbol, len(index)),
+    ]
+    for code, offset, width in index:
+        ch = chr(code) if code > 0x20 and code != 0x5C and code < 0xFFFD else ""
+        lines.append("\t{ 0x%04X, %5d, %2d },%s" % (code, offset, width, "\t/* %s */" % ch if ch else ""))
+    lines += ["};", "", "static const uint8_t %s_bits[%d] = {" % (symbol, len(bits))]
+    for i in range(0, len(bits), 16):
+        lines.append("\t" + ", ".join("0x%02X" % v for v in bits[i:i + 16]) + ",")
+    lines.append("};")
+    if pairs:
+        lines += ["", "static const lcd_kern_t %s_kerns[%d] = {" % (symbol, len(pairs))]
+        for key, dx in pairs:
+            a, b = codes[key >> 16], codes[key & 0xFFFF]
+            lines.append("\t{ 0x%08X, %2d },\t/* U+%04X U+%04X */" % (key, dx, a, b))
+        lines.append("};")
+    lines += ["",
+              "const lcd_font_t %s = {" % name,
+              "\t.height = %d," % height,
+              "\t.bpp = %d," % bpp,
+              "\t.ascii = %d," % ascii_run,
+              "\t.count = %d," % len(index),
+              "\t.fallback = %d," % fallback,
+              "\t.glyphs = %s_glyphs," % symbol,
+              "\t.bits = %s_bits," % symbol]
+    if pairs:
+        lines += ["\t.kerns = %s_kerns," % symbol,
+                  "\t.kern_count = %d," % len(pairs)]
+    lines += ["};", ""]
+    with open(out, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+    raw = sum((w * height * bpp + 7) // 8 for w, _, _, _ in cells.values())
+    return len(index), ascii_run, len(bits), 8 * len(index) + 8 * len(pairs), raw, len(pairs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("bdf", help="font BDF (ENCODING là code point Unicode)")
+    parser.add_argument("-n", "--name", required=True, help="tên biến C, ví dụ LCD_Font16")
+    parser.add_argument("-o", "--out", required=True, help="file .c ghi ra")
+    parser.add_argument("--bpp", type=int, choices=(1, 2, 4), default=1,
+                        help="bit/điểm trong firmware (mặc định 1; 2 hoặc 4 để khử răng cưa)")
+    parser.add_argument("--kern", help="file cặp kerning")
+    args = parser.parse_args()
+
+    height, cells = read_bdf(args.bdf)
+    if 0xFFFD not in cells and ord("?") not in cells:
+        print("%s: cần U+FFFD hoặc '?' làm ký tự thay thế" % args.bdf, file=sys.stderr)
+        return 1
+    kerns = read_kern(args.kern, cells) if args.kern else {}
+    command = " ".join(["python", "font2c.py"] + sys.argv[1:])
+    count, ascii_run, data, index, raw, npairs = write(
+        args.out, args.name, os.path.basename(args.bdf), command, height, args.bpp, cells, kerns)
+    print("%s: %d ký tự cao %d px, %d bit/điểm, %d cặp kerning (%d ASCII tra trực tiếp)" % (
+        args.name, count, height, args.bpp, npairs, ascii_run))
+    print("  bitmap %d B + chỉ mục %d B, ô đầy đủ %d B (%.0f%%)" % (
+        data, index, raw, 100.0 * data / raw))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
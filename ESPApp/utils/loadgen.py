@@ -0,0 +1,316 @@
+"""Tạo tải HTTP cho API của thiết bị và báo cáo độ trễ.
+
+Ví dụ:
+  python loadgen.py http://192.168.1.155 -c 16 -d 30
+  python loadgen.py http://localhost:8080 -c 64 --no-keepalive --json result.json --label v1.4
+  python loadgen.py --standin 8081 -c 8 -d 5           # tự chạy server giả để thử công cụ
+
+Tỷ lệ request (--mix) là danh sách [METHOD:]path=trọng_số, mặc định:
+  /led=70,/toggle-led1=10,/toggle-led2=10,/=10
+Path bắt đầu bằng /toggle mặc định dùng POST, còn lại GET.
+
+Máy chủ "giả" để so sánh: bản build Linux của firmware (xem CMakeLists.txt của
+project) hoặc --standin, một server Python tối giản trả lời cùng các endpoint.
+"""
+import argparse
+import http.client
+import json
+import random
+import socket
+import sys
+import threading
+import time
+import urllib.parse
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+DEFAULT_MIX = "/led=70,/toggle-led1=10,/toggle-led2=10,/=10"
+
+
+def parse_mix(spec):
+    mix = []
+    for item in spec.split(","):
+        item = item.strip()
+        if not item:
+            continue
+        target, _, weight = item.rpartition("=")
+        if not target:
+            target, weight = weight, "1"
+        method, sep, path = target.partition(":")
+        if not sep:
+            path = method
+            method = "POST" if path.startswith("/toggle") else "GET"
+        mix.append((method.upper(), path, float(weight)))
+    if not mix:
+        sys.exit("Empty --mix")
+    return mix
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return 0.0
+    k = (len(sorted_values) - 1) * p / 100.0
+    lo = int(k)
+    hi = min(lo + 1, len(sorted_values) - 1)
+    return sorted_values[lo] + (sorted_values[hi] - sorted_values[lo]) * (k - lo)
+
+
+class Stats:
+    """Kết quả của một endpoint, gộp từ mọi worker."""
+
+    def __init__(self):
+        self.latencies = []
+        self.errors = {}
+        self.bytes = 0
+
+    def ok(self, latency, nbytes):
+        self.latencies.append(latency)
+        self.bytes += nbytes
+
+    def error(self, kind):
+        self.errors[kind] = self.errors.get(kind, 0) + 1
+
+    def merge(self, other):
+        self.latencies.extend(other.latencies)
+        self.bytes += other.bytes
+        for k, v in other.errors.items():
+            self.errors[k] = self.errors.get(k, 0) + v
+
+    def summary(self, elapsed):
+        lat = sorted(self.latencies)
+        errors = sum(self.errors.values())
+        total = len(lat) + errors
+        return {
+            "requests": total,
+            "ok": len(lat),
+            "errors": errors,
+            "error_rate": errors / total if total else 0.0,
+            "error_kinds": self.errors,
+            "rps": len(lat) / elapsed if elapsed > 0 else 0.0,
+            "bytes": self.bytes,
+            "latency_ms": {
+                "min": lat[0] * 1000 if lat else 0.0,
+                "mean": sum(lat) / len(lat) * 1000 if lat else 0.0,
+                "p50": percentile(lat, 50) * 1000,
+                "p95": percentile(lat, 95) * 1000,
+                "p99": percentile(lat, 99) * 1000,
+                "max": lat[-1] * 1000 if lat else 0.0,
+            },
+        }
+
+
+class Worker(threading.Thread):
+    def __init__(self, args, host, port, mix, deadline, budget, interval):
+        super().__init__(daemon=True)
+        self.args = args
+        self.host = host
+        self.port = port
+        self.mix = mix
+        self.weights = [w for _, _, w in mix]
+        self.deadline = deadline
+        self.budget = budget
+        self.interval = interval
+        self.stats = {(m, p): Stats() for m, p, _ in mix}
+        self.conn = None
+        self.rng = random.Random()
+
+    def connect(self):
+        self.conn = http.client.HTTPConnection(self.host, self.port, timeout=self.args.timeout)
+
+    def close(self):
+        if self.conn is not None:
+            self.conn.close()
+            self.conn = None
+
+    def request(self, method, path):
+        headers = {} if self.args.keepalive else {"Connection": "close"}
+        if self.conn is None:
+            self.connect()
+        start = time.perf_counter()
+        self.conn.request(method, path, headers=headers)
+        resp = self.conn.getresponse()
+        body = resp.read()
+        latency = time.perf_counter() - start
+        if not self.args.keepalive or resp.will_close:
+            self.close()
+        return resp.status, latency, len(body)
+
+    def run(self):
+        next_at = time.perf_counter()
+        while time.perf_counter() < self.deadline and self.budget.take():
+            method, path, _ = self.rng.choices(self.mix, self.weights)[0]
+            st = self.stats[(method, path)]
+            try:
+                status, latency, nbytes = self.request(method, path)
+                if 200 <= status < 400:
+                    st.ok(latency, nbytes)
+                else:
+                    st.error("http_%d" % status)
+            except socket.timeout:
+                st.error("timeout")
+                self.close()
+            except (ConnectionError, http.client.HTTPException, OSError) as e:
+                st.error(type(e).__name__)
+                self.close()
+            if self.interval:
+                next_at += self.interval
+                delay = next_at - time.perf_counter()
+                if delay > 0:
+                    time.sleep(delay)
+        self.close()
+
+
+class Budget:
+    """Giới hạn tổng số request (--requests) dùng chung giữa các worker."""
+
+    def __init__(self, total):
+        self.left = total
+        self.lock = threading.Lock()
+
+    def take(self):
+        if self.left is None:
+            return True
+        with self.lock:
+            if self.left <= 0:
+                return False
+            self.left -= 1
+            return True
+
+
+class StandinHandler(BaseHTTPRequestHandler):
+    """Server giả tối giản với cùng các endpoint, để thử công cụ không cần thiết bị."""
+    protocol_version = "HTTP/1.1"
+    disable_nagle_algorithm = True
+    state = [0, 0]
+    lock = threading.Lock()
+    index = b"<!DOCTYPE html><html><body>SmartLight stand-in</body></html>" * 40
+
+    def send(self, status, body, ctype="application/json"):
+        self.send_response(status)
+        self.send_header("Content-Type", ctype)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def led_json(self):
+        return json.dumps({"led1": self.state[0], "led2": self.state[1]}).encode()
+
+    def do_GET(self):
+        if self.path == "/":
+            self.send(200, self.index, "text/html")
+        elif self.path.startswith("/led"):
+            self.send(200, self.led_json())
+        else:
+            self.send(404, b"Not found", "text/plain")
+
+    def do_POST(self):
+        length = int(self.headers.get("Content-Length") or 0)
+        if length:
+            self.rfile.read(length)
+        if self.path in ("/toggle-led1", "/toggle-led2"):
+            i = 0 if self.path.endswith("1") else 1
+            with self.lock:
+                self.state[i] ^= 1
+                value = self.state[i]
+            self.send(200, json.dumps({"led%d" % (i + 1): value}).encode())
+        else:
+            self.send(404, b"Not found", "text/plain")
+
+    def log_message(self, fmt, *args):
+        pass
+
+
+def start_standin(port):
+    server = ThreadingHTTPServer(("127.0.0.1", port), StandinHandler)
+    server.daemon_threads = True
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server
+
+
+def print_report(report):
+    total = report["total"]
+    print("%d requests in %.1f s, %.1f req/s, %d errors (%.2f%%)" % (
+        total["requests"], report["elapsed_s"], total["rps"], total["errors"], total["error_rate"] * 100))
+    print("%-22s %7s %8s %8s %8s %8s %8s %7s" % ("endpoint", "ok", "req/s", "p50", "p95", "p99", "max", "err"))
+    for name, s in list(report["endpoints"].items()) + [("total", total)]:
+        lat = s["latency_ms"]
+        print("%-22s %7d %8.1f %8.2f %8.2f %8.2f %8.2f %7d" % (
+            name, s["ok"], s["rps"], lat["p50"], lat["p95"], lat["p99"], lat["max"], s["errors"]))
+    for name, s in report["endpoints"].items():
+        if s["error_kinds"]:
+            print("  %s: %s" % (name, ", ".join("%s=%d" % kv for kv in sorted(s["error_kinds"].items()))))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("url", nargs="?", help="địa chỉ thiết bị, ví dụ http://192.168.1.155")
+    parser.add_argument("-c", "--concurrency", type=int, default=4, help="số kết nối song song (mặc định 4)")
+    parser.add_argument("-d", "--duration", type=float, default=10, help="thời gian chạy, giây (mặc định 10)")
+    parser.add_argument("-n", "--requests", type=int, help="dừng sau số request này")
+    parser.add_argument("--rate", type=float, help="tổng số request/giây mong muốn (mặc định: nhanh nhất có thể)")
+    parser.add_argument("--mix", default=DEFAULT_MIX, help="tỷ lệ request, [METHOD:]path=trọng_số,...")
+    parser.add_argument("--no-keepalive", dest="keepalive", action="store_false",
+                        help="mở kết nối mới cho mỗi request")
+    parser.add_argument("--timeout", type=float, default=5, help="timeout mỗi request, giây (mặc định 5)")
+    parser.add_argument("--json", help="ghi kết quả ra file JSON")
+    parser.add_argument("--label", default="", help="nhãn ghi vào JSON, ví dụ phiên bản firmware")
+    parser.add_argument("--standin", type=int, metavar="PORT", help="chạy server giả trên cổng này và tạo tải vào nó")
+    args = parser.parse_args()
+
+    if args.standin:
+        start_standin(args.standin)
+        args.url = args.url or "http://127.0.0.1:%d" % args.standin
+    if not args.url:
+        parser.error("url is required (or use --standin)")
+
+    url = urllib.parse.urlsplit(args.url if "://" in args.url else "http://" + args.url)
+    host, port = url.hostname, url.port or 80
+    mix = parse_mix(args.mix)
+    interval = args.concurrency / args.rate if args.rate else 0
+
+    budget = Budget(args.requests)
+    start = time.perf_counter()
+    deadline = start + (args.duration if args.requests is None else 1e9)
+    workers = [Worker(args, host, port, mix, deadline, budget, interval) for _ in range(args.concurrency)]
+    for w in workers:
+        w.start()
+    try:
+        for w in workers:
+            w.join()
+    except KeyboardInterrupt:
+        # Worker là daemon: dừng sớm và báo cáo những gì đã có
+        for w in workers:
+            w.deadline = 0
+        for w in workers:
+            w.join()
+    elapsed = time.perf_counter() - start
+
+    endpoints = {}
+    total = Stats()
+    for method, path, _ in mix:
+        st = Stats()
+        for w in workers:
+            st.merge(w.stats[(method, path)])
+        total.merge(st)
+        endpoints["%s %s" % (method, path)] = st.summary(elapsed)
+
+    report = {
+        "label": args.label,
+        "url": args.url,
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+        "concurrency": args.concurrency,
+        "keepalive": args.keepalive,
+        "rate": args.rate,
+        "mix": args.mix,
+        "elapsed_s": elapsed,
+        "endpoints": endpoints,
+        "total": total.summary(elapsed),
+    }
+    print_report(report)
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump(report, f, indent=2)
+        print("Đã ghi %s" % args.json)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,87 @@
+"""Chụp màn hình LCD qua GET /screenshot và so sánh từng điểm với ảnh mẫu.
+
+  python screenshot.py http://192.168.1.155 -o home.bmp
+  python screenshot.py http://localhost:8080 --expect ref/home.bmp     # bản build Linux
+
+Ảnh lấy về ở dạng BMP RGB565 (--png để lấy PNG). Với --expect, ảnh mẫu (BMP
+RGB565 lưu từ endpoint này, hoặc PNG) được đưa về RGB565 rồi so sánh; in số
+điểm khác và hộp bao của chúng, trả mã lỗi 1 nếu khác. Dùng cho kiểm thử trên
+máy host: vẽ một màn hình, chụp, so với ảnh đã duyệt.
+Chỉ dùng thư viện chuẩn.
+"""
+import argparse
+import struct
+import sys
+import urllib.request
+
+from sprite2c import read_png
+
+
+def read_bmp565(data):
+    """BMP 16 bit BI_BITFIELDS RGB565 như /screenshot ghi: (rộng, cao, [hàng [rgb565, ...]])."""
+    if data[:2] != b"BM":
+        raise ValueError("không phải BMP")
+    offset, = struct.unpack("<I", data[10:14])
+    width, height, _, bits, compression = struct.unpack("<iiHHI", data[18:34])
+    masks = struct.unpack("<III", data[54:66])
+    if bits != 16 or compression != 3 or masks != (0xF800, 0x07E0, 0x001F):
+        raise ValueError("chỉ đọc BMP RGB565")
+    stride = (2 * width + 3) & ~3
+    rows = []
+    for y in range(abs(height)):
+        base = offset + y * stride
+        rows.append(list(struct.unpack("<%dH" % width, data[base:base + 2 * width])))
+    if height > 0:
+        rows.reverse()
+    return width, abs(height), rows
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] == b"BM":
+        return read_bmp565(data)
+    width, height, rgba = read_png(path)
+    return width, height, [[(r >> 3) << 11 | (g >> 2) << 5 | (b >> 3) for r, g, b, _ in row] for row in rgba]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("url", help="địa chỉ thiết bị, ví dụ http://192.168.1.155")
+    parser.add_argument("-o", "--out", help="file lưu ảnh chụp")
+    parser.add_argument("--png", action="store_true", help="lấy PNG thay vì BMP")
+    parser.add_argument("--expect", help="ảnh mẫu để so sánh (BMP RGB565 hoặc PNG)")
+    args = parser.parse_args()
+
+    url = args.url.rstrip("/") + "/screenshot" + ("?format=png" if args.png else "")
+    with urllib.request.urlopen(url, timeout=10) as resp:
+        data = resp.read()
+    if args.out:
+        with open(args.out, "wb") as f:
+            f.write(data)
+        print("Đã ghi %s (%d byte)" % (args.out, len(data)))
+    if not args.expect:
+        return 0
+    if args.png:
+        print("--expect cần ảnh BMP, bỏ --png", file=sys.stderr)
+        return 2
+
+    width, height, got = read_bmp565(data)
+    ew, eh, want = load(args.expect)
+    if (ew, eh) != (width, height):
+        print("kích thước khác: màn hình %dx%d, mẫu %dx%d" % (width, height, ew, eh))
+        return 1
+    diff = [(x, y) for y in range(height) for x in range(width) if got[y][x] != want[y][x]]
+    if not diff:
+        print("giống mẫu (%dx%d)" % (width, height))
+        return 0
+    xs = [p[0] for p in diff]
+    ys = [p[1] for p in diff]
+    x, y = diff[0]
+    print("%d điểm khác, trong hộp x %d..%d, y %d..%d; điểm đầu (%d, %d): 0x%04X, mẫu 0x%04X" % (
+        len(diff), min(xs), max(xs), min(ys), max(ys), x, y, got[y][x], want[y][x]))
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,248 @@
+"""Chuyển ảnh PNG có kênh alpha sang sprite RGB565A8 cho components/lcd (sprite.h).
+
+  python sprite2c.py ../assets/icons/*.png -o ../main/icons
+
+Ghi ra icons.c / icons.h: mỗi ảnh thành một `const sprite_t icon_<tên>`, kèm
+mảng icon_all[] / icon_names[] để chạy SPRITE_Bench. In bảng kích thước và
+số byte của từng sprite.
+
+Định dạng (xem sprite.h):
+  - ảnh được cắt về hộp chứa các điểm nhìn thấy (alpha > 0);
+  - mỗi hàng là chuỗi run 1 byte: 2 bit loại (trong suốt / đục / pha trộn),
+    6 bit độ dài - 1, kết thúc bằng SPRITE_RUN_END;
+  - pixels[] chứa điểm đục và điểm pha trộn theo thứ tự run, màu đã nhân sẵn
+    alpha (pre-multiplied) ở thang 0..32, nên firmware chỉ cần một phép cộng;
+  - alpha[] chứa byte alpha gốc của từng điểm pha trộn.
+Chỉ dùng thư viện chuẩn (tự giải mã PNG, không cần Pillow).
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+RUN_CLEAR, RUN_OPAQUE, RUN_BLEND, RUN_END = 0x00, 0x40, 0x80, 0xC0
+RUN_MAX = 64
+
+
+def read_png(path):
+    """Giải mã PNG không interlace thành (rộng, cao, danh sách hàng [(r, g, b, a), ...])."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: không phải PNG" % path)
+
+    pos = 8
+    idat = b""
+    palette, trns = [], b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if interlace:
+        raise ValueError("%s: PNG interlace chưa được hỗ trợ" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    if depth < 8 and ctype != 3 and ctype != 0:
+        raise ValueError("%s: độ sâu bit %d không hợp lệ" % (path, depth))
+    bits = channels * depth
+    stride = (width * bits + 7) // 8
+    bpp = max(1, bits // 8)
+
+    raw = zlib.decompress(idat)
+    prev = bytearray(stride)
+    rows = []
+    for y in range(height):
+        base = y * (stride + 1)
+        ftype = raw[base]
+        line = bytearray(raw[base + 1:base + 1 + stride])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = line
+
+        # Tách mẫu, đưa về 8 bit
+        if depth < 8:
+            samples = []
+            mask = (1 << depth) - 1
+            for i in range(width):
+                bit = i * depth
+                samples.append((line[bit // 8] >> (8 - depth - bit % 8)) & mask)
+            if ctype == 0:
+                samples = [s * 255 // mask for s in samples]
+        elif depth == 16:
+            samples = [line[i] for i in range(0, stride, 2)]
+        else:
+            samples = list(line)
+
+        row = []
+        for x in range(width):
+            s = samples[x * channels:(x + 1) * channels]
+            if ctype == 0:
+                row.append((s[0], s[0], s[0], 255))
+            elif ctype == 2:
+                row.append((s[0], s[1], s[2], 255))
+            elif ctype == 3:
+                r, g, b = palette[s[0]]
+                row.append((r, g, b, trns[s[0]] if s[0] < len(trns) else 255))
+            elif ctype == 4:
+                row.append((s[0], s[0], s[0], s[1]))
+            else:
+                row.append(tuple(s))
+        rows.append(row)
+    return width, height, rows
+
+
+def alpha5(a):
+    """Byte alpha sang thang 0..32, giống SPRITE_ALPHA5 trong sprite.h."""
+    return (a + 4) >> 3
+
+
+def encode(width, height, rows):
+    """Cắt ảnh về phần nhìn thấy và mã hoá thành run / pixels / alpha."""
+    visible = [(x, y) for y in range(height) for x in range(width) if alpha5(rows[y][x][3]) > 0]
+    if not visible:
+        return dict(width=width, height=height, x=0, y=0, w=0, h=0,
+                    runs=[], pixels=[], alpha=[], opaque=0, blended=0)
+    x0 = min(p[0] for p in visible)
+    x1 = max(p[0] for p in visible)
+    y0 = min(p[1] for p in visible)
+    y1 = max(p[1] for p in visible)
+
+    runs, pixels, alpha = [], [], []
+    opaque = blended = 0
+    for y in range(y0, y1 + 1):
+        kinds = []
+        for x in range(x0, x1 + 1):
+            r, g, b, a = rows[y][x]
+            a5 = alpha5(a)
+            r5 = (r * 31 + 127) // 255
+            g6 = (g * 63 + 127) // 255
+            b5 = (b * 31 + 127) // 255
+            if a5 == 0:
+                kinds.append((RUN_CLEAR, None, None))
+            elif a5 == 32:
+                kinds.append((RUN_OPAQUE, (r5 << 11) | (g6 << 5) | b5, None))
+            else:
+                # Nhân sẵn với cùng phép làm tròn xuống như SPRITE_Lut,
+                # để điểm + nền không tràn từ kênh này sang kênh khác
+                px = ((r5 * a5) >> 5) << 11 | ((g6 * a5) >> 5) << 5 | ((b5 * a5) >> 5)
+                kinds.append((RUN_BLEND, px, a))
+        # Phần trong suốt cuối hàng do firmware tự tô
+        while kinds and kinds[-1][0] == RUN_CLEAR:
+            kinds.pop()
+
+        i = 0
+        while i < len(kinds):
+            kind = kinds[i][0]
+            n = 1
+            while i + n < len(kinds) and kinds[i + n][0] == kind and n < RUN_MAX:
+                n += 1
+            runs.append(kind | (n - 1))
+            for _, px, a in kinds[i:i + n]:
+                if kind != RUN_CLEAR:
+                    pixels.append(px)
+                if kind == RUN_BLEND:
+                    alpha.append(a)
+            if kind == RUN_OPAQUE:
+                opaque += n
+            elif kind == RUN_BLEND:
+                blended += n
+            i += n
+        runs.append(RUN_END)
+
+    return dict(width=width, height=height, x=x0, y=y0, w=x1 - x0 + 1, h=y1 - y0 + 1,
+                runs=runs, pixels=pixels, alpha=alpha, opaque=opaque, blended=blended)
+
+
+def c_array(ctype, name, values, fmt, per_line):
+    out = ["static const %s %s[] = {" % (ctype, name)]
+    for i in range(0, len(values), per_line):
+        out.append("\t" + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    out.append("};")
+    return out
+
+
+def write(sprites, out, command):
+    base = os.path.basename(out)
+    guard = "__%s_H__" % re.sub(r"\W", "_", base).upper()
+    banner = "/* Sinh bởi utils/sprite2c.py, không sửa tay:\n *   %s\n */" % command
+
+    h = [banner, "#ifndef %s" % guard, "#define %s" % guard, "", '#include "sprite.h"', ""]
+    for name, _ in sprites:
+        h.append("extern const sprite_t icon_%s;" % name)
+    h += ["", "#define ICON_COUNT %d" % len(sprites),
+          "extern const sprite_t *const icon_all[ICON_COUNT];",
+          "extern const char *const icon_names[ICON_COUNT];", "", "#endif", ""]
+
+    c = [banner, '#include "%s.h"' % base, ""]
+    for name, s in sprites:
+        c += c_array("uint8_t", "%s_runs" % name, s["runs"], "0x%02X", 16)
+        c += c_array("uint16_t", "%s_pixels" % name, s["pixels"] or [0], "0x%04X", 12)
+        c += c_array("uint8_t", "%s_alpha" % name, s["alpha"] or [0], "%3d", 16)
+        c += ["",
+              "const sprite_t icon_%s = {" % name,
+              "\t.width = %d, .height = %d," % (s["width"], s["height"]),
+              "\t.x = %d, .y = %d, .w = %d, .h = %d," % (s["x"], s["y"], s["w"], s["h"]),
+              "\t.runs = %s_runs, .pixels = %s_pixels, .alpha = %s_alpha," % (name, name, name),
+              "\t.opaque = %d, .blended = %d," % (s["opaque"], s["blended"]),
+              "};", ""]
+    c.append("const sprite_t *const icon_all[ICON_COUNT] = {")
+    c += ["\t&icon_%s," % name for name, _ in sprites]
+    c += ["};", "", "const char *const icon_names[ICON_COUNT] = {"]
+    c += ['\t"%s",' % name for name, _ in sprites]
+    c += ["};", ""]
+
+    with open(out + ".h", "w", encoding="utf-8") as f:
+        f.write("\n".join(h))
+    with open(out + ".c", "w", encoding="utf-8") as f:
+        f.write("\n".join(c))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("png", nargs="+", help="ảnh PNG (tên file thành tên sprite)")
+    parser.add_argument("-o", "--out", default="icons", help="tiền tố file ra (mặc định: icons)")
+    args = parser.parse_args()
+
+    sprites = []
+    print("%-12s %7s %9s %7s %7s %7s %7s" % ("sprite", "design", "visible", "opaque", "blend", "bytes", "raw"))
+    for path in sorted(args.png):
+        name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+        s = encode(*read_png(path))
+        sprites.append((name, s))
+        size = len(s["runs"]) + 2 * len(s["pixels"]) + len(s["alpha"])
+        print("%-12s %7s %9s %7d %7d %7d %7d" % (
+            name, "%dx%d" % (s["width"], s["height"]), "%dx%d" % (s["w"], s["h"]),
+            s["opaque"], s["blended"], size, 3 * s["width"] * s["height"]))
+
+    command = " ".join(["python", "sprite2c.py"] + sys.argv[1:])
+    write(sprites, args.out, command)
+    print("Đã ghi %s.c / %s.h (%d sprite)" % (args.out, args.out, len(sprites)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,135 @@
+"""Chuyển trace bật/tắt của ESP32 sang định dạng Chrome trace (chrome://tracing, Perfetto).
+
+Nguồn vào:
+  python trace2chrome.py http://192.168.1.155/trace     # đọc endpoint /trace
+  python trace2chrome.py trace.json                     # JSON đã lưu từ /trace
+  python trace2chrome.py monitor.log                    # log serial có TRACE-BEGIN ... TRACE-END
+
+Ghi ra file Chrome trace (-o, mặc định trace_chrome.json) và in bảng độ trễ
+của từng lần bật/tắt: đầu vào -> GPIO -> yêu cầu vẽ -> LCD vẽ xong.
+"""
+import argparse
+import json
+import sys
+import urllib.request
+
+# Sự kiện bắt đầu một lần bật/tắt
+INPUTS = ("button_isr", "http_begin", "mqtt_cmd", "udp_cmd")
+
+
+def load(source):
+    if source.startswith("http://") or source.startswith("https://"):
+        with urllib.request.urlopen(source, timeout=10) as resp:
+            text = resp.read().decode("utf-8")
+    else:
+        with open(source, encoding="utf-8", errors="replace") as f:
+            text = f.read()
+
+    if text.lstrip().startswith("{"):
+        data = json.loads(text)
+        events = [tuple(e) for e in data["events"]]
+        return events, data.get("routes", [])
+
+    # Log serial: lấy lần dump cuối cùng
+    events = []
+    for line in text.splitlines():
+        line = line.strip()
+        if line.startswith("TRACE-BEGIN"):
+            events = []
+        elif line.startswith("TRACE "):
+            _, seq, ts, name, arg, core = line.split()[:6]
+            events.append((int(seq), int(ts), name, int(arg), int(core)))
+    return events, []
+
+
+def unwrap(events):
+    """ts_us là 32 bit thấp, tràn sau ~71 phút: nối lại thành thời gian tăng dần."""
+    events = sorted(events, key=lambda e: e[0])
+    out = []
+    base = 0
+    prev = None
+    for seq, ts, name, arg, core in events:
+        if prev is not None and ts + base < prev - (1 << 31):
+            base += 1 << 32
+        prev = ts + base
+        out.append((seq, prev, name, arg, core))
+    return out
+
+
+def label(name, arg, routes):
+    if name in ("http_begin", "http_end") and arg < len(routes):
+        return "%s %s" % (name, routes[arg])
+    return "%s %d" % (name, arg)
+
+
+def to_chrome(events, routes):
+    trace = []
+    open_spans = {}
+    for seq, ts, name, arg, core in events:
+        tid = "core%d" % core
+        trace.append({"name": label(name, arg, routes), "ph": "i", "s": "t",
+                      "ts": ts, "pid": 0, "tid": tid})
+        if name in ("lcd_begin", "http_begin"):
+            open_spans[(name[:-6], arg)] = (ts, tid)
+        elif name in ("lcd_end", "http_end"):
+            start = open_spans.pop((name[:-4], arg), None)
+            if start is not None:
+                span = "lcd" if name == "lcd_end" else "http " + (routes[arg] if arg < len(routes) else str(arg))
+                trace.append({"name": span, "ph": "X", "ts": start[0], "dur": ts - start[0],
+                              "pid": 0, "tid": start[1]})
+    return trace
+
+
+def toggles(events):
+    """Ghép mỗi đầu vào với GPIO, yêu cầu vẽ và lần LCD vẽ xong tiếp theo."""
+    result = []
+    cur = None
+    for seq, ts, name, arg, core in events:
+        if name in INPUTS:
+            # Nút nhấn đi qua ISR rồi mới tới button_event; giữ mốc ISR làm điểm đầu
+            if cur is None or "gpio" in cur:
+                cur = {"source": name, "start": ts}
+        elif cur is None:
+            continue
+        elif name in ("gpio", "render_request", "lcd_begin") and name not in cur:
+            cur[name] = ts
+        elif name == "lcd_end" and "lcd_begin" in cur:
+            cur["lcd_end"] = ts
+            result.append(cur)
+            cur = None
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="URL của /trace, file JSON hoặc log serial")
+    parser.add_argument("-o", "--output", default="trace_chrome.json")
+    args = parser.parse_args()
+
+    events, routes = load(args.source)
+    if not events:
+        sys.exit("Không có sự kiện trace nào")
+    events = unwrap(events)
+
+    trace = to_chrome(events, routes)
+    found = toggles(events)
+    for i, t in enumerate(found):
+        trace.append({"name": "toggle (%s)" % t["source"], "cat": "toggle", "ph": "b", "id": i,
+                      "ts": t["start"], "pid": 0, "tid": "toggle"})
+        trace.append({"name": "toggle (%s)" % t["source"], "cat": "toggle", "ph": "e", "id": i,
+                      "ts": t["lcd_end"], "pid": 0, "tid": "toggle"})
+
+    with open(args.output, "w", encoding="utf-8") as f:
+        json.dump({"traceEvents": trace, "displayTimeUnit": "ms"}, f)
+    print("Đã ghi %d sự kiện vào %s" % (len(trace), args.output))
+
+    # Bảng độ trễ (ms), tính từ mốc đầu vào
+    print("%-12s %8s %8s %8s %8s" % ("source", "gpio", "render", "lcd", "total"))
+    for t in found:
+        def ms(key):
+            return "%8.2f" % ((t[key] - t["start"]) / 1000.0) if key in t else "%8s" % "-"
+        print("%-12s %s %s %s %s" % (t["source"], ms("gpio"), ms("render_request"), ms("lcd_begin"), ms("lcd_end")))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,81 @@
+﻿using System.Net;
+using System.Net.Sockets;
+using System.Text;
+
+namespace SmartLight
+{
+    public record SmartLightDevice(string Name, IPAddress Address, int HttpPort)
+    {
+        public string Url => HttpPort == 80 ? $"http://{Address}" : $"http://{Address}:{HttpPort}";
+    }
+
+    // Tìm thiết bị trong LAN bằng gói DISCOVER của giao thức UDP (xem udpctl.h trên ESP)
+    public static class DeviceDiscovery
+    {
+        const int Port = 4210;
+        static readonly IPAddress MulticastGroup = IPAddress.Parse("239.255.76.76");
+
+        const byte Version = 1;
+        const byte OpDiscover = 0x05;
+        const byte Ack = 0x80;
+        const int AckHeaderLength = 16;
+
+        public static async Task<List<SmartLightDevice>> DiscoverAsync(TimeSpan timeout)
+        {
+            var devices = new Dictionary<IPAddress, SmartLightDevice>();
+            ushort seq = (ushort)Random.Shared.Next(ushort.MaxValue);
+            byte[] packet = { (byte)'S', (byte)'L', Version, OpDiscover, (byte)(seq >> 8), (byte)seq, 0, 0 };
+
+            using var udp = new UdpClient(AddressFamily.InterNetwork);
+            udp.EnableBroadcast = true;
+
+            await udp.SendAsync(packet, packet.Length, new IPEndPoint(IPAddress.Broadcast, Port));
+            try
+            {
+                await udp.SendAsync(packet, packet.Length, new IPEndPoint(MulticastGroup, Port));
+            }
+            catch (SocketException)
+            {
+                // Một số mạng chặn multicast, broadcast là đủ
+            }
+
+            using var cts = new CancellationTokenSource(timeout);
+            try
+            {
+                while (true)
+                {
+                    UdpReceiveResult result = await udp.ReceiveAsync(cts.Token);
+                    var device = Parse(result.Buffer, result.RemoteEndPoint.Address);
+                    if (device != null)
+                    {
+                        devices[device.Address] = device;
+                    }
+                }
+            }
+            catch (OperationCanceledException)
+            {
+            }
+
+            return devices.Values.OrderBy(d => d.Name).ToList();
+        }
+
+        static SmartLightDevice? Parse(byte[] b, IPAddress from)
+        {
+            if (b.Length < AckHeaderLength + 3 || b[0] != 'S' || b[1] != 'L' ||
+                b[2] != Version || b[3] != (OpDiscover | Ack))
+            {
+                return null;
+            }
+
+            int port = (b[AckHeaderLength] << 8) | b[AckHeaderLength + 1];
+            int nameLength = b[AckHeaderLength + 2];
+            if (b.Length < AckHeaderLength + 3 + nameLength)
+            {
+                return null;
+            }
+
+            string name = Encoding.ASCII.GetString(b, AckHeaderLength + 3, nameLength);
+            return new SmartLightDevice(name, from, port);
+        }
+    }
+}
@@ -5,8 +5,11 @@ namespace SmartLight
 {
     public partial class MainPage : ContentPage
     {
-        const string url = "http://192.168.1.155";
-        
+        // Địa chỉ thiết bị, tìm bằng DeviceDiscovery; null khi chưa tìm thấy
+        string? url = null;
+        int failedPings = 0;
+        const int MaxFailedPings = 5;
+
         bool led1State = false;
         bool led2State = false;
 
@@ -29,12 +32,31 @@ namespace SmartLight
             {
                 while (true)
                 {
+                    if (url == null)
+                    {
+                        var devices = DeviceDiscovery.DiscoverAsync(TimeSpan.FromSeconds(2)).Result;
+                        if (devices.Count == 0)
+                        {
+                            connected = false;
+                            MainThread.BeginInvokeOnMainThread(UpdateState);
+                            continue;
+                        }
+                        url = devices[0].Url;
+                        failedPings = 0;
+                    }
+
                     connected = PingUrlAsync(url + "/led").Result;
+                    // Mất kết nối lâu (thiết bị đổi IP hoặc tắt): tìm lại
+                    failedPings = connected ? 0 : failedPings + 1;
+                    if (failedPings >= MaxFailedPings)
+                    {
+                        url = null;
+                    }
                     MainThread.BeginInvokeOnMainThread(() =>
                     {
                         UpdateState();
                     });
-                    if (connected)
+                    if (connected && url != null)
                     {
                         try
                         {
@@ -84,6 +106,7 @@ namespace SmartLight
 
         public async Task<string> ToggleLed1Async()
         {
+            if (url == null) return "";
             string postUrl = url + "/toggle-led1";
             HttpContent content = new StringContent("");
             return await PostAsync(postUrl, content);
@@ -91,6 +114,7 @@ namespace SmartLight
 
         public async Task<string> ToggleLed2Async()
         {
+            if (url == null) return "";
             string postUrl = url + "/toggle-led2";
             HttpContent content = new StringContent("");
             return await PostAsync(postUrl, content);